@@ -5,14 +5,15 @@
 #pragma once
 
 #include "constants.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "impl/bfs.hpp"
 #include "types.hpp"
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 template <
     type_traits::c_alg_return_type AlgReturnType = algorithm::default_return,
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -59,4 +60,4 @@ impl::alg_return_type<AlgReturnType, predecessors_descriptor> breadth_first_sear
         return pd;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
@@ -4,14 +4,15 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "impl/bfs.hpp"
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 using bicoloring_type = std::vector<types::binary_color>;
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -70,13 +71,13 @@ template <
     return coloring_opt;
 }
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 [[nodiscard]] gl_attr_force_inline bool is_bipartite(const GraphType& graph) {
     return bipartite_coloring(graph).has_value();
 }
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_sized_range_of<types::binary_color> ColorRange>
 requires(type_traits::c_binary_color_properties_type<typename GraphType::vertex_properties_type>)
 bool apply_coloring(GraphType& graph, const ColorRange& color_range) {
@@ -86,10 +87,22 @@ bool apply_coloring(GraphType& graph, const ColorRange& color_range) {
     using color_type = typename GraphType::vertex_properties_type::color_type;
     auto color_it = std::ranges::begin(color_range);
 
-    for (const auto& vertex : graph.vertices())
-        vertex.properties.color = color_type{*color_it++};
+    if constexpr (requires { graph.vertex_property_column(); }) {
+        // the colors are written to the property column in a single pass
+        // (the values in the removed vertex slots are unspecified, so they can be overwritten)
+        for (auto& properties : graph.vertex_property_column())
+            properties.color = color_type{*color_it++};
+    }
+    else {
+        // the colors are matched with the vertex slots (the removed vertices are skipped)
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < graph.n_vertices();
+             ++vertex_id, ++color_it)
+            if (graph.has_vertex(vertex_id))
+                get_properties<GraphType>(graph.get_vertex(vertex_id)).color =
+                    color_type{*color_it};
+    }
 
     return true;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
@@ -4,12 +4,13 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 
 #include <optional>
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 inline constexpr std::nullopt_t no_root_vertex = std::nullopt;
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
@@ -5,13 +5,14 @@
 #pragma once
 
 #include "constants.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "impl/dfs.hpp"
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 template <
     type_traits::c_alg_return_type AlgReturnType = algorithm::default_return,
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -60,7 +61,7 @@ impl::alg_return_type<AlgReturnType, predecessors_descriptor> depth_first_search
 
 template <
     type_traits::c_alg_return_type AlgReturnType = algorithm::default_return,
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -110,4 +111,4 @@ impl::alg_return_type<AlgReturnType, predecessors_descriptor> recursive_depth_fi
         return pd;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
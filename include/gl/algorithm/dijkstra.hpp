@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/graph_utility.hpp"
-#include "impl/pfs.hpp"
+#include "impl/common.hpp"
 
 #include <deque>
+#include <queue>
+#include <tuple>
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 template <type_traits::c_basic_arithmetic VertexDistanceType>
 struct paths_descriptor : public predecessors_descriptor {
@@ -53,10 +56,10 @@ struct paths_descriptor : public predecessors_descriptor {
     std::vector<distance_type> distances;
 };
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 using paths_descriptor_type = paths_descriptor<types::vertex_distance_type<GraphType>>;
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 [[nodiscard]] gl_attr_force_inline paths_descriptor_type<GraphType> make_paths_descriptor(
     const GraphType& graph
 ) {
@@ -64,7 +67,7 @@ template <type_traits::c_graph GraphType>
 }
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -75,7 +78,6 @@ template <
     const PreVisitCallback& pre_visit = {},
     const PostVisitCallback& post_visit = {}
 ) {
-    using vertex_type = typename GraphType::vertex_type;
     using edge_type = typename GraphType::edge_type;
     using distance_type = types::vertex_distance_type<GraphType>;
 
@@ -84,46 +86,58 @@ template <
     paths.predecessors.at(source_id).emplace(source_id);
     paths.distances[source_id] = distance_type{};
 
-    std::optional<types::const_ref_wrap<edge_type>> negative_edge;
-
-    impl::pfs(
-        graph,
-        [&paths](const algorithm::vertex_info& lhs, const algorithm::vertex_info& rhs) {
-            return paths.distances[lhs.id] > paths.distances[rhs.id];
-        },
-        impl::init_range(source_id),
-        algorithm::empty_callback{}, // visit predicate
-        algorithm::empty_callback{}, // visit callback
-        [&paths, &negative_edge](const vertex_type& vertex, const edge_type& in_edge)
-            -> std::optional<bool> { // enqueue predicate
-            const auto vertex_id = vertex.id();
-            const auto source_id = in_edge.incident_vertex(vertex).id();
-
-            const auto edge_weight = get_weight<GraphType>(in_edge);
-            if (edge_weight < constants::zero) {
-                negative_edge = std::cref(in_edge);
-                return std::nullopt;
+    // the ids and the weight of the negative edge (the edges yielded by some graphs are temporary)
+    std::optional<std::tuple<types::id_type, types::id_type, distance_type>> negative_edge;
+
+    const auto pq_compare = [&paths](
+                                const algorithm::vertex_info& lhs, const algorithm::vertex_info& rhs
+                            ) { return paths.distances[lhs.id] > paths.distances[rhs.id]; };
+
+    std::priority_queue<
+        algorithm::vertex_info,
+        std::vector<algorithm::vertex_info>,
+        decltype(pq_compare)>
+        vertex_queue(pq_compare);
+    vertex_queue.emplace(source_id);
+
+    while (not vertex_queue.empty() and not negative_edge.has_value()) {
+        const auto vertex_id = vertex_queue.top().id;
+        vertex_queue.pop();
+
+        // the weights are read from the weight column of the graph if it has one
+        impl::for_each_weighted_adjacent_edge(
+            graph,
+            vertex_id,
+            [&](const auto& get_edge,
+                const types::id_type incident_vertex_id,
+                const distance_type edge_weight) {
+                if (negative_edge.has_value())
+                    return;
+
+                if (edge_weight < constants::zero) {
+                    const edge_type& edge = get_edge();
+                    negative_edge.emplace(edge.first_id(), edge.second_id(), edge_weight);
+                    return;
+                }
+
+                const auto new_distance = paths.distances[vertex_id] + edge_weight;
+                if (not paths.predecessors[incident_vertex_id].has_value()
+                    or new_distance < paths.distances[incident_vertex_id]) {
+                    paths.distances[incident_vertex_id] = new_distance;
+                    paths.predecessors[incident_vertex_id].emplace(vertex_id);
+                    vertex_queue.emplace(incident_vertex_id, vertex_id);
+                }
             }
-
-            const auto new_distance = paths.distances[source_id] + edge_weight;
-            if (not paths.predecessors[vertex_id].has_value()
-                or new_distance < paths.distances[vertex_id]) {
-                paths.distances[vertex_id] = new_distance;
-                paths.predecessors[vertex_id].emplace(source_id);
-                return true;
-            }
-
-            return false;
-        }
-    );
+        );
+    }
 
     if (negative_edge.has_value()) {
-        const auto& edge = negative_edge.value().get();
+        const auto& [first_id, second_id, weight] = negative_edge.value();
         throw std::invalid_argument(std::format(
             "[alg::dijkstra_shortest_paths] Found an edge with a negative weight: [{}, {} | w={}]",
-            edge.first_id(),
-            edge.second_id(),
-            get_weight<GraphType>(edge)
+            first_id,
+            second_id,
+            weight
         ));
     }
 
@@ -156,4 +170,4 @@ template <type_traits::c_random_access_range_of<std::optional<types::id_type>> I
     return path;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
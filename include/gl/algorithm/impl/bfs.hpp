@@ -5,13 +5,14 @@
 #pragma once
 
 #include "common.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
 #include <queue>
 
-namespace gl::algorithm::impl {
+namespace gl::inline gl_id_type_namespace::algorithm::impl {
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_sized_range_of<algorithm::vertex_info> InitQueueRangeType =
         std::vector<algorithm::vertex_info>,
     type_traits::c_optional_vertex_callback<GraphType, bool> VisitVertexPredicate,
@@ -78,4 +79,4 @@ bool bfs(
     return true;
 }
 
-} // namespace gl::algorithm::impl
+} // namespace gl::inline gl_id_type_namespace::algorithm::impl
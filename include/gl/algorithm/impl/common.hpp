@@ -5,15 +5,16 @@
 #pragma once
 
 #include "gl/algorithm/types.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
-namespace gl::algorithm::impl {
+namespace gl::inline gl_id_type_namespace::algorithm::impl {
 
 // --- common functions ---
 
 template <
     type_traits::c_alg_return_type AlgReturnType,
     typename ReturnType,
-    type_traits::c_graph GraphType>
+    type_traits::c_graph_view GraphType>
 [[nodiscard]] gl_attr_force_inline alg_return_type_non_void<AlgReturnType, ReturnType>
 init_return_value(const GraphType& graph) {
     if constexpr (type_traits::c_alg_no_return_type<AlgReturnType>)
@@ -29,14 +30,14 @@ template <
     return InitRangeType{algorithm::vertex_info{root_vertex_id}};
 }
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 [[nodiscard]] gl_attr_force_inline auto default_visit_vertex_predicate(std::vector<bool>& visited) {
     return [&](const typename GraphType::vertex_type& vertex) -> bool {
         return not visited[vertex.id()];
     };
 }
 
-template <type_traits::c_graph GraphType, type_traits::c_alg_return_type AlgReturnType>
+template <type_traits::c_graph_view GraphType, type_traits::c_alg_return_type AlgReturnType>
 [[nodiscard]] gl_attr_force_inline auto default_visit_callback(
     std::vector<bool>& visited, alg_return_type_non_void<AlgReturnType, predecessors_descriptor>& pd
 ) {
@@ -49,7 +50,7 @@ template <type_traits::c_graph GraphType, type_traits::c_alg_return_type AlgRetu
     };
 }
 
-template <type_traits::c_graph GraphType, bool AsOptional = false>
+template <type_traits::c_graph_view GraphType, bool AsOptional = false>
 [[nodiscard]] gl_attr_force_inline auto default_enqueue_vertex_predicate(std::vector<bool>& visited
 ) {
     using return_type = std::conditional_t<AsOptional, std::optional<bool>, bool>;
@@ -60,4 +61,71 @@ template <type_traits::c_graph GraphType, bool AsOptional = false>
     };
 }
 
-} // namespace gl::algorithm::impl
+/*
+Calls `visit(get_edge, incident_vertex_id, weight)` for each adjacent edge of the vertex,
+    where `get_edge()` returns the adjacent edge.
+For the graphs with a weight column the incident vertex ids and the weights are read
+    sequentially from the columns and the edges themselves are accessed only when the visitor
+    calls `get_edge`, so the visitors which do not need the edges read only the columns.
+*/
+template <type_traits::c_graph_view GraphType, typename Visitor>
+gl_attr_force_inline void for_each_weighted_adjacent_edge(
+    const GraphType& graph, const types::id_type vertex_id, Visitor&& visit
+) {
+    if constexpr (type_traits::c_weight_column_graph_view<GraphType>) {
+        const auto incident_vertex_ids = graph.adjacent_vertex_ids(vertex_id);
+        const auto weights = graph.adjacent_weights(vertex_id);
+
+        auto edge_it = graph.adjacent_edges(vertex_id).begin();
+        for (types::size_type i = constants::zero; i < weights.size(); ++i, ++edge_it)
+            visit(
+                [&edge_it]() -> decltype(auto) { return *edge_it; },
+                incident_vertex_ids[i],
+                weights[i]
+            );
+    }
+    else {
+        for (const auto& edge : graph.adjacent_edges(vertex_id))
+            visit(
+                [&edge]() -> const auto& { return edge; },
+                edge.incident_vertex_id(vertex_id),
+                get_weight<GraphType>(edge)
+            );
+    }
+}
+
+/*
+A handle of an adjacent edge which stays valid after the adjacent edge range is iterated.
+For the graphs which yield temporary adjacent edges (e.g. the bit matrix graphs) only the ids
+    of the edge's vertices are kept and the edge stored by the graph is retrieved with `get_edge`
+    when the handle is resolved.
+*/
+template <type_traits::c_graph_view GraphType>
+class adjacent_edge_handle {
+public:
+    using edge_type = typename GraphType::edge_type;
+
+    adjacent_edge_handle() = default;
+
+    explicit adjacent_edge_handle(const edge_type& edge) {
+        if constexpr (stores_address)
+            this->_edge = &edge;
+        else
+            this->_edge = {edge.first_id(), edge.second_id()};
+    }
+
+    [[nodiscard]] gl_attr_force_inline const edge_type& resolve(const GraphType& graph) const {
+        if constexpr (stores_address)
+            return *this->_edge;
+        else
+            return graph.get_edge(this->_edge.first, this->_edge.second)->get();
+    }
+
+private:
+    static constexpr bool stores_address = type_traits::c_stable_edge_graph_view<GraphType>;
+
+    std::conditional_t<stores_address, const edge_type*, types::homogeneous_pair<types::id_type>>
+        _edge{};
+};
+
+} // namespace gl::inline gl_id_type_namespace::algorithm::impl
@@ -5,13 +5,14 @@
 #pragma once
 
 #include "common.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
 #include <stack>
 
-namespace gl::algorithm::impl {
+namespace gl::inline gl_id_type_namespace::algorithm::impl {
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, bool> VisitVertexPredicate,
     type_traits::c_vertex_callback<GraphType, bool, types::id_type> VisitCallback,
     type_traits::
@@ -67,7 +68,7 @@ void dfs(
 }
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     type_traits::c_vertex_callback<GraphType, bool> VisitVertexPredicate,
     type_traits::c_vertex_callback<GraphType, bool, types::id_type> VisitCallback,
     type_traits::
@@ -117,4 +118,4 @@ void r_dfs(
         post_visit(vertex);
 }
 
-} // namespace gl::algorithm::impl
+} // namespace gl::inline gl_id_type_namespace::algorithm::impl
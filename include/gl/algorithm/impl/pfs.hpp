@@ -5,13 +5,14 @@
 #pragma once
 
 #include "common.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
 #include <queue>
 
-namespace gl::algorithm::impl {
+namespace gl::inline gl_id_type_namespace::algorithm::impl {
 
 template <
-    type_traits::c_graph GraphType,
+    type_traits::c_graph_view GraphType,
     std::predicate<algorithm::vertex_info, algorithm::vertex_info> PQCompare,
     type_traits::c_sized_range_of<algorithm::vertex_info> InitQueueRangeType =
         std::vector<algorithm::vertex_info>,
@@ -80,4 +81,4 @@ bool pfs(
     return true;
 }
 
-} // namespace gl::algorithm::impl
+} // namespace gl::inline gl_id_type_namespace::algorithm::impl
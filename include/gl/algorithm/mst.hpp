@@ -5,14 +5,15 @@
 #pragma once
 
 #include "constants.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "impl/common.hpp"
 
 #include <numeric>
 #include <queue>
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
-template <type_traits::c_undirected_graph GraphType>
+template <type_traits::c_undirected_graph_view GraphType>
 struct mst_descriptor {
     using graph_type = GraphType;
     using edge_type = typename graph_type::edge_type;
@@ -27,7 +28,7 @@ struct mst_descriptor {
 };
 
 template <
-    type_traits::c_undirected_graph GraphType,
+    type_traits::c_undirected_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -41,20 +42,26 @@ template <
     // type definitions
 
     using vertex_type = typename GraphType::vertex_type;
-    using edge_type = typename GraphType::edge_type;
-    using edge_info_type = algorithm::edge_info<edge_type>;
+    using edge_handle_type = impl::adjacent_edge_handle<GraphType>;
     using distance_type = types::vertex_distance_type<GraphType>;
 
+    // the weights are stored in the queue so that the comparisons do not access the edges
+    struct weighted_edge_info {
+        edge_handle_type edge;
+        types::id_type target_id;
+        distance_type weight;
+    };
+
     struct edge_info_comparator {
         [[nodiscard]] gl_attr_force_inline bool operator()(
-            const edge_info_type& lhs, const edge_info_type& rhs
+            const weighted_edge_info& lhs, const weighted_edge_info& rhs
         ) const {
-            return get_weight<GraphType>(lhs.edge.get()) > get_weight<GraphType>(rhs.edge.get());
+            return lhs.weight > rhs.weight;
         }
     };
 
-    using queue_type =
-        std::priority_queue<edge_info_type, std::vector<edge_info_type>, edge_info_comparator>;
+    using queue_type = std::
+        priority_queue<weighted_edge_info, std::vector<weighted_edge_info>, edge_info_comparator>;
 
     // prepare the necessary utility
     const auto n_vertices = graph.n_vertices();
@@ -65,43 +72,51 @@ template <
     // insert the edges adjacent to the root vertex to the queue
     const types::id_type root_id = root_id_opt.value_or(constants::zero);
 
-    for (const auto& edge : graph.adjacent_edges(root_id))
-        edge_queue.emplace(edge, root_id);
+    const auto enqueue_adjacent_edges = [&](const types::id_type source_id) {
+        impl::for_each_weighted_adjacent_edge(
+            graph,
+            source_id,
+            [&](const auto& get_edge,
+                const types::id_type incident_vertex_id,
+                const distance_type edge_weight) {
+                if (not visited[incident_vertex_id])
+                    edge_queue.push({edge_handle_type{get_edge()}, incident_vertex_id, edge_weight}
+                    );
+            }
+        );
+    };
+
+    enqueue_adjacent_edges(root_id);
 
     // mark the root vertex as visited
     visited[root_id] = true;
     types::size_type n_vertices_in_mst = constants::one;
+    const auto n_live_vertices = n_vertices - graph.n_removed_vertices();
 
     // find the mst
-    while (n_vertices_in_mst < n_vertices) {
-        const auto min_edge_info = edge_queue.top();
+    while (n_vertices_in_mst < n_live_vertices) {
+        const auto [min_edge, target_id, min_weight] = edge_queue.top();
         edge_queue.pop();
 
-        const auto& min_edge = min_edge_info.edge.get();
-        const auto min_weight = get_weight<GraphType>(min_edge);
-
-        const auto& target_id = min_edge.incident_vertex_id(min_edge_info.source_id);
         if (visited[target_id])
             continue;
 
         // add the minimum weight edge to the mst
-        mst.edges.emplace_back(min_edge);
+        mst.edges.emplace_back(min_edge.resolve(graph));
         mst.weight += min_weight;
 
         visited[target_id] = true;
         ++n_vertices_in_mst;
 
         // enqueue all edges adjacent to the `target` vertex if they lead to unvisited verties
-        for (const auto& edge : graph.adjacent_edges(target_id))
-            if (not visited[edge.incident_vertex_id(target_id)])
-                edge_queue.emplace(edge, target_id);
+        enqueue_adjacent_edges(target_id);
     }
 
     return mst;
 }
 
 template <
-    type_traits::c_undirected_graph GraphType,
+    type_traits::c_undirected_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -114,7 +129,7 @@ requires type_traits::c_has_numeric_limits_max<types::vertex_distance_type<Graph
     const PostVisitCallback& post_visit = {}
 ) {
     // type definitions
-    using edge_type = typename GraphType::edge_type;
+    using edge_handle_type = impl::adjacent_edge_handle<GraphType>;
     using distance_type = types::vertex_distance_type<GraphType>;
 
     // Prepare the necessary utility
@@ -123,7 +138,7 @@ requires type_traits::c_has_numeric_limits_max<types::vertex_distance_type<Graph
 
     std::vector<bool> in_mst(n_vertices, false);
     std::vector<distance_type> min_cost(n_vertices, std::numeric_limits<distance_type>::max());
-    std::vector<const edge_type*> min_cost_edges(n_vertices, nullptr);
+    std::vector<std::optional<edge_handle_type>> min_cost_edges(n_vertices);
 
     // set the distance to the root vertex to 0
     min_cost.at(root_id_opt.value_or(constants::zero)) = constants::zero;
@@ -133,8 +148,9 @@ requires type_traits::c_has_numeric_limits_max<types::vertex_distance_type<Graph
     };
 
     // Initialize the vertex info and the heap
-    std::vector<types::id_type> heap(n_vertices);
-    std::iota(heap.begin(), heap.end(), constants::initial_id);
+    std::vector<types::id_type> heap;
+    heap.reserve(n_vertices);
+    std::ranges::copy(graph.vertex_ids(), std::back_inserter(heap));
     std::make_heap(heap.begin(), heap.end(), heap_comparator);
 
     while (not heap.empty()) {
@@ -148,22 +164,25 @@ requires type_traits::c_has_numeric_limits_max<types::vertex_distance_type<Graph
 
         in_mst[vertex_id] = true;
 
-        const auto* min_cost_edge = min_cost_edges[vertex_id];
-        if (min_cost_edge != nullptr) { // Add the corresponding edge to MST
-            mst.edges.emplace_back(*min_cost_edge);
+        const auto& min_cost_edge = min_cost_edges[vertex_id];
+        if (min_cost_edge.has_value()) { // Add the corresponding edge to MST
+            mst.edges.emplace_back(min_cost_edge->resolve(graph));
             mst.weight += min_cost[vertex_id];
         }
 
         // Update adjacent vertices
-        for (const auto& edge : graph.adjacent_edges(vertex_id)) {
-            const auto edge_weight = get_weight<GraphType>(edge);
-            const auto incident_vertex_id = edge.incident_vertex_id(vertex_id);
-
-            if (not in_mst[incident_vertex_id] && edge_weight < min_cost[incident_vertex_id]) {
-                min_cost[incident_vertex_id] = edge_weight;
-                min_cost_edges[incident_vertex_id] = &edge;
+        impl::for_each_weighted_adjacent_edge(
+            graph,
+            vertex_id,
+            [&](const auto& get_edge,
+                const types::id_type incident_vertex_id,
+                const distance_type edge_weight) {
+                if (not in_mst[incident_vertex_id] && edge_weight < min_cost[incident_vertex_id]) {
+                    min_cost[incident_vertex_id] = edge_weight;
+                    min_cost_edges[incident_vertex_id].emplace(get_edge());
+                }
             }
-        }
+        );
 
         // Rebuild the heap for the updated vertices
         std::make_heap(heap.begin(), heap.end(), heap_comparator);
@@ -172,4 +191,4 @@ requires type_traits::c_has_numeric_limits_max<types::vertex_distance_type<Graph
     return mst;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
@@ -4,12 +4,13 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "impl/bfs.hpp"
 
-namespace gl::algorithm {
+namespace gl::inline gl_id_type_namespace::algorithm {
 
 template <
-    type_traits::c_directed_graph GraphType,
+    type_traits::c_directed_graph_view GraphType,
     type_traits::c_optional_vertex_callback<GraphType, void> PreVisitCallback =
         algorithm::empty_callback,
     type_traits::c_optional_vertex_callback<GraphType, void> PostVisitCallback =
@@ -22,15 +23,13 @@ template <
     using vertex_type = typename GraphType::vertex_type;
     using edge_type = typename GraphType::edge_type;
 
-    const auto vertex_ids = graph.vertex_ids();
-
     // prepare the vertex in degree map
     std::vector<types::size_type> in_degree_map = graph.in_degree_map();
 
     // prepare the initial queue content (source vertices)
     std::vector<algorithm::vertex_info> source_vertex_list;
     source_vertex_list.reserve(graph.n_vertices());
-    for (const auto id : vertex_ids)
+    for (const auto id : graph.vertex_ids())
         if (in_degree_map[id] == constants::default_size)
             source_vertex_list.emplace_back(id);
 
@@ -59,10 +58,10 @@ template <
         post_visit
     );
 
-    if (topological_order.size() != graph.n_vertices())
+    if (topological_order.size() != graph.n_vertices() - graph.n_removed_vertices())
         return std::nullopt;
 
     return topological_order_opt;
 }
 
-} // namespace gl::algorithm
+} // namespace gl::inline gl_id_type_namespace::algorithm
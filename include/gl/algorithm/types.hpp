@@ -4,11 +4,12 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/graph_utility.hpp"
 
 #include <functional>
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace algorithm {
 
@@ -117,4 +118,4 @@ using alg_return_type_non_void = std::
 
 } // namespace algorithm::impl
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -0,0 +1,22 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+/*
+The layouts and signatures of the library's types depend on the width of the vertex ids,
+    so all declarations are placed in an inline namespace keyed on the width. The translation
+    units compiled with and without `GL_CONFIG_ID_TYPE_32` refer to differently mangled entities,
+    so linking them into a single program fails instead of silently violating the ODR.
+*/
+
+#ifdef gl_id_type_namespace
+#error "The gl_id_type_namespace macro is reserved for the library's inline namespace"
+#endif
+
+#ifdef GL_CONFIG_ID_TYPE_32
+#define gl_id_type_namespace id_type_32
+#else
+#define gl_id_type_namespace id_type_64
+#endif
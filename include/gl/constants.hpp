@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "types/types.hpp"
 
-namespace gl::constants {
+#include <limits>
+
+namespace gl::inline gl_id_type_namespace::constants {
 
 inline constexpr types::size_type zero{0ull};
 inline constexpr types::size_type one{1ull};
@@ -15,5 +18,6 @@ inline constexpr types::size_type two{2ull};
 inline constexpr types::size_type default_size{zero};
 inline constexpr types::size_type begin_idx{zero};
 inline constexpr types::id_type initial_id{zero};
+inline constexpr types::id_type invalid_id{std::numeric_limits<types::id_type>::max()};
 
-} // namespace gl::constants
+} // namespace gl::inline gl_id_type_namespace::constants
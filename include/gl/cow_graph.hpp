@@ -0,0 +1,517 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "graph_utility.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace {
+
+/*
+A copy-on-write graph which shares the unchanged parts of its structure with its forks.
+
+The vertices and their adjacency lists are stored in chunks of `chunk_size` consecutive vertices.
+The adjacency lists store the ids of the adjacent vertices (and the edge properties) instead of
+    edge descriptors, so the chunks do not reference each other and can be shared between graphs.
+Forking a graph is O(1) - the fork shares the whole chunk table. The first modification of
+    a shared graph copies the chunk table (O(V / chunk_size) pointers) and each modification
+    copies only the shared chunks of the modified vertices (O(chunk_size + the sizes of
+    their adjacency lists)), so all unchanged chunks stay shared between the forks.
+
+The graph satisfies the `type_traits::c_graph_view` concept. Its edges are not stored -
+    the `adjacent_edges` ranges yield temporary edges (like the compressed graphs), which are
+    bound to the vertices of the graph and are valid until the graph is modified.
+The edges of undirected graphs are stored in the adjacency lists of both their vertices
+    (a loop is stored once), which is why the yielded edges are oriented so that their first
+    vertex is the one with the smaller id.
+The vertices cannot be removed, because the ids of the vertices are shared between the forks.
+NOTE: The properties must be modified with the `set_*_properties` methods. Modifying the
+    (`mutable`) properties of the returned vertices would modify the chunks shared with the forks.
+
+The forks can be used concurrently as long as each fork is used by a single thread
+    (the sharing is tracked with the atomic reference counters of `std::shared_ptr`).
+*/
+
+template <type_traits::c_graph GraphType>
+requires(
+    not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>
+    and not type_traits::c_column_property_ref<typename GraphType::vertex_type::properties_type>
+)
+class cow_graph final {
+    // an adjacency list entry stores the id of the adjacent vertex instead of an edge descriptor
+    struct adjacency_entry {
+        types::id_type vertex_id;
+        [[no_unique_address]] typename GraphType::edge_properties_type properties{};
+    };
+
+    using adjacency_list_type = std::vector<adjacency_entry>;
+
+public:
+    using graph_type = GraphType;
+    using traits_type = typename graph_type::traits_type;
+
+    using vertex_type = typename graph_type::vertex_type;
+    using vertex_properties_type = typename graph_type::vertex_properties_type;
+
+    using edge_type = typename graph_type::edge_type;
+    using edge_directional_tag = typename graph_type::edge_directional_tag;
+    using edge_properties_type = typename graph_type::edge_properties_type;
+
+    // the number of consecutive vertices stored (and copied on write) together
+    static constexpr types::size_type chunk_size = 64ull;
+
+    class edge_iterator;
+
+    cow_graph() : _chunks(std::make_shared<chunk_table_type>()) {}
+
+    // copies the structure and the properties of the graph in O(V + E)
+    explicit cow_graph(const graph_type& graph) : cow_graph() {
+        if (graph.n_removed_vertices() > constants::zero)
+            throw std::logic_error(std::format(
+                "Cannot create a copy-on-write graph from a graph with {} removed vertices "
+                "pending compaction",
+                graph.n_removed_vertices()
+            ));
+
+        this->_chunks->reserve(_n_chunks(graph.n_vertices()));
+        for (const auto& vertex : graph.vertices()) {
+            if constexpr (type_traits::is_default_properties_type_v<vertex_properties_type>)
+                this->add_vertex();
+            else
+                this->add_vertex(vertex.properties);
+        }
+
+        for (const auto vertex_id : graph.vertex_ids()) {
+            auto& adjacency_list = this->_mutable_adjacency_list(vertex_id);
+            for (const auto& edge : graph.adjacent_edges(vertex_id))
+                adjacency_list.push_back(
+                    adjacency_entry{edge.incident_vertex_id(vertex_id), edge.properties}
+                );
+        }
+        this->_n_unique_edges = graph.n_unique_edges();
+    }
+
+    // the copies share the structure of the graph (see `fork`)
+    cow_graph(const cow_graph&) = default;
+    cow_graph& operator=(const cow_graph&) = default;
+
+    cow_graph(cow_graph&&) = default;
+    cow_graph& operator=(cow_graph&&) = default;
+
+    ~cow_graph() = default;
+
+    // creates a graph which shares the whole structure with this graph
+    [[nodiscard]] gl_attr_force_inline cow_graph fork() const {
+        return *this;
+    }
+
+    /*
+    Checks whether the chunk table of the graph is shared with other graphs.
+    The check does not synchronize with the other threads (it reads `use_count`), so the result
+        may already be outdated if the other graphs are concurrently released - it is exact only
+        when it returns false, because the other graphs cannot be forked concurrently.
+    */
+    [[nodiscard]] gl_attr_force_inline bool is_shared() const {
+        return this->_chunks.use_count() > 1l;
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool shares_with(const cow_graph& other) const {
+        return this->_chunks == other._chunks;
+    }
+
+    // creates a regular graph with the same structure and properties in O(V + E)
+    [[nodiscard]] graph_type to_graph() const {
+        graph_type graph;
+        for (const auto& vertex : this->vertices()) {
+            if constexpr (type_traits::is_default_properties_type_v<vertex_properties_type>)
+                graph.add_vertex();
+            else
+                graph.add_vertex(vertex.properties);
+        }
+
+        for (const auto vertex_id : this->vertex_ids()) {
+            for (const auto& entry : this->_adjacency_list(vertex_id)) {
+                if constexpr (type_traits::is_undirected_v<edge_type>)
+                    if (entry.vertex_id < vertex_id)
+                        continue; // the edge will be added for its first vertex
+
+                if constexpr (type_traits::is_default_properties_type_v<edge_properties_type>)
+                    graph.add_edge(vertex_id, entry.vertex_id);
+                else
+                    graph.add_edge(vertex_id, entry.vertex_id, entry.properties);
+            }
+        }
+
+        return graph;
+    }
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_n_vertices;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_removed_vertices() const {
+        return constants::zero;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_n_unique_edges;
+    }
+
+    // --- vertex methods ---
+
+    [[nodiscard]] gl_attr_force_inline auto vertex_ids() const {
+        return std::views::iota(
+            constants::initial_id, static_cast<types::id_type>(this->_n_vertices)
+        );
+    }
+
+    [[nodiscard]] gl_attr_force_inline auto vertices() const {
+        return std::views::transform(
+            this->vertex_ids(),
+            [this](const types::id_type vertex_id) -> const vertex_type& {
+                return this->_vertex(vertex_id);
+            }
+        );
+    }
+
+    [[nodiscard]] gl_attr_force_inline const vertex_type& get_vertex(const types::id_type vertex_id
+    ) const {
+        this->_verify_vertex_id(vertex_id);
+        return this->_vertex(vertex_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool has_vertex(const types::id_type vertex_id) const {
+        return vertex_id < this->_n_vertices;
+    }
+
+    const vertex_type& add_vertex() {
+        return this->_add_vertex(vertex_properties_type{});
+    }
+
+    const vertex_type& add_vertex(const vertex_properties_type& properties)
+    requires(not type_traits::is_default_properties_type_v<vertex_properties_type>)
+    {
+        return this->_add_vertex(properties);
+    }
+
+    void set_vertex_properties(
+        const types::id_type vertex_id, const vertex_properties_type& properties
+    )
+    requires(not type_traits::is_default_properties_type_v<vertex_properties_type>)
+    {
+        this->_verify_vertex_id(vertex_id);
+        this->_mutable_chunk(vertex_id).vertices[_offset(vertex_id)].properties = properties;
+    }
+
+    // --- edge methods ---
+
+    // yields temporary edges which are valid until the graph is modified
+    [[nodiscard]] types::iterator_range<edge_iterator> adjacent_edges(
+        const types::id_type vertex_id
+    ) const {
+        this->_verify_vertex_id(vertex_id);
+        const auto& adjacency_list = this->_adjacency_list(vertex_id);
+        return make_iterator_range(
+            edge_iterator{this, vertex_id, adjacency_list.cbegin()},
+            edge_iterator{this, vertex_id, adjacency_list.cend()}
+        );
+    }
+
+    [[nodiscard]] bool has_edge(const types::id_type first_id, const types::id_type second_id)
+        const {
+        if (not (this->has_vertex(first_id) and this->has_vertex(second_id)))
+            return false;
+
+        const auto& adjacency_list = this->_adjacency_list(first_id);
+        return std::ranges::find(adjacency_list, second_id, &adjacency_entry::vertex_id)
+            != adjacency_list.cend();
+    }
+
+    void add_edge(const types::id_type first_id, const types::id_type second_id) {
+        this->_add_edge(first_id, second_id, edge_properties_type{});
+    }
+
+    void add_edge(
+        const types::id_type first_id,
+        const types::id_type second_id,
+        const edge_properties_type& properties
+    )
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    {
+        this->_add_edge(first_id, second_id, properties);
+    }
+
+    // removes one of the edges connecting the vertices (in the insertion order)
+    void remove_edge(const types::id_type first_id, const types::id_type second_id) {
+        this->_verify_edge(first_id, second_id);
+
+        _erase_entry(this->_mutable_adjacency_list(first_id), second_id);
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            if (first_id != second_id)
+                _erase_entry(this->_mutable_adjacency_list(second_id), first_id);
+
+        --this->_n_unique_edges;
+    }
+
+    // sets the properties of one of the edges connecting the vertices (in the insertion order)
+    void set_edge_properties(
+        const types::id_type first_id,
+        const types::id_type second_id,
+        const edge_properties_type& properties
+    )
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    {
+        this->_verify_edge(first_id, second_id);
+
+        _find_entry(this->_mutable_adjacency_list(first_id), second_id)->properties = properties;
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            if (first_id != second_id)
+                _find_entry(this->_mutable_adjacency_list(second_id), first_id)->properties =
+                    properties;
+    }
+
+    // --- incidence methods ---
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const
+    requires(type_traits::is_directed_v<edge_type>)
+    {
+        std::vector<types::size_type> in_degree_map(this->_n_vertices, constants::zero);
+        for (const auto vertex_id : this->vertex_ids())
+            for (const auto& entry : this->_adjacency_list(vertex_id))
+                ++in_degree_map[entry.vertex_id];
+        return in_degree_map;
+    }
+
+    [[nodiscard]] std::vector<types::size_type> out_degree_map() const
+    requires(type_traits::is_directed_v<edge_type>)
+    {
+        std::vector<types::size_type> out_degree_map;
+        out_degree_map.reserve(this->_n_vertices);
+        for (const auto vertex_id : this->vertex_ids())
+            out_degree_map.push_back(this->_adjacency_list(vertex_id).size());
+        return out_degree_map;
+    }
+
+    /*
+    A forward iterator yielding temporary edges which connect the given vertex with
+        its consecutive adjacent vertices.
+    */
+    class edge_iterator {
+    public:
+        using value_type = edge_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = edge_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        edge_iterator() = default;
+
+        edge_iterator(
+            const cow_graph* graph,
+            const types::id_type vertex_id,
+            const typename adjacency_list_type::const_iterator it
+        )
+        : _graph(graph), _vertex_id(vertex_id), _it(it) {}
+
+        [[nodiscard]] gl_attr_force_inline reference operator*() const {
+            auto first_id = this->_vertex_id;
+            auto second_id = this->_it->vertex_id;
+            if constexpr (type_traits::is_undirected_v<edge_type>)
+                if (second_id < first_id)
+                    std::swap(first_id, second_id);
+
+            const auto& first = this->_graph->_vertex(first_id);
+            const auto& second = this->_graph->_vertex(second_id);
+            if constexpr (type_traits::is_default_properties_type_v<edge_properties_type>)
+                return edge_type{first, second};
+            else
+                return edge_type{first, second, this->_it->properties};
+        }
+
+        gl_attr_force_inline edge_iterator& operator++() {
+            ++this->_it;
+            return *this;
+        }
+
+        gl_attr_force_inline edge_iterator operator++(int) {
+            edge_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] gl_attr_force_inline bool operator==(const edge_iterator& other) const {
+            return this->_it == other._it;
+        }
+
+    private:
+        const cow_graph* _graph = nullptr;
+        types::id_type _vertex_id = constants::initial_id;
+        typename adjacency_list_type::const_iterator _it{};
+    };
+
+private:
+    struct chunk {
+        std::vector<vertex_type> vertices;
+        std::vector<adjacency_list_type> adjacency_lists;
+    };
+
+    using chunk_table_type = std::vector<std::shared_ptr<chunk>>;
+
+    [[nodiscard]] static gl_attr_force_inline types::size_type _n_chunks(
+        const types::size_type n_vertices
+    ) {
+        return (n_vertices + chunk_size - constants::one) / chunk_size;
+    }
+
+    [[nodiscard]] static gl_attr_force_inline types::size_type _offset(
+        const types::id_type vertex_id
+    ) {
+        return vertex_id % chunk_size;
+    }
+
+    [[nodiscard]] static vertex_type _make_vertex(
+        const types::id_type vertex_id, const vertex_properties_type& properties
+    ) {
+        if constexpr (type_traits::is_default_properties_type_v<vertex_properties_type>)
+            return vertex_type{vertex_id};
+        else
+            return vertex_type{vertex_id, properties};
+    }
+
+    [[nodiscard]] static std::shared_ptr<chunk> _make_chunk() {
+        auto new_chunk = std::make_shared<chunk>();
+        new_chunk->vertices.reserve(chunk_size);
+        new_chunk->adjacency_lists.reserve(chunk_size);
+        return new_chunk;
+    }
+
+    // the vertex descriptors cannot be copied, so they are recreated with the same ids
+    [[nodiscard]] static std::shared_ptr<chunk> _copy_chunk(const chunk& source) {
+        auto new_chunk = _make_chunk();
+        for (const auto& vertex : source.vertices)
+            new_chunk->vertices.push_back(_make_vertex(vertex.id(), vertex.properties));
+        new_chunk->adjacency_lists = source.adjacency_lists;
+        return new_chunk;
+    }
+
+    [[nodiscard]] static typename adjacency_list_type::iterator _find_entry(
+        adjacency_list_type& adjacency_list, const types::id_type vertex_id
+    ) {
+        return std::ranges::find(adjacency_list, vertex_id, &adjacency_entry::vertex_id);
+    }
+
+    static void _erase_entry(adjacency_list_type& adjacency_list, const types::id_type vertex_id) {
+        adjacency_list.erase(_find_entry(adjacency_list, vertex_id));
+    }
+
+    [[nodiscard]] gl_attr_force_inline const chunk& _chunk(const types::id_type vertex_id) const {
+        return *(*this->_chunks)[vertex_id / chunk_size];
+    }
+
+    [[nodiscard]] gl_attr_force_inline const vertex_type& _vertex(const types::id_type vertex_id
+    ) const {
+        return this->_chunk(vertex_id).vertices[_offset(vertex_id)];
+    }
+
+    [[nodiscard]] gl_attr_force_inline const adjacency_list_type& _adjacency_list(
+        const types::id_type vertex_id
+    ) const {
+        return this->_chunk(vertex_id).adjacency_lists[_offset(vertex_id)];
+    }
+
+    // returns the chunk table, detaching it from the other graphs if it is shared
+    chunk_table_type& _mutable_chunk_table() {
+        if (this->is_shared()) {
+            this->_chunks = std::make_shared<chunk_table_type>(*this->_chunks);
+        }
+        else {
+            // `use_count` is a relaxed load, so the fence is required to synchronize with
+            // the release of the chunk table by the graphs destroyed in other threads
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *this->_chunks;
+    }
+
+    // returns the chunk of the vertex, detaching it from the other graphs if it is shared
+    chunk& _mutable_chunk(const types::id_type vertex_id) {
+        auto& chunk_ptr = this->_mutable_chunk_table()[vertex_id / chunk_size];
+        if (chunk_ptr.use_count() > 1l)
+            chunk_ptr = _copy_chunk(*chunk_ptr);
+        else
+            std::atomic_thread_fence(std::memory_order_acquire);
+        return *chunk_ptr;
+    }
+
+    [[nodiscard]] gl_attr_force_inline adjacency_list_type& _mutable_adjacency_list(
+        const types::id_type vertex_id
+    ) {
+        return this->_mutable_chunk(vertex_id).adjacency_lists[_offset(vertex_id)];
+    }
+
+    const vertex_type& _add_vertex(const vertex_properties_type& properties) {
+        if (this->_n_vertices >= static_cast<types::size_type>(constants::invalid_id))
+            throw std::length_error(std::format(
+                "Cannot add a vertex to a graph with {} vertices (the vertex ids would overflow)",
+                this->_n_vertices
+            ));
+
+        const auto vertex_id = static_cast<types::id_type>(this->_n_vertices);
+        if (_offset(vertex_id) == constants::zero)
+            this->_mutable_chunk_table().push_back(_make_chunk());
+
+        auto& vertex_chunk = this->_mutable_chunk(vertex_id);
+        vertex_chunk.vertices.push_back(_make_vertex(vertex_id, properties));
+        vertex_chunk.adjacency_lists.emplace_back();
+
+        ++this->_n_vertices;
+        return vertex_chunk.vertices.back();
+    }
+
+    void _add_edge(
+        const types::id_type first_id,
+        const types::id_type second_id,
+        const edge_properties_type& properties
+    ) {
+        this->_verify_vertex_id(first_id);
+        this->_verify_vertex_id(second_id);
+
+        this->_mutable_adjacency_list(first_id).push_back(adjacency_entry{second_id, properties});
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            if (first_id != second_id)
+                this->_mutable_adjacency_list(second_id).push_back(
+                    adjacency_entry{first_id, properties}
+                );
+
+        ++this->_n_unique_edges;
+    }
+
+    gl_attr_force_inline void _verify_vertex_id(const types::id_type vertex_id) const {
+        if (not this->has_vertex(vertex_id))
+            throw std::out_of_range(std::format("Got invalid vertex id [{}]", vertex_id));
+    }
+
+    void _verify_edge(const types::id_type first_id, const types::id_type second_id) const {
+        if (not this->has_edge(first_id, second_id))
+            throw std::invalid_argument(
+                std::format("Got invalid edge [vertices = ({}, {})]", first_id, second_id)
+            );
+    }
+
+    std::shared_ptr<chunk_table_type> _chunks;
+    types::size_type _n_vertices = constants::default_size;
+    types::size_type _n_unique_edges = constants::default_size;
+};
+
+} // namespace gl::inline gl_id_type_namespace
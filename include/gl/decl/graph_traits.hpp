@@ -4,16 +4,19 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/types/type_traits.hpp"
 #include "impl_tags.hpp"
+#include "storage_tags.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 template <
     type_traits::c_edge_directional_tag EdgeDirectionalTag,
     type_traits::c_properties VertexProperties,
     type_traits::c_properties EdgeProperties,
-    type_traits::c_graph_impl_tag ImplTag>
+    type_traits::c_graph_impl_tag ImplTag,
+    type_traits::c_storage_tag StorageTag>
 struct graph_traits;
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -4,24 +4,136 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/edge_tags.hpp"
 #include "gl/types/type_traits.hpp"
+#include "gl/types/types.hpp"
 
-namespace gl {
+#include <algorithm>
+
+namespace gl::inline gl_id_type_namespace {
+
+namespace impl {
+
+/*
+An adjacency list option which makes directed graphs additionally maintain the lists
+    of incoming edges of each vertex.
+With this option the in-degree queries take constant time and the incoming edges of
+    a vertex can be accessed directly with the `in_edges` method.
+*/
+struct in_edge_index_t {};
+
+/*
+An adjacency list option which makes the graphs maintain the positions of each edge
+    in the adjacency (and in-edge) lists of its vertices.
+With this option the edges are removed in constant time by moving the last edge of a list
+    into the freed slot, so the order of the adjacent edges is not preserved on removal.
+*/
+struct edge_position_index_t {};
+
+/*
+An adjacency list option which makes the graphs keep the adjacency list of each vertex sorted
+    by the ids of the adjacent vertices.
+With this option the `has_edge` and `get_edge` queries use binary search and the common
+    neighbors of two vertices are found by intersecting their sorted adjacency lists.
+The option cannot be combined with the `edge_position_index_t` option.
+*/
+struct sorted_adjacency_t {};
+
+/*
+An adjacency list option which makes the graphs maintain a hash index of the neighbors
+    of each vertex whose degree reaches the given threshold.
+With this option the `has_edge` and `get_edge` queries for such vertices take constant time
+    (on average), while the vertices with lower degrees do not allocate any additional memory.
+*/
+template <types::size_type DegreeThreshold = 32ull>
+requires(DegreeThreshold > 0ull)
+struct neighbor_index_t {
+    static constexpr types::size_type degree_threshold = DegreeThreshold;
+};
+
+} // namespace impl
+
+namespace type_traits {
+
+template <typename T>
+struct is_neighbor_index_option : std::false_type {};
+
+template <types::size_type DegreeThreshold>
+struct is_neighbor_index_option<impl::neighbor_index_t<DegreeThreshold>> : std::true_type {};
+
+template <typename T>
+concept c_list_option =
+    c_one_of<T, impl::in_edge_index_t, impl::edge_position_index_t, impl::sorted_adjacency_t>
+    or is_neighbor_index_option<T>::value;
+
+} // namespace type_traits
 
 namespace impl {
 
-struct list_t;
+template <type_traits::c_list_option... Options>
+struct basic_list_t;
+
+using list_t = basic_list_t<>;
+using bidirectional_list_t = basic_list_t<in_edge_index_t>;
 
 struct matrix_t;
 
+struct bit_matrix_t;
+
+struct sparse_matrix_t;
+
+struct csr_t;
+
+struct compressed_t;
+
 } // namespace impl
 
 namespace type_traits {
 
 template <typename T>
-concept c_graph_impl_tag = c_one_of<T, impl::list_t, impl::matrix_t>;
+concept c_list_impl_tag = c_instantiation_of<T, impl::basic_list_t>;
+
+template <typename ImplTag, c_list_option Option>
+struct has_list_option : std::false_type {};
+
+template <c_list_option... Options, c_list_option Option>
+struct has_list_option<impl::basic_list_t<Options...>, Option>
+: std::bool_constant<c_one_of<Option, Options...>> {};
+
+template <typename ImplTag, c_list_option Option>
+constexpr inline bool has_list_option_v = has_list_option<ImplTag, Option>::value;
+
+template <typename ListOption>
+constexpr inline types::size_type list_option_degree_threshold_v = 0ull;
+
+template <types::size_type DegreeThreshold>
+constexpr inline types::size_type
+    list_option_degree_threshold_v<impl::neighbor_index_t<DegreeThreshold>> = DegreeThreshold;
+
+// the degree threshold of the neighbor index of a list graph (0 if the index is disabled)
+template <typename ImplTag>
+struct list_neighbor_index_threshold : std::integral_constant<types::size_type, 0ull> {};
+
+template <c_list_option... Options>
+struct list_neighbor_index_threshold<impl::basic_list_t<Options...>>
+: std::integral_constant<
+      types::size_type,
+      std::max({types::size_type{}, list_option_degree_threshold_v<Options>...})> {};
+
+template <typename ImplTag>
+constexpr inline types::size_type list_neighbor_index_threshold_v =
+    list_neighbor_index_threshold<ImplTag>::value;
+
+// the implementation tags of the immutable graph representations
+template <typename T>
+concept c_immutable_impl_tag = c_one_of<T, impl::csr_t, impl::compressed_t>;
+
+template <typename T>
+concept c_graph_impl_tag =
+    c_list_impl_tag<T> or c_one_of<T, impl::matrix_t, impl::bit_matrix_t, impl::sparse_matrix_t>
+    or c_immutable_impl_tag<T>;
 
 } // namespace type_traits
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -0,0 +1,29 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/types/type_traits.hpp"
+
+namespace gl::inline gl_id_type_namespace {
+
+namespace storage {
+
+struct heap_t;
+
+struct arena_t;
+
+struct pmr_t;
+
+} // namespace storage
+
+namespace type_traits {
+
+template <typename T>
+concept c_storage_tag = c_one_of<T, storage::heap_t, storage::arena_t, storage::pmr_t>;
+
+} // namespace type_traits
+
+} // namespace gl::inline gl_id_type_namespace
@@ -5,21 +5,39 @@
 #pragma once
 
 #include "edge_tags.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "io/format.hpp"
 #include "vertex_descriptor.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
+
+namespace detail {
+
+// the edge properties can be modified through the const edge references returned by the graphs
+template <typename Properties>
+struct edge_properties_holder {
+    [[no_unique_address]] mutable Properties properties{};
+};
+
+// the const-qualified properties (e.g. the properties of the frozen graphs' edges) are read-only
+template <typename Properties>
+struct edge_properties_holder<const Properties> {
+    [[no_unique_address]] const Properties properties{};
+};
+
+} // namespace detail
 
 template <
     type_traits::c_instantiation_of<vertex_descriptor> VertexType,
     type_traits::c_edge_directional_tag DirectionalTag = directed_t,
-    type_traits::c_properties Properties = types::empty_properties>
-class edge_descriptor final {
+    typename Properties = types::empty_properties>
+requires(type_traits::c_properties<std::remove_const_t<Properties>>)
+class edge_descriptor final : public detail::edge_properties_holder<Properties> {
 public:
     using type = edge_descriptor<VertexType, DirectionalTag, Properties>;
     using vertex_type = VertexType;
     using directional_tag = DirectionalTag;
-    using properties_type = Properties;
+    using properties_type = std::remove_const_t<Properties>;
 
     friend directional_tag;
 
@@ -37,7 +55,7 @@ public:
         const vertex_type& first, const vertex_type& second, const properties_type& properties
     )
     requires(not type_traits::is_default_properties_type_v<properties_type>)
-    : _vertices(first, second), properties(properties) {}
+    : detail::edge_properties_holder<Properties>{properties}, _vertices(first, second) {}
 
     edge_descriptor(edge_descriptor&&) = default;
     edge_descriptor& operator=(edge_descriptor&&) = default;
@@ -124,8 +142,6 @@ public:
         return this->_vertices.first == this->_vertices.second;
     }
 
-    [[no_unique_address]] mutable properties_type properties{};
-
     friend inline std::ostream& operator<<(std::ostream& os, const edge_descriptor& edge) {
         edge._write(os);
         return os;
@@ -202,4 +218,4 @@ template <
     type_traits::c_properties Properties = types::empty_properties>
 using undirected_edge = edge_descriptor<VertexType, undirected_t, Properties>;
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
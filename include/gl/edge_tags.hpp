@@ -5,10 +5,11 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "types/properties.hpp"
 #include "types/type_traits.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 struct directed_t;
 
@@ -27,7 +28,8 @@ class vertex_descriptor;
 template <
     type_traits::c_instantiation_of<vertex_descriptor> VertexType,
     type_traits::c_edge_directional_tag EdgeTag,
-    type_traits::c_properties Properties>
+    typename Properties>
+requires(type_traits::c_properties<std::remove_const_t<Properties>>)
 class edge_descriptor;
 
 namespace type_traits {
@@ -159,4 +161,4 @@ template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
 
 } // namespace detail
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
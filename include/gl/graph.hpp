@@ -5,50 +5,101 @@
 #pragma once
 
 #include "constants.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "graph_traits.hpp"
 #include "impl/impl_tags.hpp"
 #include "io/stream_options_manipulator.hpp"
 #include "types/iterator_range.hpp"
+#include "types/non_null_iterator.hpp"
+#include "util/compact.hpp"
+#include "util/sorted_intersection.hpp"
 
-#include <set>
+#include <algorithm>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
-namespace gl {
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+#include <execution>
+#endif
+
+namespace gl::inline gl_id_type_namespace {
 
 template <type_traits::c_instantiation_of<graph_traits> GraphTraits = graph_traits<>>
 class graph final {
+    template <type_traits::c_instantiation_of<graph_traits> OtherGraphTraits>
+    friend class graph;
+
 public:
     using traits_type = GraphTraits;
 
     using implementation_tag = typename traits_type::implementation_tag;
     using implementation_type = typename implementation_tag::template type<traits_type>;
 
+    using storage_tag = typename traits_type::storage_tag;
+
     using vertex_type = typename traits_type::vertex_type;
     using vertex_ptr_type = typename traits_type::vertex_ptr_type;
+    using vertex_storage_type = typename traits_type::vertex_storage_type;
     using vertex_properties_type = typename traits_type::vertex_properties_type;
 
-    using vetex_list_type = std::vector<vertex_ptr_type>;
-    using vertex_iterator_type =
-        types::dereferencing_iterator<typename vetex_list_type::const_iterator>;
+    // the allocator of the vertex list and the containers of the graph's implementation
+    using allocator_type = typename traits_type::allocator_type;
+
+    // whether the vertex properties are stored column-wise (see `types::columnar`)
+    static constexpr bool has_vertex_property_column =
+        type_traits::c_column_property_ref<typename vertex_type::properties_type>;
+
+    using vetex_list_type =
+        std::vector<vertex_ptr_type, typename storage_tag::template allocator_type<vertex_ptr_type>>;
+    using vertex_iterator_type = types::dereferencing_iterator<
+        types::non_null_iterator<typename vetex_list_type::const_iterator>>;
 
     // TODO: reverese iterators should be available for bidirectional ranges
 
     using edge_type = typename traits_type::edge_type;
     using edge_ptr_type = typename traits_type::edge_ptr_type;
+    using edge_storage_type = typename traits_type::edge_storage_type;
     using edge_directional_tag = typename traits_type::edge_directional_tag;
     using edge_properties_type = typename traits_type::edge_properties_type;
 
     using edge_list_type = typename implementation_type::edge_list_type;
     using edge_iterator_type = typename implementation_type::edge_iterator_type;
 
+    using frozen_graph_type =
+        graph<typename traits_type::template rebind_implementation<impl::csr_t>>;
+    using thawed_graph_type =
+        graph<typename traits_type::template rebind_implementation<impl::list_t>>;
+    using compressed_graph_type =
+        graph<typename traits_type::template rebind_implementation<impl::compressed_t>>;
+
     graph(const graph&) = delete;
     graph& operator=(const graph&) = delete;
 
     graph() = default;
 
-    graph(const types::size_type n_vertices) : _impl(n_vertices) {
-        this->_vertices.reserve(n_vertices);
-        for (auto vertex_id = constants::initial_id; vertex_id < n_vertices; ++vertex_id)
-            this->_vertices.push_back(detail::make_vertex<vertex_type>(vertex_id));
+    graph(const types::size_type n_vertices)
+    : _impl(_verify_n_new_vertices(constants::zero, n_vertices)) {
+        this->_init_vertices(n_vertices);
+    }
+
+    explicit graph(std::pmr::memory_resource* resource)
+    requires(std::same_as<storage_tag, storage::pmr_t>)
+    : _vertex_storage(resource),
+      _edge_storage(resource),
+      _vertices(resource),
+      _impl(allocator_type{resource}) {}
+
+    graph(const types::size_type n_vertices, std::pmr::memory_resource* resource)
+    requires(std::same_as<storage_tag, storage::pmr_t>)
+    : _vertex_storage(resource),
+      _edge_storage(resource),
+      _vertices(resource),
+      _impl(_verify_n_new_vertices(constants::zero, n_vertices), allocator_type{resource}) {
+        this->_init_vertices(n_vertices);
     }
 
     graph(graph&&) = default;
@@ -58,10 +109,22 @@ public:
 
     // --- general methods ---
 
+    // the memory resource from which the vertices and edges of the graph are allocated
+    [[nodiscard]] gl_attr_force_inline std::pmr::memory_resource* memory_resource() const
+    requires(std::same_as<storage_tag, storage::pmr_t>)
+    {
+        return this->_vertex_storage.resource();
+    }
+
+    // the number of vertex slots (the removed vertices are counted until `compact` is called)
     [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
         return this->_vertices.size();
     }
 
+    [[nodiscard]] gl_attr_force_inline types::size_type n_removed_vertices() const {
+        return this->_n_removed_vertices;
+    }
+
     [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
         return this->_impl.n_unique_edges();
     }
@@ -70,12 +133,16 @@ public:
 
     [[nodiscard]] gl_attr_force_inline types::iterator_range<vertex_iterator_type> vertices(
     ) const {
-        return make_iterator_range(deref_cbegin(this->_vertices), deref_cend(this->_vertices));
+        return make_iterator_range(
+            types::dereferencing_iterator(non_null_cbegin(this->_vertices)),
+            types::dereferencing_iterator(non_null_cend(this->_vertices))
+        );
     }
 
-    [[nodiscard]] gl_attr_force_inline std::ranges::iota_view<types::id_type, types::id_type>
-    vertex_ids() const {
-        return std::views::iota(constants::initial_id, this->n_vertices());
+    [[nodiscard]] gl_attr_force_inline auto vertex_ids() const {
+        return std::views::transform(this->vertices(), [](const vertex_type& vertex) {
+            return vertex.id();
+        });
     }
 
     // clang-format off
@@ -91,7 +158,7 @@ public:
     // clang-format on
 
     [[nodiscard]] gl_attr_force_inline bool has_vertex(const types::id_type vertex_id) const {
-        return vertex_id < this->n_vertices();
+        return vertex_id < this->n_vertices() and this->_vertices[vertex_id] != nullptr;
     }
 
     [[nodiscard]] gl_attr_force_inline bool has_vertex(const vertex_type& vertex) const {
@@ -99,41 +166,56 @@ public:
     }
 
     const vertex_type& add_vertex() {
+        this->_verify_n_new_vertices(this->n_vertices(), constants::one);
         this->_impl.add_vertex();
-        this->_vertices.push_back(detail::make_vertex<vertex_type>(this->n_vertices()));
+        this->_vertices.push_back(this->_make_vertex(this->_next_vertex_id()));
         return *this->_vertices.back();
     }
 
     const vertex_type& add_vertex(const vertex_properties_type& properties)
     requires(not type_traits::is_default_properties_type_v<vertex_properties_type>)
     {
+        this->_verify_n_new_vertices(this->n_vertices(), constants::one);
         this->_impl.add_vertex();
-        this->_vertices.push_back(detail::make_vertex<vertex_type>(this->n_vertices(), properties));
+        this->_vertices.push_back(this->_make_vertex(this->_next_vertex_id(), properties));
         return *this->_vertices.back();
     }
 
     void add_vertices(const types::size_type n) {
+        this->_verify_n_new_vertices(this->n_vertices(), n);
         this->_impl.add_vertices(n);
-        this->_vertices.reserve(this->n_vertices() + n);
+        this->_reserve_vertices(n);
 
         for (types::size_type _ = constants::begin_idx; _ < n; ++_)
-            this->_vertices.push_back(detail::make_vertex<vertex_type>(this->n_vertices()));
+            this->_vertices.push_back(this->_make_vertex(this->_next_vertex_id()));
     }
 
     template <type_traits::c_sized_range_of<vertex_properties_type> VertexPropertiesRange>
     void add_vertices_with(const VertexPropertiesRange& properties_range) {
         const auto n = std::ranges::size(properties_range);
 
+        this->_verify_n_new_vertices(this->n_vertices(), n);
         this->_impl.add_vertices(n);
-        this->_vertices.reserve(this->n_vertices() + n);
+        this->_reserve_vertices(n);
 
         for (const auto& properties : properties_range)
-            this->_vertices.push_back(
-                detail::make_vertex<vertex_type>(this->n_vertices(), properties)
-            );
+            this->_vertices.push_back(this->_make_vertex(this->_next_vertex_id(), properties));
     }
 
-    gl_attr_force_inline void remove_vertex(const types::size_type vertex_id) {
+    /*
+    Available for the graphs with columnar vertex properties: returns the column of the vertex
+        properties indexed by the vertex ids, which can be used for bulk per-vertex passes.
+    The values in the removed vertex slots (pending compaction) are unspecified.
+    */
+    [[nodiscard]] std::span<vertex_properties_type> vertex_property_column() const
+    requires(has_vertex_property_column)
+    {
+        if (this->_vertex_property_column == nullptr)
+            return {};
+        return *this->_vertex_property_column;
+    }
+
+    gl_attr_force_inline void remove_vertex(const types::id_type vertex_id) {
         this->_remove_vertex_impl(this->get_vertex(vertex_id));
     }
 
@@ -144,36 +226,75 @@ public:
 
     template <type_traits::c_sized_range_of<types::id_type> IdRange>
     void remove_vertices_from(const IdRange& vertex_id_range) {
-        // sorts the ids in a descending order and removes duplicate ids
-        std::set<types::id_type, std::greater<types::id_type>> vertex_id_set(
-            std::ranges::begin(vertex_id_range), std::ranges::end(vertex_id_range)
-        );
+        // marks the vertices to remove (ignoring duplicate ids)
+        std::vector<bool> removed(this->n_vertices(), false);
+        for (const auto vertex_id : vertex_id_range) {
+            this->_verify_vertex_id(vertex_id);
+            removed[vertex_id] = true;
+        }
 
-        // TODO: optimize
-        for (const auto vertex_id : vertex_id_set)
-            this->_remove_vertex_impl(this->get_vertex(vertex_id));
+        this->_remove_vertices_impl(removed);
     }
 
     template <type_traits::c_sized_range_of<types::const_ref_wrap<vertex_type>> VertexRefRange>
     void remove_vertices_from(const VertexRefRange& vertex_ref_range) {
-        // TODO [C++26]: replace with std::greater
-        struct vertex_ref_greater_comparator {
-            [[nodiscard]] bool operator()(
-                const types::const_ref_wrap<vertex_type>& lhs,
-                const types::const_ref_wrap<vertex_type>& rhs
-            ) const {
-                return lhs.get() > rhs.get();
-            }
-        };
+        // marks the vertices to remove (ignoring duplicate vertex references)
+        std::vector<bool> removed(this->n_vertices(), false);
+        for (const auto& vertex_ref : vertex_ref_range) {
+            this->_verify_vertex(vertex_ref.get());
+            removed[vertex_ref.get().id()] = true;
+        }
 
-        // sorts the ids in a descending order and removes duplicate ids
-        std::set<types::const_ref_wrap<vertex_type>, vertex_ref_greater_comparator> vertex_ref_set(
-            std::ranges::begin(vertex_ref_range), std::ranges::end(vertex_ref_range)
-        );
+        this->_remove_vertices_impl(removed);
+    }
+
+    /*
+    In the deferred vertex removal mode the removed vertices only leave tombstones:
+        their incident edges are removed, but the ids of the remaining vertices do not change.
+    The removed vertex slots are skipped by the vertex iteration methods and are released
+        (and the remaining vertices are renumbered) with the `compact` method.
+    NOTE: The incoming edges of a vertex of a directed adjacency list graph are found directly
+        only with the `impl::in_edge_index_t` option - otherwise each removal scans all
+        adjacency lists (`remove_vertices_from` scans them once for all removed vertices).
+    */
+
+    void set_deferred_vertex_removal(const bool enabled) {
+        if (not enabled and this->_n_removed_vertices > constants::zero)
+            throw std::logic_error(std::format(
+                "Cannot disable the deferred vertex removal with {} removed vertices pending "
+                "compaction",
+                this->_n_removed_vertices
+            ));
+
+        this->_deferred_vertex_removal = enabled;
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool deferred_vertex_removal() const {
+        return this->_deferred_vertex_removal;
+    }
+
+    // releases the removed vertex slots and returns the old to new vertex id mapping
+    // (the ids of the removed vertices are mapped to `constants::invalid_id`)
+    std::vector<types::id_type> compact()
+    requires(not type_traits::c_immutable_impl_tag<implementation_tag>)
+    {
+        std::vector<bool> removed(this->n_vertices(), false);
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+             ++vertex_id)
+            removed[vertex_id] = this->_vertices[vertex_id] == nullptr;
+
+        auto new_ids = util::compacted_ids(removed);
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+             ++vertex_id)
+            if (removed[vertex_id])
+                new_ids[vertex_id] = constants::invalid_id;
+
+        if (this->_n_removed_vertices > constants::zero) {
+            this->_compact_vertices(removed);
+            this->_n_removed_vertices = constants::default_size;
+        }
 
-        // TODO: optimize
-        for (const auto& vertex_ref : vertex_ref_set)
-            this->_remove_vertex_impl(vertex_ref.get());
+        return new_ids;
     }
 
     [[nodiscard]] gl_attr_force_inline types::size_type in_degree(const vertex_type& vertex) const {
@@ -227,14 +348,17 @@ public:
     // clang-format off
     // gl_attr_force_inline misplacement
 
-    const edge_type& add_edge(
+    /*
+    The edges added to the representations which do not store the edge descriptors
+        (the bit matrix) are returned by value, otherwise a reference to the stored edge
+        is returned.
+    */
+    decltype(auto) add_edge(
         const types::id_type first_id, const types::id_type second_id
     ) {
         this->_verify_vertex_id(first_id);
         this->_verify_vertex_id(second_id);
-        return this->_impl.add_edge(
-            detail::make_edge<edge_type>(this->get_vertex(first_id), this->get_vertex(second_id))
-        );
+        return this->_add_edge_impl(this->get_vertex(first_id), this->get_vertex(second_id));
     }
 
     const edge_type& add_edge(
@@ -246,17 +370,17 @@ public:
     {
         this->_verify_vertex_id(first_id);
         this->_verify_vertex_id(second_id);
-        return this->_impl.add_edge(detail::make_edge<edge_type>(
+        return this->_impl.add_edge(this->_edge_storage.make(
             this->get_vertex(first_id), this->get_vertex(second_id), properties
         ));
     }
 
     // clang-format on
 
-    const edge_type& add_edge(const vertex_type& first, const vertex_type& second) {
+    decltype(auto) add_edge(const vertex_type& first, const vertex_type& second) {
         this->_verify_vertex(first);
         this->_verify_vertex(second);
-        return this->_impl.add_edge(detail::make_edge<edge_type>(first, second));
+        return this->_add_edge_impl(first, second);
     }
 
     const edge_type& add_edge(
@@ -266,7 +390,7 @@ public:
     {
         this->_verify_vertex(first);
         this->_verify_vertex(second);
-        return this->_impl.add_edge(detail::make_edge<edge_type>(first, second, properties));
+        return this->_impl.add_edge(this->_edge_storage.make(first, second, properties));
     }
 
     template <type_traits::c_sized_range_of<types::id_type> IdRange>
@@ -275,9 +399,10 @@ public:
 
         std::vector<edge_ptr_type> new_edges;
         new_edges.reserve(std::ranges::size(target_id_range));
+        this->_edge_storage.reserve(std::ranges::size(target_id_range));
 
         for (const auto target_id : target_id_range) {
-            new_edges.push_back(detail::make_edge<edge_type>(source, this->get_vertex(target_id)));
+            new_edges.push_back(this->_edge_storage.make(source, this->get_vertex(target_id)));
         }
         this->_impl.add_edges_from(source_id, std::move(new_edges));
     }
@@ -288,15 +413,149 @@ public:
 
         std::vector<edge_ptr_type> new_edges;
         new_edges.reserve(std::ranges::size(target_range));
+        this->_edge_storage.reserve(std::ranges::size(target_range));
 
         for (const auto& target_ref : target_range) {
             const auto& target = target_ref.get();
             this->_verify_vertex(target);
-            new_edges.push_back(detail::make_edge<edge_type>(source, target));
+            new_edges.push_back(this->_edge_storage.make(source, target));
         }
         this->_impl.add_edges_from(source.id(), std::move(new_edges));
     }
 
+    /*
+    Bulk edge insertion methods: the degrees of the vertices are counted in a single pass
+        over the given edges, so that each adjacency list is grown (at most) once.
+    All vertex ids are verified before the graph is modified.
+    */
+
+    template <type_traits::c_range_of<types::homogeneous_pair<types::id_type>> IdPairRange>
+    void add_edges(const IdPairRange& id_pair_range) {
+        this->_add_edges_impl(id_pair_range, [this](const auto& id_pair) {
+            const auto& [first_id, second_id] = id_pair;
+            return this->_edge_storage.make(
+                this->get_vertex(first_id), this->get_vertex(second_id)
+            );
+        });
+    }
+
+    template <
+        type_traits::c_range_of<std::tuple<types::id_type, types::id_type, edge_properties_type>>
+            EdgeRange>
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    void add_edges(const EdgeRange& edge_range) {
+        this->_add_edges_impl(edge_range, [this](const auto& edge_tuple) {
+            const auto& [first_id, second_id, properties] = edge_tuple;
+            return this->_edge_storage.make(
+                this->get_vertex(first_id), this->get_vertex(second_id), properties
+            );
+        });
+    }
+
+    template <type_traits::c_range_of<
+        std::tuple<types::id_type, types::id_type, typename edge_properties_type::weight_type>>
+                  WeightedEdgeRange>
+    requires(type_traits::c_weight_properties_type<edge_properties_type>)
+    void add_edges(const WeightedEdgeRange& weighted_edge_range) {
+        this->_add_edges_impl(weighted_edge_range, [this](const auto& edge_tuple) {
+            const auto& [first_id, second_id, weight] = edge_tuple;
+            edge_properties_type properties{};
+            properties.weight = weight;
+            return this->_edge_storage.make(
+                this->get_vertex(first_id), this->get_vertex(second_id), properties
+            );
+        });
+    }
+
+    /*
+    Zipped bulk edge insertion methods: the i-th edge is assigned the i-th weight/properties.
+    The sizes of the ranges are verified before the graph is modified.
+    */
+
+    template <type_traits::c_random_access_range_of<typename edge_properties_type::weight_type>
+                  WeightRange>
+    requires(type_traits::c_weight_properties_type<edge_properties_type>)
+    void add_edges(
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const WeightRange& weights
+    ) {
+        _verify_edge_data_size("weights", std::ranges::size(weights), id_pairs.size());
+        this->_add_edges_impl(id_pairs, this->_weighted_edge_maker(), std::ranges::begin(weights));
+    }
+
+    template <type_traits::c_random_access_range_of<edge_properties_type> PropertiesRange>
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    void add_edges(
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const PropertiesRange& properties_range
+    ) {
+        _verify_edge_data_size(
+            "edge properties", std::ranges::size(properties_range), id_pairs.size()
+        );
+        this->_add_edges_impl(
+            id_pairs, this->_edge_with_properties_maker(), std::ranges::begin(properties_range)
+        );
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    /*
+    Parallel bulk edge insertion methods: the edges are allocated and inserted into
+        the adjacency structure using the given execution policy.
+    The list representations count the degree histogram of the new edges, grow each list once
+        and scatter the edges into the new slots concurrently (without the edge position and
+        neighbor index options); the other representations insert the edges sequentially.
+    */
+
+    template <type_traits::c_execution_policy ExecutionPolicy>
+    void add_edges(
+        ExecutionPolicy&& policy, std::span<const types::homogeneous_pair<types::id_type>> id_pairs
+    ) {
+        this->_add_edges_impl(policy, id_pairs, [this](const auto& id_pair) {
+            return this->_edge_storage.make(
+                *this->_vertices[id_pair.first], *this->_vertices[id_pair.second]
+            );
+        });
+    }
+
+    // the i-th edge is assigned the i-th weight
+    template <
+        type_traits::c_execution_policy ExecutionPolicy,
+        type_traits::c_random_access_range_of<typename edge_properties_type::weight_type>
+            WeightRange>
+    requires(type_traits::c_weight_properties_type<edge_properties_type>)
+    void add_edges(
+        ExecutionPolicy&& policy,
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const WeightRange& weights
+    ) {
+        _verify_edge_data_size("weights", std::ranges::size(weights), id_pairs.size());
+        this->_add_edges_impl(
+            policy, id_pairs, this->_weighted_edge_maker(), std::ranges::begin(weights)
+        );
+    }
+
+    // the i-th edge is assigned the i-th properties
+    template <
+        type_traits::c_execution_policy ExecutionPolicy,
+        type_traits::c_random_access_range_of<edge_properties_type> PropertiesRange>
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    void add_edges(
+        ExecutionPolicy&& policy,
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const PropertiesRange& properties_range
+    ) {
+        _verify_edge_data_size(
+            "edge properties", std::ranges::size(properties_range), id_pairs.size()
+        );
+        this->_add_edges_impl(
+            policy,
+            id_pairs,
+            this->_edge_with_properties_maker(),
+            std::ranges::begin(properties_range)
+        );
+    }
+#endif
+
     [[nodiscard]] gl_attr_force_inline bool has_edge(
         const types::id_type first_id, const types::id_type second_id
     ) const {
@@ -334,7 +593,8 @@ public:
     ) const {
         using edge_ref_set = std::vector<types::const_ref_wrap<edge_type>>;
 
-        if constexpr (std::same_as<implementation_tag, impl::list_t>) {
+        if constexpr (type_traits::c_list_impl_tag<implementation_tag>
+                      or type_traits::c_immutable_impl_tag<implementation_tag>) {
             return this->_impl.get_edges(first_id, second_id);
         }
         else {
@@ -375,6 +635,68 @@ public:
         return this->_impl.adjacent_edges(vertex.id());
     }
 
+    /*
+    Available for undirected list graphs (for which the incoming edges are the adjacent edges)
+        and for directed list graphs with the `impl::in_edge_index_t` option.
+    */
+
+    [[nodiscard]] inline auto in_edges(const types::id_type vertex_id) const
+    requires(type_traits::c_list_impl_tag<implementation_tag> and implementation_type::has_in_edges)
+    {
+        this->_verify_vertex_id(vertex_id);
+        return this->_impl.in_edges(vertex_id);
+    }
+
+    [[nodiscard]] inline auto in_edges(const vertex_type& vertex) const
+    requires(type_traits::c_list_impl_tag<implementation_tag> and implementation_type::has_in_edges)
+    {
+        this->_verify_vertex(vertex);
+        return this->_impl.in_edges(vertex.id());
+    }
+
+    /*
+    Available for csr (frozen) graphs: the ids of the adjacent vertices and the weights of
+        the adjacent edges of a vertex stored in the flat columns of the representation
+        (in the order of the adjacent edges of the vertex).
+    The weight column is filled when the graph is built, so it does not reflect the changes
+        of the edge weights made through the `properties` member of the edges.
+    */
+
+    [[nodiscard]] inline std::span<const types::id_type> adjacent_vertex_ids(
+        const types::id_type vertex_id
+    ) const
+    requires(std::same_as<implementation_tag, impl::csr_t>)
+    {
+        this->_verify_vertex_id(vertex_id);
+        return this->_impl.adjacent_vertex_ids(vertex_id);
+    }
+
+    [[nodiscard]] inline auto adjacent_weights(const types::id_type vertex_id) const
+    requires(
+        std::same_as<implementation_tag, impl::csr_t> and implementation_type::has_weight_column
+    )
+    {
+        this->_verify_vertex_id(vertex_id);
+        return this->_impl.adjacent_weights(vertex_id);
+    }
+
+    // returns the sorted ids of the vertices adjacent to both given vertices
+    [[nodiscard]] std::vector<types::id_type> common_neighbors(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        this->_verify_vertex_id(first_id);
+        this->_verify_vertex_id(second_id);
+        return this->_common_neighbors_impl(first_id, second_id);
+    }
+
+    [[nodiscard]] std::vector<types::id_type> common_neighbors(
+        const vertex_type& first, const vertex_type& second
+    ) const {
+        this->_verify_vertex(first);
+        this->_verify_vertex(second);
+        return this->_common_neighbors_impl(first.id(), second.id());
+    }
+
     // --- incidence methods ---
 
     [[nodiscard]] bool are_incident(const types::id_type first_id, const types::id_type second_id)
@@ -424,6 +746,91 @@ public:
         return edge_1.is_incident_with(edge_2.first()) or edge_1.is_incident_with(edge_2.second());
     }
 
+    // --- conversion methods ---
+
+    /*
+    Creates a deep copy of the graph: the vertices (with their ids and properties), including
+        the removed vertex slots, and the edges (with their properties) are copied.
+    The adjacency lists are copied directly with the order of the adjacent edges preserved,
+        the other representations are rebuilt with a single bulk insertion.
+    */
+    [[nodiscard]] graph clone() const {
+        if constexpr (type_traits::c_immutable_impl_tag<implementation_tag>) {
+            return this->_immutable_copy<graph>();
+        }
+        else {
+            auto target = this->_empty_like<graph>();
+            target._copy_vertices(*this);
+
+            const auto copy_edge = [&target](const edge_type& edge) {
+                return target._make_edge_copy(edge);
+            };
+
+            if constexpr (std::constructible_from<
+                              implementation_type,
+                              const implementation_type&,
+                              decltype(copy_edge)>) {
+                target._impl = implementation_type(this->_impl, copy_edge, target._allocator());
+            }
+            else {
+                target._impl.add_vertices(this->n_vertices());
+
+                std::vector<edge_ptr_type> edges;
+                edges.reserve(this->n_unique_edges());
+                target._edge_storage.reserve(this->n_unique_edges());
+
+                for (const auto vertex_id : this->vertex_ids()) {
+                    for (const auto& edge : this->_impl.adjacent_edges(vertex_id)) {
+                        if constexpr (type_traits::is_undirected_v<edge_type>)
+                            if (edge.first_id() != vertex_id)
+                                continue; // the edge will be copied for its first vertex
+                        edges.push_back(copy_edge(edge));
+                    }
+                }
+
+                target._impl.add_edges(std::move(edges));
+            }
+
+            return target;
+        }
+    }
+
+    [[nodiscard]] gl_attr_force_inline frozen_graph_type freeze() const
+    requires(not type_traits::c_immutable_impl_tag<implementation_tag>)
+    {
+        return this->_immutable_copy<frozen_graph_type>();
+    }
+
+    [[nodiscard]] gl_attr_force_inline compressed_graph_type compress() const
+    requires(not type_traits::c_immutable_impl_tag<implementation_tag>
+             and type_traits::is_default_properties_type_v<edge_properties_type>)
+    {
+        return this->_immutable_copy<compressed_graph_type>();
+    }
+
+    [[nodiscard]] thawed_graph_type thaw() const
+    requires(type_traits::c_immutable_impl_tag<implementation_tag>)
+    {
+        auto thawed = this->_empty_like<thawed_graph_type>();
+        thawed._impl.add_vertices(this->n_vertices());
+        thawed._copy_vertices(*this);
+
+        for (const auto vertex_id : this->vertex_ids()) {
+            for (const auto& edge : this->_impl.adjacent_edges(vertex_id)) {
+                if constexpr (type_traits::is_undirected_v<edge_type>)
+                    if (edge.first_id() != vertex_id)
+                        continue; // the edge will be added for its first vertex
+
+                if constexpr (type_traits::is_default_properties_type_v<edge_properties_type>)
+                    thawed.add_edge(edge.first_id(), edge.second_id());
+                else
+                    thawed.add_edge(edge.first_id(), edge.second_id(), edge.properties);
+            }
+        }
+
+        return thawed;
+    }
+
     friend std::ostream& operator<<(std::ostream& os, const graph& g) {
         if (io::is_option_set(os, io::graph_option::gsf)) {
             g._gsf_write(os);
@@ -444,6 +851,13 @@ public:
     }
 
 private:
+    using vertex_property_ref_type = typename vertex_type::properties_type;
+    using vertex_property_column_type = types::property_column<vertex_properties_type>;
+    using vertex_property_column_ptr_type = std::conditional_t<
+        has_vertex_property_column,
+        std::unique_ptr<vertex_property_column_type>,
+        types::empty_properties>;
+
     [[nodiscard]] static constexpr std::string _directed_type_str() {
         return type_traits::is_directed_v<edge_type> ? "directed" : "undirected";
     }
@@ -480,8 +894,162 @@ private:
 
     // --- vertex methods ---
 
+    [[nodiscard]] gl_attr_force_inline types::id_type _next_vertex_id() const {
+        return static_cast<types::id_type>(this->n_vertices());
+    }
+
+    void _init_vertices(const types::size_type n_vertices) {
+        this->_reserve_vertices(n_vertices);
+        for (types::size_type idx = constants::begin_idx; idx < n_vertices; ++idx)
+            this->_vertices.push_back(this->_make_vertex(static_cast<types::id_type>(idx)));
+    }
+
+    /*
+    The ids of the vertices must be lower than `constants::invalid_id`, so the number of vertices
+        cannot exceed its value (which is reachable with `GL_CONFIG_ID_TYPE_32`).
+    Returns the number of the new vertices so that it can be verified in a member initializer.
+    */
+    static types::size_type _verify_n_new_vertices(
+        const types::size_type n_vertices, const types::size_type n_new_vertices
+    ) {
+        constexpr auto max_n_vertices = static_cast<types::size_type>(constants::invalid_id);
+        if (n_new_vertices > max_n_vertices - n_vertices)
+            throw std::length_error(std::format(
+                "Cannot add {} vertices to a graph with {} vertices (the maximum number of "
+                "vertices is {})",
+                n_new_vertices,
+                n_vertices,
+                max_n_vertices
+            ));
+        return n_new_vertices;
+    }
+
+    void _reserve_vertices(const types::size_type n) {
+        this->_vertices.reserve(this->n_vertices() + n);
+        this->_vertex_storage.reserve(n);
+        if constexpr (has_vertex_property_column)
+            this->_property_column().reserve(this->n_vertices() + n);
+    }
+
+    // the vertex properties of the columnar graphs are stored in the slot of the vertex's id
+    [[nodiscard]] vertex_ptr_type _make_vertex(const types::id_type vertex_id) {
+        if constexpr (has_vertex_property_column) {
+            auto& column = this->_property_column();
+            column.emplace_back();
+            return this->_vertex_storage.make(
+                vertex_id, vertex_property_ref_type{column, vertex_id}
+            );
+        }
+        else {
+            return this->_vertex_storage.make(vertex_id);
+        }
+    }
+
+    [[nodiscard]] vertex_ptr_type _make_vertex(
+        const types::id_type vertex_id, const vertex_properties_type& properties
+    ) {
+        if constexpr (has_vertex_property_column) {
+            auto& column = this->_property_column();
+            column.push_back(properties);
+            return this->_vertex_storage.make(
+                vertex_id, vertex_property_ref_type{column, vertex_id}
+            );
+        }
+        else {
+            return this->_vertex_storage.make(vertex_id, properties);
+        }
+    }
+
+    // the column is allocated separately so that its address does not change when
+    // the graph is moved (the vertex properties reference the column)
+    [[nodiscard]] vertex_property_column_type& _property_column()
+    requires(has_vertex_property_column)
+    {
+        if (this->_vertex_property_column == nullptr) {
+            std::pmr::memory_resource* resource = std::pmr::new_delete_resource();
+            if constexpr (std::same_as<storage_tag, storage::pmr_t>)
+                resource = this->memory_resource();
+            this->_vertex_property_column = std::make_unique<vertex_property_column_type>(resource);
+        }
+        return *this->_vertex_property_column;
+    }
+
+    [[nodiscard]] gl_attr_force_inline allocator_type _allocator() const {
+        if constexpr (std::same_as<storage_tag, storage::pmr_t>)
+            return allocator_type{this->memory_resource()};
+        else
+            return allocator_type{};
+    }
+
+    // creates an empty graph of the target type which uses the same memory resource
+    template <type_traits::c_instantiation_of<graph> TargetGraphType>
+    [[nodiscard]] gl_attr_force_inline TargetGraphType _empty_like() const {
+        if constexpr (std::same_as<storage_tag, storage::pmr_t>)
+            return TargetGraphType{this->memory_resource()};
+        else
+            return TargetGraphType{};
+    }
+
+    // builds an immutable graph from the copies of the vertices and edges of the graph
+    template <type_traits::c_instantiation_of<graph> TargetGraphType>
+    [[nodiscard]] TargetGraphType _immutable_copy() const {
+        auto target = this->_empty_like<TargetGraphType>();
+        target._copy_vertices(*this);
+
+        target._impl = typename TargetGraphType::implementation_type(
+            this->_impl,
+            [&target](const types::id_type vertex_id) -> const vertex_type& {
+                return *target._vertices[vertex_id];
+            },
+            target._allocator()
+        );
+
+        return target;
+    }
+
+    // creates a copy of an edge of another graph bound to the vertices of this graph
+    [[nodiscard]] edge_ptr_type _make_edge_copy(const edge_type& edge) {
+        const auto& first = *this->_vertices[edge.first_id()];
+        const auto& second = *this->_vertices[edge.second_id()];
+
+        if constexpr (type_traits::is_default_properties_type_v<edge_properties_type>)
+            return this->_edge_storage.make(first, second);
+        else
+            return this->_edge_storage.make(first, second, edge.properties);
+    }
+
+    template <type_traits::c_instantiation_of<graph> SourceGraphType>
+    void _copy_vertices(const SourceGraphType& source) {
+        this->_reserve_vertices(source.n_vertices());
+
+        // the removed vertex slots are preserved so that the vertex ids stay the same
+        for (const auto& vertex_ptr : source._vertices) {
+            if (vertex_ptr == nullptr) {
+                this->_vertices.push_back(nullptr);
+                if constexpr (has_vertex_property_column)
+                    this->_property_column().emplace_back();
+            }
+            else if constexpr (type_traits::is_default_properties_type_v<vertex_properties_type>) {
+                this->_vertices.push_back(this->_make_vertex(vertex_ptr->id()));
+            }
+            else {
+                this->_vertices.push_back(
+                    this->_make_vertex(vertex_ptr->id(), vertex_ptr->properties)
+                );
+            }
+        }
+
+        this->_deferred_vertex_removal = source._deferred_vertex_removal;
+        this->_n_removed_vertices = source._n_removed_vertices;
+    }
+
     void _remove_vertex_impl(const vertex_type& vertex) {
         const auto vertex_id = vertex.id();
+        if (this->_deferred_vertex_removal) {
+            this->_tombstone_vertex(vertex_id);
+            return;
+        }
+
         this->_impl.remove_vertex(vertex);
         this->_vertices.erase(std::next(std::begin(this->_vertices), vertex_id));
 
@@ -491,6 +1059,282 @@ private:
             this->_vertices.end(),
             [](auto& v) { --v->_id; }
         );
+
+        if constexpr (has_vertex_property_column) {
+            auto& column = this->_property_column();
+            column.erase(std::next(column.begin(), vertex_id));
+            std::for_each(
+                std::next(std::begin(this->_vertices), vertex_id),
+                this->_vertices.end(),
+                [](auto& v) { --v->properties._index; }
+            );
+        }
+    }
+
+    decltype(auto) _add_edge_impl(const vertex_type& first, const vertex_type& second) {
+        // the representations which do not store the edges do not need an allocated edge
+        if constexpr (requires { this->_impl.add_edge(first, second); })
+            return this->_impl.add_edge(first, second);
+        else
+            return this->_impl.add_edge(this->_edge_storage.make(first, second));
+    }
+
+    template <type_traits::c_range EdgeRange, typename MakeEdge>
+    void _add_edges_impl(const EdgeRange& edge_range, const MakeEdge& make_edge) {
+        std::vector<edge_ptr_type> new_edges;
+        if constexpr (type_traits::c_sized_range<EdgeRange>) {
+            new_edges.reserve(std::ranges::size(edge_range));
+            this->_edge_storage.reserve(std::ranges::size(edge_range));
+        }
+
+        for (const auto& edge_data : edge_range) {
+            this->_verify_vertex_id(std::get<0>(edge_data));
+            this->_verify_vertex_id(std::get<1>(edge_data));
+            new_edges.push_back(make_edge(edge_data));
+        }
+        this->_impl.add_edges(std::move(new_edges));
+    }
+
+    static void _verify_edge_data_size(
+        const std::string_view edge_data_name,
+        const std::integral auto n_edge_data,
+        const types::size_type n_edges
+    ) {
+        if (static_cast<types::size_type>(n_edge_data) != n_edges)
+            throw std::invalid_argument(std::format(
+                "The number of {} ({}) does not match the number of edges ({})",
+                edge_data_name,
+                n_edge_data,
+                n_edges
+            ));
+    }
+
+    [[nodiscard]] auto _weighted_edge_maker() {
+        return [this](const auto& id_pair, const auto& weight) {
+            edge_properties_type properties{};
+            properties.weight = weight;
+            return this->_edge_storage.make(
+                *this->_vertices[id_pair.first], *this->_vertices[id_pair.second], properties
+            );
+        };
+    }
+
+    [[nodiscard]] auto _edge_with_properties_maker() {
+        return [this](const auto& id_pair, const auto& properties) {
+            return this->_edge_storage.make(
+                *this->_vertices[id_pair.first], *this->_vertices[id_pair.second], properties
+            );
+        };
+    }
+
+    // the edges are made from the id pairs zipped with the range of the given iterator
+    template <typename MakeEdge, std::random_access_iterator EdgeDataIterator>
+    void _add_edges_impl(
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const MakeEdge& make_edge,
+        const EdgeDataIterator edge_data_begin
+    ) {
+        for (const auto& [first_id, second_id] : id_pairs) {
+            this->_verify_vertex_id(first_id);
+            this->_verify_vertex_id(second_id);
+        }
+
+        std::vector<edge_ptr_type> new_edges(id_pairs.size());
+        this->_edge_storage.reserve(id_pairs.size());
+        std::transform(
+            id_pairs.begin(), id_pairs.end(), edge_data_begin, new_edges.begin(), make_edge
+        );
+        this->_impl.add_edges(std::move(new_edges));
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    // the edges are made from the id pairs zipped with the ranges of the given iterators
+    template <
+        type_traits::c_execution_policy ExecutionPolicy,
+        typename MakeEdge,
+        std::random_access_iterator... EdgeDataIterators>
+    void _add_edges_impl(
+        ExecutionPolicy&& policy,
+        std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+        const MakeEdge& make_edge,
+        const EdgeDataIterators... edge_data_begin
+    ) {
+        const auto invalid_it =
+            std::find_if(policy, id_pairs.begin(), id_pairs.end(), [this](const auto& id_pair) {
+                return not (this->has_vertex(id_pair.first) and this->has_vertex(id_pair.second));
+            });
+        if (invalid_it != id_pairs.end()) {
+            this->_verify_vertex_id(invalid_it->first);
+            this->_verify_vertex_id(invalid_it->second);
+        }
+
+        // only the heap storage can allocate the edges concurrently
+        std::vector<edge_ptr_type> new_edges(id_pairs.size());
+        if constexpr (std::same_as<storage_tag, storage::heap_t>) {
+            std::transform(
+                policy,
+                id_pairs.begin(),
+                id_pairs.end(),
+                edge_data_begin...,
+                new_edges.begin(),
+                make_edge
+            );
+        }
+        else {
+            this->_edge_storage.reserve(id_pairs.size());
+            std::transform(
+                id_pairs.begin(), id_pairs.end(), edge_data_begin..., new_edges.begin(), make_edge
+            );
+        }
+
+        if constexpr (requires { this->_impl.add_edges(policy, std::move(new_edges)); })
+            this->_impl.add_edges(policy, std::move(new_edges));
+        else
+            this->_impl.add_edges(std::move(new_edges));
+    }
+#endif
+
+    void _remove_vertices_impl(const std::vector<bool>& removed) {
+        if (this->_deferred_vertex_removal) {
+            this->_tombstone_vertices(removed);
+            return;
+        }
+
+        this->_compact_vertices(removed);
+    }
+
+    void _compact_vertices(const std::vector<bool>& removed) {
+        // remove the edges and compact the adjacency structure in one pass
+        this->_impl.remove_vertices(removed);
+
+        // compact the vertex list and align the ids of the remaining vertices
+        util::compact(this->_vertices, removed);
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+             ++vertex_id)
+            this->_vertices[vertex_id]->_id = vertex_id;
+
+        if constexpr (has_vertex_property_column) {
+            util::compact(this->_property_column(), removed);
+            for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+                 ++vertex_id)
+                this->_vertices[vertex_id]->properties._index = vertex_id;
+        }
+    }
+
+    void _tombstone_vertex(const types::id_type vertex_id) {
+        if (this->_vertices[vertex_id] == nullptr)
+            return;
+
+        // the representations which do not store the edges remove them directly
+        if constexpr (requires { this->_impl.remove_incident_edges(vertex_id); }) {
+            this->_impl.remove_incident_edges(vertex_id);
+        }
+        else {
+            // collect the incident edges first, because removing them invalidates the edge ranges
+            std::vector<const edge_type*> incident_edges;
+            for (const auto& edge : this->_impl.adjacent_edges(vertex_id))
+                incident_edges.push_back(&edge);
+
+            if constexpr (type_traits::is_directed_v<edge_type>) {
+                if constexpr (requires { this->_impl.in_edges(vertex_id); }) {
+                    for (const auto& edge : this->_impl.in_edges(vertex_id))
+                        incident_edges.push_back(&edge);
+                }
+                else {
+                    // without the in-edge index all adjacency lists have to be scanned
+                    for (const auto source_id : this->vertex_ids())
+                        for (const auto& edge_ref : this->get_edges(source_id, vertex_id))
+                            incident_edges.push_back(&edge_ref.get());
+                }
+            }
+
+            this->_remove_collected_edges(incident_edges);
+        }
+
+        this->_vertices[vertex_id] = nullptr;
+        ++this->_n_removed_vertices;
+    }
+
+    // tombstones all marked vertices, scanning the adjacency lists at most once
+    void _tombstone_vertices(const std::vector<bool>& removed) {
+        const auto is_removed = [this, &removed](const types::id_type vertex_id) {
+            return removed[vertex_id] and this->_vertices[vertex_id] != nullptr;
+        };
+
+        if constexpr (requires { this->_impl.remove_incident_edges(types::id_type{}); }) {
+            for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+                 ++vertex_id)
+                if (is_removed(vertex_id))
+                    this->_impl.remove_incident_edges(vertex_id);
+        }
+        else {
+            std::vector<const edge_type*> incident_edges;
+            for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+                 ++vertex_id) {
+                if (not is_removed(vertex_id))
+                    continue;
+
+                for (const auto& edge : this->_impl.adjacent_edges(vertex_id))
+                    incident_edges.push_back(&edge);
+
+                if constexpr (type_traits::is_directed_v<edge_type>
+                              and requires { this->_impl.in_edges(vertex_id); }) {
+                    for (const auto& edge : this->_impl.in_edges(vertex_id))
+                        incident_edges.push_back(&edge);
+                }
+            }
+
+            if constexpr (type_traits::is_directed_v<edge_type>
+                          and not requires { this->_impl.in_edges(types::id_type{}); }) {
+                // a single scan of the remaining vertices' adjacency lists finds all in-edges
+                for (const auto source_id : this->vertex_ids())
+                    if (not removed[source_id])
+                        for (const auto& edge : this->_impl.adjacent_edges(source_id))
+                            if (removed[edge.second_id()])
+                                incident_edges.push_back(&edge);
+            }
+
+            this->_remove_collected_edges(incident_edges);
+        }
+
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+             ++vertex_id) {
+            if (is_removed(vertex_id)) {
+                this->_vertices[vertex_id] = nullptr;
+                ++this->_n_removed_vertices;
+            }
+        }
+    }
+
+    void _remove_collected_edges(std::vector<const edge_type*>& edges) {
+        // the loops and the edges connecting two removed vertices can be collected more than once
+        std::ranges::sort(edges);
+        const auto duplicates = std::ranges::unique(edges);
+        edges.erase(duplicates.begin(), duplicates.end());
+
+        for (const auto* edge : edges)
+            this->_impl.remove_edge(*edge);
+    }
+
+    [[nodiscard]] std::vector<types::id_type> _common_neighbors_impl(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        if constexpr (requires { this->_impl.common_neighbors(first_id, second_id); })
+            return this->_impl.common_neighbors(first_id, second_id);
+        else
+            return util::sorted_intersection(
+                this->_sorted_neighbor_ids(first_id), this->_sorted_neighbor_ids(second_id)
+            );
+    }
+
+    [[nodiscard]] std::vector<types::id_type> _sorted_neighbor_ids(const types::id_type vertex_id
+    ) const {
+        std::vector<types::id_type> neighbor_ids;
+        for (const auto& edge : this->_impl.adjacent_edges(vertex_id))
+            neighbor_ids.push_back(edge.incident_vertex_id(vertex_id));
+
+        std::ranges::sort(neighbor_ids);
+        return neighbor_ids;
     }
 
     // --- io methods ---
@@ -528,6 +1372,12 @@ private:
     }
 
     void _gsf_write(std::ostream& os) const {
+        if (this->_n_removed_vertices > constants::zero)
+            throw std::logic_error(std::format(
+                "Cannot write a graph with {} removed vertices pending compaction",
+                this->_n_removed_vertices
+            ));
+
         const bool with_vertex_properties =
             io::is_option_set(os, io::graph_option::with_vertex_properties);
         const bool with_edge_properties =
@@ -644,8 +1494,15 @@ private:
         }
     }
 
+    // the element storages have to be declared first so that they outlive the elements
+    [[no_unique_address]] vertex_storage_type _vertex_storage{};
+    [[no_unique_address]] edge_storage_type _edge_storage{};
     vetex_list_type _vertices{};
+    [[no_unique_address]] vertex_property_column_ptr_type _vertex_property_column{};
     implementation_type _impl{};
+
+    bool _deferred_vertex_removal = false;
+    types::size_type _n_removed_vertices = constants::default_size;
 };
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -0,0 +1,479 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "graph_utility.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+#include <execution>
+#endif
+
+namespace gl::inline gl_id_type_namespace {
+
+namespace detail {
+
+// a minimal test-and-test-and-set lock guarding a single builder shard
+class spinlock {
+public:
+    spinlock() = default;
+
+    spinlock(const spinlock&) = delete;
+    spinlock& operator=(const spinlock&) = delete;
+
+    ~spinlock() = default;
+
+    void lock() {
+        while (this->_locked.exchange(true, std::memory_order_acquire))
+            while (this->_locked.load(std::memory_order_relaxed))
+                std::this_thread::yield();
+    }
+
+    gl_attr_force_inline void unlock() {
+        this->_locked.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> _locked = false;
+};
+
+// a sequential index assigned to each thread on its first call
+[[nodiscard]] inline types::size_type this_thread_index() {
+    static std::atomic<types::size_type> next_index = constants::zero;
+    thread_local const types::size_type index = next_index.fetch_add(constants::one);
+    return index;
+}
+
+// the size of a cache line (used to keep the builder shards from sharing lines)
+inline constexpr types::size_type cache_line_size = 64ull;
+
+} // namespace detail
+
+/*
+A builder which allows adding edges to a graph from multiple threads at once.
+
+The edges are buffered in shards, each guarded by its own spinlock. A thread always
+    inserts into the shard selected by its sequential index, so as long as the number of
+    shards is not smaller than the number of inserting threads, the threads never contend.
+The edges are moved into an actual graph by `finalize`, which uses the bulk `add_edges`
+    method of the graph (all adjacency lists are grown at most once).
+
+All insertion methods (and `n_edges`) can be called concurrently, while `finalize` must be
+    called only after all inserting threads have finished.
+*/
+
+template <type_traits::c_graph GraphType>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+class graph_builder final {
+public:
+    using graph_type = GraphType;
+    using edge_properties_type = typename graph_type::edge_properties_type;
+
+    using edge_record_type = std::conditional_t<
+        type_traits::is_default_properties_type_v<edge_properties_type>,
+        types::homogeneous_pair<types::id_type>,
+        std::tuple<types::id_type, types::id_type, edge_properties_type>>;
+
+    graph_builder(const graph_builder&) = delete;
+    graph_builder& operator=(const graph_builder&) = delete;
+
+    graph_builder(graph_builder&&) = delete;
+    graph_builder& operator=(graph_builder&&) = delete;
+
+    explicit graph_builder(
+        const types::size_type n_vertices,
+        const types::size_type n_shards = default_n_shards()
+    )
+    : _n_vertices(n_vertices), _shards(std::max(n_shards, constants::one)) {}
+
+    ~graph_builder() = default;
+
+    [[nodiscard]] static types::size_type default_n_shards() {
+        return constants::two
+             * std::max<types::size_type>(std::thread::hardware_concurrency(), constants::one);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_n_vertices;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_shards() const {
+        return this->_shards.size();
+    }
+
+    // the number of edges added so far
+    [[nodiscard]] gl_attr_force_inline types::size_type n_edges() const {
+        return this->_n_edges.load(std::memory_order_relaxed);
+    }
+
+    void add_edge(const types::id_type first_id, const types::id_type second_id)
+    requires(type_traits::is_default_properties_type_v<edge_properties_type>)
+    {
+        this->_verify_vertex_id(first_id);
+        this->_verify_vertex_id(second_id);
+        this->_insert(edge_record_type{first_id, second_id});
+    }
+
+    void add_edge(
+        const types::id_type first_id,
+        const types::id_type second_id,
+        const edge_properties_type& properties
+    )
+    requires(not type_traits::is_default_properties_type_v<edge_properties_type>)
+    {
+        this->_verify_vertex_id(first_id);
+        this->_verify_vertex_id(second_id);
+        this->_insert(edge_record_type{first_id, second_id, properties});
+    }
+
+    // adds a batch of edges acquiring the shard lock only once
+    template <type_traits::c_range_of<edge_record_type> EdgeRecordRange>
+    void add_edges(const EdgeRecordRange& edge_records) {
+        for (const auto& edge_record : edge_records) {
+            this->_verify_vertex_id(std::get<0>(edge_record));
+            this->_verify_vertex_id(std::get<1>(edge_record));
+        }
+
+        types::size_type n_added = constants::zero;
+        {
+            auto& shard = this->_current_shard();
+            std::lock_guard<detail::spinlock> lock{shard.lock};
+            for (const auto& edge_record : edge_records) {
+                shard.edges.push_back(edge_record);
+                ++n_added;
+            }
+        }
+
+        this->_n_edges.fetch_add(n_added, std::memory_order_relaxed);
+    }
+
+    // creates the graph with all edges added so far and leaves the builder empty
+    [[nodiscard]] graph_type finalize() {
+        std::vector<edge_record_type> edge_records;
+        edge_records.reserve(this->n_edges());
+        for (auto& shard : this->_shards) {
+            std::ranges::move(shard.edges, std::back_inserter(edge_records));
+            shard.edges = std::vector<edge_record_type>{};
+        }
+        this->_n_edges.store(constants::zero, std::memory_order_relaxed);
+
+        graph_type graph{this->_n_vertices};
+        graph.add_edges(edge_records);
+        return graph;
+    }
+
+private:
+    struct alignas(detail::cache_line_size) shard_type {
+        detail::spinlock lock;
+        std::vector<edge_record_type> edges;
+    };
+
+    gl_attr_force_inline void _verify_vertex_id(const types::id_type vertex_id) const {
+        if (vertex_id >= this->_n_vertices)
+            throw std::out_of_range(std::format("Got invalid vertex id [{}]", vertex_id));
+    }
+
+    [[nodiscard]] gl_attr_force_inline shard_type& _current_shard() {
+        return this->_shards[detail::this_thread_index() % this->_shards.size()];
+    }
+
+    void _insert(edge_record_type&& edge_record) {
+        {
+            auto& shard = this->_current_shard();
+            std::lock_guard<detail::spinlock> lock{shard.lock};
+            shard.edges.push_back(std::move(edge_record));
+        }
+
+        this->_n_edges.fetch_add(constants::one, std::memory_order_relaxed);
+    }
+
+    const types::size_type _n_vertices;
+    std::vector<shard_type> _shards;
+    std::atomic<types::size_type> _n_edges = constants::zero;
+};
+
+/*
+Creates a graph with the given number of vertices and an edge for each pair of vertex ids.
+
+The construction runs in O(V + E): the degrees of the vertices are pre-counted, so that each
+    adjacency list is grown (at most) once (see the bulk `graph::add_edges` methods).
+The overloads with an execution policy (available with `GL_CONFIG_EXECUTION_POLICIES`)
+    allocate the edges concurrently (heap storage only), count the degree histogram
+    of the list representations concurrently and scatter the edges into the pre-sized
+    adjacency lists (see the parallel `graph::add_edges` overloads).
+*/
+
+template <type_traits::c_graph GraphType>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+[[nodiscard]] GraphType build_from_edges(
+    const types::size_type n_vertices,
+    std::span<const types::homogeneous_pair<types::id_type>> id_pairs
+) {
+    GraphType graph{n_vertices};
+    graph.add_edges(id_pairs);
+    return graph;
+}
+
+// the i-th edge is assigned the i-th weight
+template <type_traits::c_graph GraphType>
+requires(
+    not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>
+    and type_traits::c_weight_properties_type<typename GraphType::edge_properties_type>
+)
+[[nodiscard]] GraphType build_from_edges(
+    const types::size_type n_vertices,
+    std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+    std::span<const typename GraphType::edge_properties_type::weight_type> weights
+) {
+    GraphType graph{n_vertices};
+    graph.add_edges(id_pairs, weights);
+    return graph;
+}
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+template <type_traits::c_graph GraphType, type_traits::c_execution_policy ExecutionPolicy>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+[[nodiscard]] GraphType build_from_edges(
+    const types::size_type n_vertices,
+    std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+    ExecutionPolicy&& policy
+) {
+    GraphType graph{n_vertices};
+    graph.add_edges(policy, id_pairs);
+    return graph;
+}
+
+template <type_traits::c_graph GraphType, type_traits::c_execution_policy ExecutionPolicy>
+requires(
+    not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>
+    and type_traits::c_weight_properties_type<typename GraphType::edge_properties_type>
+)
+[[nodiscard]] GraphType build_from_edges(
+    const types::size_type n_vertices,
+    std::span<const types::homogeneous_pair<types::id_type>> id_pairs,
+    std::span<const typename GraphType::edge_properties_type::weight_type> weights,
+    ExecutionPolicy&& policy
+) {
+    GraphType graph{n_vertices};
+    graph.add_edges(policy, id_pairs, weights);
+    return graph;
+}
+#endif
+
+template <type_traits::c_graph GraphType>
+struct subgraph_descriptor {
+    using graph_type = GraphType;
+
+    graph_type graph;
+    // the i-th vertex of the subgraph is the `vertex_id_map[i]` vertex of the source graph
+    std::vector<types::id_type> vertex_id_map;
+};
+
+namespace detail {
+
+/*
+Maps the ids of the vertices of a graph to the ids of the vertices of its subgraph.
+A list indexed by the vertex ids is used only if the subgraph contains at least
+    1/`dense_ratio` of the graph's vertices (so that its size is O(V')),
+    otherwise the ids are mapped with a hash map.
+*/
+class subgraph_id_mapping {
+public:
+    static constexpr types::size_type dense_ratio = 8ull;
+
+    subgraph_id_mapping(
+        const types::size_type n_graph_vertices, const types::size_type n_subgraph_vertices
+    ) {
+        if (n_subgraph_vertices * dense_ratio >= n_graph_vertices)
+            this->_dense_map.resize(n_graph_vertices, constants::invalid_id);
+        else
+            this->_sparse_map.reserve(n_subgraph_vertices);
+    }
+
+    // returns false if the vertex is already mapped
+    bool insert(const types::id_type vertex_id, const types::id_type subgraph_id) {
+        if (not this->_is_dense())
+            return this->_sparse_map.emplace(vertex_id, subgraph_id).second;
+
+        auto& mapped_id = this->_dense_map[vertex_id];
+        if (mapped_id != constants::invalid_id)
+            return false;
+
+        mapped_id = subgraph_id;
+        return true;
+    }
+
+    // returns the subgraph id of the vertex or `constants::invalid_id` if it is not in the subgraph
+    [[nodiscard]] gl_attr_force_inline types::id_type operator[](const types::id_type vertex_id
+    ) const {
+        if (this->_is_dense())
+            return this->_dense_map[vertex_id];
+
+        const auto it = this->_sparse_map.find(vertex_id);
+        return it == this->_sparse_map.end() ? constants::invalid_id : it->second;
+    }
+
+private:
+    [[nodiscard]] gl_attr_force_inline bool _is_dense() const {
+        return not this->_dense_map.empty();
+    }
+
+    std::vector<types::id_type> _dense_map;
+    std::unordered_map<types::id_type, types::id_type> _sparse_map;
+};
+
+// the algorithms are executed sequentially if no execution policy is given
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_range_of<types::id_type> IdRange,
+    typename... ExecutionPolicy>
+[[nodiscard]] subgraph_descriptor<GraphType> induced_subgraph_impl(
+    const GraphType& graph, const IdRange& vertex_id_range, ExecutionPolicy&&... policy
+) {
+    using edge_type = typename GraphType::edge_type;
+    using edge_properties_type = typename GraphType::edge_properties_type;
+
+    constexpr bool copy_edge_properties =
+        not type_traits::is_default_properties_type_v<edge_properties_type>;
+
+    subgraph_descriptor<GraphType> subgraph;
+    auto& vertex_id_map = subgraph.vertex_id_map;
+    std::ranges::copy(vertex_id_range, std::back_inserter(vertex_id_map));
+
+    // map the source vertex ids to the subgraph vertex ids
+    const auto n_vertices = vertex_id_map.size();
+    const subgraph_id_mapping subgraph_id_map = [&] {
+        subgraph_id_mapping id_map(graph.n_vertices(), n_vertices);
+        for (types::id_type subgraph_id = constants::initial_id; subgraph_id < n_vertices;
+             ++subgraph_id) {
+            const auto vertex_id = vertex_id_map[subgraph_id];
+            if (not graph.has_vertex(vertex_id))
+                throw std::out_of_range(std::format("Got invalid vertex id [{}]", vertex_id));
+            if (not id_map.insert(vertex_id, subgraph_id))
+                throw std::invalid_argument(std::format("Got duplicate vertex id [{}]", vertex_id));
+        }
+        return id_map;
+    }();
+
+    // invokes the function for each edge of the subgraph owned by the vertex
+    // (the undirected edges are owned by the vertex with the smaller subgraph id)
+    const auto for_each_owned_edge = [&](const types::id_type vertex_id, const auto& function) {
+        const auto subgraph_id = subgraph_id_map[vertex_id];
+        for (const auto& edge : graph.adjacent_edges(vertex_id)) {
+            const auto incident_subgraph_id = subgraph_id_map[edge.incident_vertex_id(vertex_id)];
+            if (incident_subgraph_id == constants::invalid_id)
+                continue;
+            if constexpr (type_traits::is_undirected_v<edge_type>)
+                if (incident_subgraph_id < subgraph_id)
+                    continue;
+            function(edge);
+        }
+    };
+
+    // count the edges owned by each vertex and compute the edge offsets
+    // (the parallel loops get the subgraph ids of the vertices from the id map)
+    std::vector<types::size_type> edge_offsets(n_vertices + constants::one, constants::zero);
+    std::for_each(policy..., vertex_id_map.begin(), vertex_id_map.end(), [&](const auto& vertex_id) {
+        auto& n_owned_edges = edge_offsets[subgraph_id_map[vertex_id] + constants::one];
+        for_each_owned_edge(vertex_id, [&n_owned_edges](const edge_type&) { ++n_owned_edges; });
+    });
+    std::inclusive_scan(policy..., edge_offsets.begin(), edge_offsets.end(), edge_offsets.begin());
+
+    // scatter the edges into the preallocated buffers
+    const auto n_edges = edge_offsets.back();
+    std::vector<types::homogeneous_pair<types::id_type>> id_pairs(n_edges);
+    std::vector<const edge_type*> source_edges;
+    if constexpr (copy_edge_properties)
+        source_edges.resize(n_edges);
+
+    std::for_each(policy..., vertex_id_map.begin(), vertex_id_map.end(), [&](const auto& vertex_id) {
+        auto edge_idx = edge_offsets[subgraph_id_map[vertex_id]];
+        for_each_owned_edge(vertex_id, [&](const edge_type& edge) {
+            id_pairs[edge_idx] = {
+                subgraph_id_map[edge.first_id()], subgraph_id_map[edge.second_id()]
+            };
+            if constexpr (copy_edge_properties)
+                source_edges[edge_idx] = &edge;
+            ++edge_idx;
+        });
+    });
+
+    // build the subgraph
+    auto& target = subgraph.graph;
+    target.add_vertices(n_vertices);
+    if constexpr (not type_traits::is_default_properties_type_v<
+                      typename GraphType::vertex_properties_type>) {
+        std::for_each(policy..., vertex_id_map.begin(), vertex_id_map.end(), [&](const auto& id) {
+            target.get_vertex(subgraph_id_map[id]).properties = graph.get_vertex(id).properties;
+        });
+    }
+
+    if constexpr (copy_edge_properties)
+        target.add_edges(
+            policy...,
+            id_pairs,
+            std::views::transform(source_edges, [](const edge_type* edge) -> const auto& {
+                return edge->properties;
+            })
+        );
+    else
+        target.add_edges(policy..., id_pairs);
+
+    return subgraph;
+}
+
+} // namespace detail
+
+/*
+Creates a standalone graph induced by the given set of vertices of a graph: the vertices
+    (with their properties) and all edges between them (with their properties) are copied.
+The vertices of the subgraph are numbered in the order of the given range.
+
+The construction runs in O(V' + deg(V')): the source vertex ids are mapped to the subgraph ids
+    with a dense list only if the subgraph holds a large enough part of the graph's vertices
+    (with a hash map otherwise), the number of the surviving edges of each vertex
+    is counted, the edges are scattered into a single buffer at the offsets given by
+    the prefix sums of these counts and inserted with the bulk `graph::add_edges` method.
+With the execution policy overload (available with `GL_CONFIG_EXECUTION_POLICIES`)
+    the counting and the scattering run concurrently and the edges are inserted with
+    the parallel `graph::add_edges` method.
+*/
+
+template <type_traits::c_graph GraphType, type_traits::c_range_of<types::id_type> IdRange>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+[[nodiscard]] gl_attr_force_inline subgraph_descriptor<GraphType> induced_subgraph(
+    const GraphType& graph, const IdRange& vertex_id_range
+) {
+    return detail::induced_subgraph_impl(graph, vertex_id_range);
+}
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_range_of<types::id_type> IdRange,
+    type_traits::c_execution_policy ExecutionPolicy>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+[[nodiscard]] gl_attr_force_inline subgraph_descriptor<GraphType> induced_subgraph(
+    const GraphType& graph, const IdRange& vertex_id_range, ExecutionPolicy&& policy
+) {
+    return detail::induced_subgraph_impl(graph, vertex_id_range, policy);
+}
+#endif
+
+} // namespace gl::inline gl_id_type_namespace
@@ -4,12 +4,13 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "graph_utility.hpp"
 
 #include <filesystem>
 #include <fstream>
 
-namespace gl::io {
+namespace gl::inline gl_id_type_namespace::io {
 
 struct write {};
 
@@ -114,4 +115,4 @@ template <type_traits::c_graph GraphType>
     return graph;
 }
 
-} // namespace gl::io
+} // namespace gl::inline gl_id_type_namespace::io
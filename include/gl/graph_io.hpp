@@ -4,9 +4,10 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "io/stream_options_manipulator.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 namespace io {
 
 enum class graph_option : bit_position_type {
@@ -39,4 +40,4 @@ inline const stream_options_manipulator disable_gsf = unset_option(graph_option:
 
 } // namespace io
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -7,66 +7,173 @@
 #include "decl/graph_traits.hpp"
 #include "decl/impl_tags.hpp"
 #include "edge_descriptor.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "storage/storage_tags.hpp"
+#include "types/columnar_properties.hpp"
 
-namespace gl {
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace {
 
 template <
     type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
     type_traits::c_properties VertexProperties = types::empty_properties,
     type_traits::c_properties EdgeProperties = types::empty_properties,
-    type_traits::c_graph_impl_tag ImplTag = impl::list_t>
+    type_traits::c_graph_impl_tag ImplTag = impl::list_t,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
 struct graph_traits {
-    using vertex_type = vertex_descriptor<VertexProperties>;
-    using vertex_ptr_type = types::vertex_ptr_type<vertex_type>;
-    using vertex_properties_type = typename vertex_type::properties_type;
-
-    using edge_type = edge_descriptor<vertex_type, EdgeDirectionalTag, EdgeProperties>;
-    using edge_ptr_type = types::edge_ptr_type<edge_type>;
+    static_assert(
+        not type_traits::c_columnar_properties<EdgeProperties>,
+        "The edge properties cannot be stored column-wise"
+    );
+
+    // the vertex properties can be stored column-wise using the `types::columnar` marker
+    using vertex_type =
+        vertex_descriptor<typename types::properties_storage<VertexProperties>::member_type>;
+    using vertex_properties_type = typename types::properties_storage<VertexProperties>::value_type;
+
+    // the edge properties of the frozen graphs are read-only (see `impl::adjacency_csr`)
+    using edge_type = edge_descriptor<
+        vertex_type,
+        EdgeDirectionalTag,
+        std::conditional_t<
+            std::same_as<ImplTag, impl::csr_t>,
+            const EdgeProperties,
+            EdgeProperties>>;
     using edge_directional_tag = typename edge_type::directional_tag;
     using edge_properties_type = typename edge_type::properties_type;
 
     using implementation_tag = ImplTag;
+
+    using storage_tag = StorageTag;
+    using vertex_ptr_type = typename storage_tag::template vertex_ptr_type<vertex_type>;
+    using vertex_storage_type = typename storage_tag::template vertex_storage_type<vertex_type>;
+    using edge_ptr_type = typename storage_tag::template edge_ptr_type<edge_type>;
+    using edge_storage_type = typename storage_tag::template edge_storage_type<edge_type>;
+
+    // the allocator of the containers of the graph and its implementation
+    using allocator_type = typename storage_tag::template allocator_type<std::byte>;
+
+    template <typename T>
+    using vector_type = std::vector<T, typename storage_tag::template allocator_type<T>>;
+
+    template <type_traits::c_graph_impl_tag OtherImplTag>
+    using rebind_implementation = graph_traits<
+        EdgeDirectionalTag,
+        VertexProperties,
+        EdgeProperties,
+        OtherImplTag,
+        StorageTag>;
 };
 
 template <
     type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
     type_traits::c_properties VertexProperties = types::empty_properties,
-    type_traits::c_properties EdgeProperties = types::empty_properties>
+    type_traits::c_properties EdgeProperties = types::empty_properties,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
 using list_graph_traits =
-    graph_traits<EdgeDirectionalTag, VertexProperties, EdgeProperties, impl::list_t>;
+    graph_traits<EdgeDirectionalTag, VertexProperties, EdgeProperties, impl::list_t, StorageTag>;
 
 template <
     type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
     type_traits::c_properties VertexProperties = types::empty_properties,
-    type_traits::c_properties EdgeProperties = types::empty_properties>
+    type_traits::c_properties EdgeProperties = types::empty_properties,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
 using matrix_graph_traits =
-    graph_traits<EdgeDirectionalTag, VertexProperties, EdgeProperties, impl::matrix_t>;
+    graph_traits<EdgeDirectionalTag, VertexProperties, EdgeProperties, impl::matrix_t, StorageTag>;
+
+template <
+    type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
+    type_traits::c_properties VertexProperties = types::empty_properties,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
+using bit_matrix_graph_traits = graph_traits<
+    EdgeDirectionalTag,
+    VertexProperties,
+    types::empty_properties,
+    impl::bit_matrix_t,
+    StorageTag>;
 
 template <
+    type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
     type_traits::c_properties VertexProperties = types::empty_properties,
     type_traits::c_properties EdgeProperties = types::empty_properties,
-    type_traits::c_graph_impl_tag ImplTag = impl::list_t>
-using directed_graph_traits = graph_traits<directed_t, VertexProperties, EdgeProperties, ImplTag>;
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
+using sparse_matrix_graph_traits = graph_traits<
+    EdgeDirectionalTag,
+    VertexProperties,
+    EdgeProperties,
+    impl::sparse_matrix_t,
+    StorageTag>;
 
 template <
+    type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
     type_traits::c_properties VertexProperties = types::empty_properties,
     type_traits::c_properties EdgeProperties = types::empty_properties,
-    type_traits::c_graph_impl_tag ImplTag = impl::list_t>
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
+using csr_graph_traits =
+    graph_traits<EdgeDirectionalTag, VertexProperties, EdgeProperties, impl::csr_t, StorageTag>;
+
+template <
+    type_traits::c_edge_directional_tag EdgeDirectionalTag = directed_t,
+    type_traits::c_properties VertexProperties = types::empty_properties,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
+using compressed_graph_traits = graph_traits<
+    EdgeDirectionalTag,
+    VertexProperties,
+    types::empty_properties,
+    impl::compressed_t,
+    StorageTag>;
+
+template <
+    type_traits::c_properties VertexProperties = types::empty_properties,
+    type_traits::c_properties EdgeProperties = types::empty_properties,
+    type_traits::c_graph_impl_tag ImplTag = impl::list_t,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
+using directed_graph_traits =
+    graph_traits<directed_t, VertexProperties, EdgeProperties, ImplTag, StorageTag>;
+
+template <
+    type_traits::c_properties VertexProperties = types::empty_properties,
+    type_traits::c_properties EdgeProperties = types::empty_properties,
+    type_traits::c_graph_impl_tag ImplTag = impl::list_t,
+    type_traits::c_storage_tag StorageTag = storage::heap_t>
 using undirected_graph_traits =
-    graph_traits<undirected_t, VertexProperties, EdgeProperties, ImplTag>;
+    graph_traits<undirected_t, VertexProperties, EdgeProperties, ImplTag, StorageTag>;
 
 namespace type_traits {
 
 template <typename TraitsType>
 concept c_list_graph_traits =
     c_instantiation_of<TraitsType, graph_traits>
-    and std::same_as<typename TraitsType::implementation_tag, impl::list_t>;
+    and c_list_impl_tag<typename TraitsType::implementation_tag>;
 
 template <typename TraitsType>
 concept c_matrix_graph_traits =
     c_instantiation_of<TraitsType, graph_traits>
     and std::same_as<typename TraitsType::implementation_tag, impl::matrix_t>;
 
+template <typename TraitsType>
+concept c_bit_matrix_graph_traits =
+    c_instantiation_of<TraitsType, graph_traits>
+    and std::same_as<typename TraitsType::implementation_tag, impl::bit_matrix_t>;
+
+template <typename TraitsType>
+concept c_sparse_matrix_graph_traits =
+    c_instantiation_of<TraitsType, graph_traits>
+    and std::same_as<typename TraitsType::implementation_tag, impl::sparse_matrix_t>;
+
+template <typename TraitsType>
+concept c_csr_graph_traits =
+    c_instantiation_of<TraitsType, graph_traits>
+    and std::same_as<typename TraitsType::implementation_tag, impl::csr_t>;
+
+template <typename TraitsType>
+concept c_compressed_graph_traits =
+    c_instantiation_of<TraitsType, graph_traits>
+    and std::same_as<typename TraitsType::implementation_tag, impl::compressed_t>;
+
 template <typename TraitsType>
 concept c_directed_graph_traits =
     c_instantiation_of<TraitsType, graph_traits>
@@ -79,4 +186,4 @@ concept c_undirected_graph_traits =
 
 } // namespace type_traits
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -4,9 +4,10 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "graph.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 // --- general graph utility ---
 
@@ -15,10 +16,26 @@ namespace type_traits {
 template <typename T>
 concept c_graph = c_instantiation_of<T, graph>;
 
-template <c_graph GraphType>
+// the read-only graph interface used by the algorithms (satisfied by graphs and graph views)
+template <typename T>
+concept c_graph_view = requires(const T& graph, const types::id_type vertex_id) {
+    typename T::vertex_type;
+    typename T::vertex_properties_type;
+    typename T::edge_type;
+    typename T::edge_properties_type;
+    { graph.n_vertices() } -> std::convertible_to<types::size_type>;
+    { graph.n_removed_vertices() } -> std::convertible_to<types::size_type>;
+    { graph.has_vertex(vertex_id) } -> std::convertible_to<bool>;
+    { graph.get_vertex(vertex_id) } -> std::same_as<const typename T::vertex_type&>;
+    { graph.vertices() } -> std::ranges::range;
+    { graph.vertex_ids() } -> std::ranges::range;
+    { graph.adjacent_edges(vertex_id) } -> std::ranges::range;
+};
+
+template <c_graph_view GraphType>
 inline constexpr bool is_directed_v<GraphType> = is_directed_v<typename GraphType::edge_type>;
 
-template <c_graph GraphType>
+template <c_graph_view GraphType>
 inline constexpr bool is_undirected_v<GraphType> = is_undirected_v<typename GraphType::edge_type>;
 
 template <typename T>
@@ -27,6 +44,24 @@ concept c_directed_graph = c_graph<T> and is_directed_v<T>;
 template <typename T>
 concept c_undirected_graph = c_graph<T> and is_undirected_v<T>;
 
+template <typename T>
+concept c_directed_graph_view = c_graph_view<T> and is_directed_v<T>;
+
+template <typename T>
+concept c_undirected_graph_view = c_graph_view<T> and is_undirected_v<T>;
+
+/*
+Satisfied by the graph views whose adjacent edge ranges yield references to the edges stored
+    in the graph (and not temporary edges, like the compressed graphs or the bit matrix graphs),
+    so that the addresses of the adjacent edges can be kept.
+*/
+template <typename T>
+concept c_stable_edge_graph_view =
+    c_graph_view<T> and requires(const T& graph, const types::id_type vertex_id) {
+        requires std::is_lvalue_reference_v<
+            std::ranges::range_reference_t<decltype(graph.adjacent_edges(vertex_id))>>;
+    };
+
 } // namespace type_traits
 
 // --- utility associated with graph's elements' properties ---
@@ -35,23 +70,23 @@ namespace types {
 
 using default_vertex_distance_type = std::int64_t;
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 struct vertex_distance {
     using type = default_vertex_distance_type;
 };
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 requires(type_traits::c_weight_properties_type<typename GraphType::edge_properties_type>)
 struct vertex_distance<GraphType> {
     using type = typename GraphType::edge_properties_type::weight_type;
 };
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 using vertex_distance_type = typename vertex_distance<GraphType>::type;
 
 } // namespace types
 
-template <type_traits::c_graph GraphType>
+template <type_traits::c_graph_view GraphType>
 [[nodiscard]] gl_attr_force_inline types::vertex_distance_type<GraphType> get_weight(
     const typename GraphType::edge_type& edge
 ) {
@@ -61,4 +96,37 @@ template <type_traits::c_graph GraphType>
         return static_cast<types::default_vertex_distance_type>(1ll);
 }
 
-} // namespace gl
+// returns the properties of the vertex (also if the graph stores them column-wise)
+template <type_traits::c_graph_view GraphType>
+[[nodiscard]] gl_attr_force_inline typename GraphType::vertex_properties_type& get_properties(
+    const typename GraphType::vertex_type& vertex
+) {
+    using vertex_member_properties_type = typename GraphType::vertex_type::properties_type;
+
+    if constexpr (type_traits::c_column_property_ref<vertex_member_properties_type>)
+        return vertex.properties.get();
+    else
+        return vertex.properties;
+}
+
+namespace type_traits {
+
+/*
+Satisfied by the graphs which store the adjacent vertex ids and the adjacent edge weights
+    in flat columns (e.g. the frozen graphs with weighted edges), which the weighted
+    algorithms can read sequentially instead of reading the weights through the edges.
+*/
+template <typename T>
+concept c_weight_column_graph_view =
+    c_graph_view<T> and requires(const T& graph, const types::id_type vertex_id) {
+        {
+            graph.adjacent_vertex_ids(vertex_id)
+        } -> std::same_as<std::span<const types::id_type>>;
+        {
+            graph.adjacent_weights(vertex_id)
+        } -> std::same_as<std::span<const types::vertex_distance_type<T>>>;
+    };
+
+} // namespace type_traits
+
+} // namespace gl::inline gl_id_type_namespace
@@ -0,0 +1,230 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "graph_utility.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <format>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace {
+
+// a filter predicate which accepts all elements (its checks are optimized out by the views)
+struct no_filter {
+    template <typename T>
+    [[nodiscard]] gl_attr_force_inline constexpr bool operator()(const T&) const noexcept {
+        return true;
+    }
+};
+
+namespace type_traits {
+
+template <typename F>
+concept c_no_filter = std::same_as<F, no_filter>;
+
+template <typename F, typename ElementType>
+concept c_element_filter =
+    std::copy_constructible<F> and std::predicate<const F&, const ElementType&>;
+
+} // namespace type_traits
+
+/*
+A non-owning view of a graph with the vertices and edges restricted by filter predicates.
+
+The view neither copies nor allocates anything: the vertex and edge ranges of the view are
+    lazily filtered ranges of the underlying graph's ranges. An edge is visible if it satisfies
+    the edge predicate and both of its incident vertices satisfy the vertex predicate.
+The IDs of the visible vertices are the same as in the underlying graph, so `n_vertices`
+    returns the number of the underlying graph's vertex slots and the hidden vertices are
+    counted as removed by `n_removed_vertices` (this is what the algorithms expect).
+
+The view satisfies the `type_traits::c_graph_view` concept, so it can be passed to all
+    algorithms. The view (and the underlying graph) must outlive all ranges returned by it
+    and the underlying graph must not be modified while the view is used.
+*/
+
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_element_filter<typename GraphType::vertex_type> VertexPredicate = no_filter,
+    type_traits::c_element_filter<typename GraphType::edge_type> EdgePredicate = no_filter>
+class graph_view final {
+public:
+    using graph_type = GraphType;
+    using traits_type = typename graph_type::traits_type;
+
+    using vertex_type = typename graph_type::vertex_type;
+    using vertex_properties_type = typename graph_type::vertex_properties_type;
+
+    using edge_type = typename graph_type::edge_type;
+    using edge_directional_tag = typename graph_type::edge_directional_tag;
+    using edge_properties_type = typename graph_type::edge_properties_type;
+
+    using vertex_predicate_type = VertexPredicate;
+    using edge_predicate_type = EdgePredicate;
+
+    explicit graph_view(
+        const graph_type& graph,
+        const vertex_predicate_type& vertex_pred = {},
+        const edge_predicate_type& edge_pred = {}
+    )
+    : _graph(&graph), _vertex_pred(vertex_pred), _edge_pred(edge_pred) {}
+
+    graph_view(const graph_view&) = default;
+    graph_view& operator=(const graph_view&) = default;
+
+    graph_view(graph_view&&) = default;
+    graph_view& operator=(graph_view&&) = default;
+
+    ~graph_view() = default;
+
+    [[nodiscard]] gl_attr_force_inline const graph_type& graph() const {
+        return *this->_graph;
+    }
+
+    // --- general methods ---
+
+    // the number of vertex slots of the underlying graph
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_graph->n_vertices();
+    }
+
+    // the number of vertices removed from the underlying graph or hidden by the view - O(V)
+    [[nodiscard]] types::size_type n_removed_vertices() const {
+        if constexpr (type_traits::c_no_filter<vertex_predicate_type>) {
+            return this->_graph->n_removed_vertices();
+        }
+        else {
+            const auto n_hidden_vertices = std::ranges::count_if(
+                this->_graph->vertices(),
+                [this](const vertex_type& vertex) { return not this->_vertex_pred(vertex); }
+            );
+            return this->_graph->n_removed_vertices()
+                 + static_cast<types::size_type>(n_hidden_vertices);
+        }
+    }
+
+    // --- vertex methods ---
+
+    [[nodiscard]] auto vertices() const {
+        return std::views::filter(this->_graph->vertices(), [this](const vertex_type& vertex) {
+            return this->_is_visible(vertex);
+        });
+    }
+
+    [[nodiscard]] auto vertex_ids() const {
+        return std::views::transform(this->vertices(), [](const vertex_type& vertex) {
+            return vertex.id();
+        });
+    }
+
+    [[nodiscard]] const vertex_type& get_vertex(const types::id_type vertex_id) const {
+        const auto& vertex = this->_graph->get_vertex(vertex_id);
+        if (not this->_is_visible(vertex))
+            throw std::out_of_range(std::format("Got invalid vertex id [{}]", vertex_id));
+        return vertex;
+    }
+
+    [[nodiscard]] bool has_vertex(const types::id_type vertex_id) const {
+        return this->_graph->has_vertex(vertex_id)
+           and this->_is_visible(this->_graph->get_vertex(vertex_id));
+    }
+
+    [[nodiscard]] bool has_vertex(const vertex_type& vertex) const {
+        return this->_graph->has_vertex(vertex) and this->_is_visible(vertex);
+    }
+
+    // --- edge methods ---
+
+    [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        return this->_graph->has_edge(edge) and this->_is_visible(edge);
+    }
+
+    [[nodiscard]] auto adjacent_edges(const types::id_type vertex_id) const {
+        return std::views::filter(
+            this->_graph->adjacent_edges(this->get_vertex(vertex_id)),
+            [this](const edge_type& edge) { return this->_is_visible(edge); }
+        );
+    }
+
+    [[nodiscard]] gl_attr_force_inline auto adjacent_edges(const vertex_type& vertex) const {
+        return this->adjacent_edges(vertex.id());
+    }
+
+    // --- incidence methods ---
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const
+    requires(type_traits::is_directed_v<edge_type>)
+    {
+        std::vector<types::size_type> in_degree_map(this->n_vertices(), constants::zero);
+        for (const auto& vertex : this->vertices())
+            for (const auto& edge : this->adjacent_edges(vertex))
+                ++in_degree_map[edge.second_id()];
+        return in_degree_map;
+    }
+
+private:
+    [[nodiscard]] gl_attr_force_inline bool _is_visible(const vertex_type& vertex) const {
+        if constexpr (type_traits::c_no_filter<vertex_predicate_type>)
+            return true;
+        else
+            return this->_vertex_pred(vertex);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _is_visible(const edge_type& edge) const {
+        if constexpr (type_traits::c_no_filter<vertex_predicate_type>)
+            return this->_edge_pred(edge);
+        else
+            return this->_edge_pred(edge) and this->_vertex_pred(edge.first())
+               and this->_vertex_pred(edge.second());
+    }
+
+    const graph_type* _graph;
+    [[no_unique_address]] vertex_predicate_type _vertex_pred;
+    [[no_unique_address]] edge_predicate_type _edge_pred;
+};
+
+// --- graph view creation utility ---
+
+template <type_traits::c_graph GraphType>
+[[nodiscard]] gl_attr_force_inline graph_view<GraphType> make_view(const GraphType& graph) {
+    return graph_view<GraphType>{graph};
+}
+
+// creates a view with the vertices which satisfy the predicate (and the edges between them)
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_element_filter<typename GraphType::vertex_type> VertexPredicate>
+[[nodiscard]] gl_attr_force_inline graph_view<GraphType, VertexPredicate> filter_vertices(
+    const GraphType& graph, const VertexPredicate& vertex_pred
+) {
+    return graph_view<GraphType, VertexPredicate>{graph, vertex_pred};
+}
+
+// creates a view with all vertices and the edges which satisfy the predicate
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_element_filter<typename GraphType::edge_type> EdgePredicate>
+[[nodiscard]] gl_attr_force_inline graph_view<GraphType, no_filter, EdgePredicate> filter_edges(
+    const GraphType& graph, const EdgePredicate& edge_pred
+) {
+    return graph_view<GraphType, no_filter, EdgePredicate>{graph, {}, edge_pred};
+}
+
+template <
+    type_traits::c_graph GraphType,
+    type_traits::c_element_filter<typename GraphType::vertex_type> VertexPredicate,
+    type_traits::c_element_filter<typename GraphType::edge_type> EdgePredicate>
+[[nodiscard]] gl_attr_force_inline graph_view<GraphType, VertexPredicate, EdgePredicate> filter(
+    const GraphType& graph, const VertexPredicate& vertex_pred, const EdgePredicate& edge_pred
+) {
+    return graph_view<GraphType, VertexPredicate, EdgePredicate>{graph, vertex_pred, edge_pred};
+}
+
+} // namespace gl::inline gl_id_type_namespace
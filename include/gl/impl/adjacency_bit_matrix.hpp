@@ -0,0 +1,749 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/decl/impl_tags.hpp"
+#include "gl/io/format.hpp"
+#include "gl/types/iterator_range.hpp"
+#include "gl/types/types.hpp"
+#include "gl/util/compact.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+/*
+An adjacency matrix representation which stores a single bit per matrix cell.
+The rows of the matrix are stored in a single buffer and each row is padded to a multiple
+    of a cache line (64 bytes), so the edge queries and degree computations reduce to
+    bit tests and population counts of whole machine words.
+The edge descriptors are not stored - the `adjacent_edges` range yields temporary edges
+    bound to the vertices of the graph, so it should be iterated with `const auto&`
+    (or by value) and the addresses of the yielded edges must not be kept.
+The `add_edge` methods return the added edges by value as well. Only the edges returned
+    by `get_edge` are stored (in a synchronized cache), so their addresses remain stable
+    until the edges are removed.
+For directed graphs the in-degrees of the vertices are kept in per-vertex counters updated
+    on edge insertion and removal, so that the columns of the matrix do not have to be scanned.
+*/
+
+template <type_traits::c_bit_matrix_graph_traits GraphTraits>
+requires(type_traits::is_default_properties_type_v<typename GraphTraits::edge_properties_type>)
+class adjacency_bit_matrix final {
+public:
+    using vertex_type = typename GraphTraits::vertex_type;
+
+    using edge_type = typename GraphTraits::edge_type;
+    using edge_ptr_type = typename GraphTraits::edge_ptr_type;
+    using edge_directional_tag = typename GraphTraits::edge_directional_tag;
+
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_ptr_type>;
+    using degree_list_type = typename GraphTraits::template vector_type<types::size_type>;
+
+    class edge_iterator;
+    using edge_iterator_type = edge_iterator;
+
+    using word_type = std::uint64_t;
+
+    static constexpr types::size_type word_bits = std::numeric_limits<word_type>::digits;
+    static constexpr types::size_type row_alignment = 64ull; // bytes
+
+    adjacency_bit_matrix(const adjacency_bit_matrix&) = delete;
+    adjacency_bit_matrix& operator=(const adjacency_bit_matrix&) = delete;
+
+    adjacency_bit_matrix() = default;
+
+    explicit adjacency_bit_matrix(const allocator_type& allocator)
+    : _buffer(allocator), _vertices(allocator), _in_degrees(allocator), _edge_cache(allocator) {}
+
+    adjacency_bit_matrix(const types::size_type n_vertices, const allocator_type& allocator = {})
+    : adjacency_bit_matrix(allocator) {
+        this->add_vertices(n_vertices);
+    }
+
+    adjacency_bit_matrix(adjacency_bit_matrix&&) = default;
+    adjacency_bit_matrix& operator=(adjacency_bit_matrix&&) = default;
+
+    ~adjacency_bit_matrix() = default;
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_vertices.size();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_n_unique_edges;
+    }
+
+    // --- vertex methods ---
+
+    void add_vertex() {
+        this->_reserve(this->n_vertices() + constants::one);
+        this->_vertices.push_back(nullptr);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.push_back(constants::zero);
+    }
+
+    void add_vertices(const types::size_type n) {
+        this->_reserve(this->n_vertices() + n);
+        this->_vertices.resize(this->n_vertices() + n, nullptr);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(this->n_vertices(), constants::zero);
+    }
+
+    [[nodiscard]] types::size_type in_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_in_degrees[vertex_id];
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type out_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_row_popcount(vertex_id);
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            return this->in_degree(vertex_id) + this->out_degree(vertex_id);
+        }
+        else {
+            // loops are counted twice
+            return this->_row_popcount(vertex_id)
+                 + static_cast<types::size_type>(this->_test(vertex_id, vertex_id));
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return {this->_in_degrees.begin(), this->_in_degrees.end()};
+        else
+            return this->degree_map();
+    }
+
+    [[nodiscard]] std::vector<types::size_type> out_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> out_degree_map;
+            out_degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                out_degree_map.push_back(this->_row_popcount(id));
+            return out_degree_map;
+        }
+        else {
+            return this->degree_map();
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> degree_map = this->in_degree_map();
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map[id] += this->_row_popcount(id);
+            return degree_map;
+        }
+        else {
+            std::vector<types::size_type> degree_map;
+            degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map.push_back(this->degree(id));
+            return degree_map;
+        }
+    }
+
+    void remove_vertex(const vertex_type& vertex) {
+        const auto vertex_id = vertex.id();
+        const auto n_words = this->_n_row_words();
+
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            // loops are both incoming and outgoing edges
+            const auto is_loop = static_cast<types::size_type>(this->_test(vertex_id, vertex_id));
+            this->_n_unique_edges -=
+                this->in_degree(vertex_id) + this->out_degree(vertex_id) - is_loop;
+
+            this->_for_each_set_bit(vertex_id, [this](const types::id_type target_id) {
+                --this->_in_degrees[target_id];
+            });
+            this->_in_degrees.erase(std::next(this->_in_degrees.begin(), vertex_id));
+        }
+        else {
+            this->_n_unique_edges -= this->_row_popcount(vertex_id);
+        }
+
+        // shift the rows following the removed one and clear the last row
+        std::copy(
+            this->_row(vertex_id + constants::one),
+            this->_row(this->n_vertices()),
+            this->_row(vertex_id)
+        );
+        std::fill_n(this->_row(this->n_vertices() - constants::one), n_words, word_type{0});
+
+        this->_vertices.erase(std::next(this->_vertices.begin(), vertex_id));
+
+        for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+            _erase_column(this->_row(id), vertex_id, n_words);
+
+        // drop the cached edges incident with the removed vertex and shift the remaining cells
+        const auto shift = [vertex_id](const types::id_type id) {
+            return id > vertex_id ? id - constants::one : id;
+        };
+
+        this->_edge_cache.remap([vertex_id, &shift](const cell_type& cell) {
+            return cell.first == vertex_id or cell.second == vertex_id
+                     ? std::nullopt
+                     : std::make_optional(cell_type{shift(cell.first), shift(cell.second)});
+        });
+    }
+
+    void remove_vertices(const std::vector<bool>& removed) {
+        const auto new_ids = util::compacted_ids(removed);
+        const auto n_words = this->_n_row_words();
+
+        for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id) {
+            this->_for_each_set_bit(id, [this, id, &removed](const types::id_type target_id) {
+                // undirected edges are set in both of their cells
+                if constexpr (type_traits::is_undirected_v<edge_type>)
+                    if (target_id > id)
+                        return;
+
+                if (removed[id] or removed[target_id])
+                    --this->_n_unique_edges;
+            });
+        }
+
+        // the in-degrees are recounted while the rows are compacted
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.assign(this->n_vertices(), constants::zero);
+
+        // move the compacted rows of the remaining vertices to their new positions
+        std::vector<word_type> compacted_row(n_words);
+        for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id) {
+            if (removed[id])
+                continue;
+
+            std::ranges::fill(compacted_row, word_type{0});
+            this->_for_each_set_bit(id, [&](const types::id_type target_id) {
+                if (removed[target_id])
+                    return;
+
+                const auto new_target_id = new_ids[target_id];
+                compacted_row[new_target_id / word_bits] |= this->_mask(new_target_id);
+                if constexpr (type_traits::is_directed_v<edge_type>)
+                    ++this->_in_degrees[new_target_id];
+            });
+            std::ranges::copy(compacted_row, this->_row(new_ids[id]));
+        }
+
+        util::compact(this->_vertices, removed);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(this->n_vertices());
+        for (types::size_type id = this->n_vertices(); id < removed.size(); ++id)
+            std::fill_n(this->_row(id), n_words, word_type{0});
+
+        this->_edge_cache.remap([&removed, &new_ids](const cell_type& cell) {
+            return removed[cell.first] or removed[cell.second]
+                     ? std::nullopt
+                     : std::make_optional(cell_type{new_ids[cell.first], new_ids[cell.second]});
+        });
+    }
+
+    // removes all edges incident with the given vertex without changing the vertex ids
+    void remove_incident_edges(const types::id_type vertex_id) {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            // loops are both incoming and outgoing edges
+            const auto is_loop = static_cast<types::size_type>(this->_test(vertex_id, vertex_id));
+            this->_n_unique_edges -= this->degree(vertex_id) - is_loop;
+
+            this->_for_each_set_bit(vertex_id, [this](const types::id_type target_id) {
+                --this->_in_degrees[target_id];
+            });
+            if (this->_in_degrees[vertex_id] != constants::zero)
+                for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                    this->_reset(id, vertex_id);
+            this->_in_degrees[vertex_id] = constants::zero;
+        }
+        else {
+            this->_n_unique_edges -= this->_row_popcount(vertex_id);
+            this->_for_each_set_bit(vertex_id, [this, vertex_id](const types::id_type target_id) {
+                this->_reset(target_id, vertex_id);
+            });
+        }
+        std::fill_n(this->_row(vertex_id), this->_n_row_words(), word_type{0});
+
+        this->_edge_cache.remap([vertex_id](const cell_type& cell) {
+            return cell.first == vertex_id or cell.second == vertex_id
+                     ? std::nullopt
+                     : std::make_optional(cell);
+        });
+    }
+
+    // --- edge methods ---
+
+    // only the adjacency bits are stored - the added edge is returned by value
+    edge_type add_edge(const vertex_type& first, const vertex_type& second) {
+        this->_check_edge_override(first.id(), second.id());
+        this->_set_edge_bits(first, second);
+        ++this->_n_unique_edges;
+        return edge_type{first, second};
+    }
+
+    gl_attr_force_inline edge_type add_edge(edge_ptr_type edge) {
+        return this->add_edge(edge->first(), edge->second());
+    }
+
+    gl_attr_force_inline void add_edges_from(
+        [[maybe_unused]] const types::id_type source_id, std::vector<edge_ptr_type> new_edges
+    ) {
+        this->add_edges(std::move(new_edges));
+    }
+
+    void add_edges(std::vector<edge_ptr_type> new_edges) {
+        this->_check_new_edges(new_edges);
+
+        // only the adjacency bits are stored
+        for (const auto& edge : new_edges)
+            this->_set_edge_bits(edge->first(), edge->second());
+
+        this->_n_unique_edges += new_edges.size();
+    }
+
+    [[nodiscard]] bool has_edge(const types::id_type first_id, const types::id_type second_id)
+        const {
+        return this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)
+           and this->_test(first_id, second_id);
+    }
+
+    [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        const auto [first_id, second_id] = edge.incident_vertex_ids();
+        return this->has_edge(first_id, second_id) and this->_vertices[first_id] == &edge.first()
+           and this->_vertices[second_id] == &edge.second();
+    }
+
+    [[nodiscard]] types::optional_ref<const edge_type> get_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        if (not this->has_edge(first_id, second_id))
+            return std::nullopt;
+        return std::cref(this->_materialize(first_id, second_id));
+    }
+
+    void remove_edge(const edge_type& edge) {
+        if (not this->has_edge(edge))
+            throw std::invalid_argument(std::format(
+                "Got invalid edge [vertices = ({}, {}) | addr = {}]",
+                edge.first_id(),
+                edge.second_id(),
+                io::format(&edge)
+            ));
+
+        const auto [first_id, second_id] = edge.incident_vertex_ids();
+
+        this->_reset(first_id, second_id);
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            this->_reset(second_id, first_id);
+        else
+            --this->_in_degrees[second_id];
+
+        --this->_n_unique_edges;
+        this->_edge_cache.erase(this->_cell(first_id, second_id)); // releases the cached edge
+    }
+
+    [[nodiscard]] types::iterator_range<edge_iterator_type> adjacent_edges(
+        const types::id_type vertex_id
+    ) const {
+        return make_iterator_range(
+            edge_iterator_type{this, vertex_id, this->_next_set_bit(vertex_id, constants::zero)},
+            edge_iterator_type{this, vertex_id, this->_n_vertex_ids()}
+        );
+    }
+
+    // --- bit matrix specific methods ---
+
+    /*
+    Returns the number of words in each row of the underlying buffer.
+    The rows are padded with unset bits to a multiple of `row_alignment` bytes.
+    */
+    [[nodiscard]] gl_attr_force_inline types::size_type row_stride() const {
+        return this->_row_stride;
+    }
+
+    [[nodiscard]] gl_attr_force_inline const word_type* row_data(const types::id_type vertex_id
+    ) const {
+        return this->_row(vertex_id);
+    }
+
+    /*
+    A forward iterator yielding temporary edges which connect the given vertex with
+        its consecutive neighbors. The edges of undirected graphs are oriented so that
+        their first vertex is the one with the smaller id.
+    */
+    class edge_iterator {
+    public:
+        using value_type = edge_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = edge_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        edge_iterator() = default;
+
+        edge_iterator(
+            const adjacency_bit_matrix* matrix,
+            const types::id_type row_id,
+            const types::id_type column_id
+        )
+        : _matrix(matrix), _row_id(row_id), _column_id(column_id) {}
+
+        [[nodiscard]] gl_attr_force_inline reference operator*() const {
+            const auto [first_id, second_id] =
+                this->_matrix->_cell(this->_row_id, this->_column_id);
+            return this->_matrix->_make_edge(first_id, second_id);
+        }
+
+        gl_attr_force_inline edge_iterator& operator++() {
+            this->_column_id = this->_matrix->_next_set_bit(
+                this->_row_id, this->_column_id + constants::one
+            );
+            return *this;
+        }
+
+        gl_attr_force_inline edge_iterator operator++(int) {
+            edge_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(const edge_iterator&) const = default;
+
+    private:
+        const adjacency_bit_matrix* _matrix = nullptr;
+        types::id_type _row_id = constants::initial_id;
+        types::id_type _column_id = constants::initial_id;
+    };
+
+private:
+    using cell_type = types::homogeneous_pair<types::id_type>;
+
+    struct cell_hash {
+        [[nodiscard]] gl_attr_force_inline std::size_t operator()(const cell_type& cell) const {
+            const std::hash<types::id_type> hash{};
+            return hash(cell.first) ^ (hash(cell.second) * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
+    /*
+    The edges returned by `get_edge`, stored in the nodes of a hash map
+        so that their addresses are stable. The cache is synchronized, because the edges
+        are materialized by the const `get_edge` method.
+    */
+    class edge_cache {
+    public:
+        using map_type = std::unordered_map<
+            cell_type,
+            edge_type,
+            cell_hash,
+            std::equal_to<cell_type>,
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<
+                std::pair<const cell_type, edge_type>>>;
+
+        edge_cache() = default;
+
+        explicit edge_cache(const allocator_type& allocator) : _edges(allocator) {}
+
+        edge_cache(edge_cache&& other) : _edges(std::move(other._edges)) {}
+
+        // the nodes are moved with their allocator, so the addresses of the edges are stable
+        // (the move assignment of maps with different memory resources would relocate them)
+        edge_cache& operator=(edge_cache&& other) {
+            if (this != &other) {
+                std::destroy_at(&this->_edges);
+                std::construct_at(&this->_edges, std::move(other._edges));
+            }
+            return *this;
+        }
+
+        ~edge_cache() = default;
+
+        const edge_type& get_or_emplace(
+            const cell_type& cell, const vertex_type& first, const vertex_type& second
+        ) {
+            std::lock_guard<std::mutex> lock{this->_mutex};
+            return this->_edges.try_emplace(cell, first, second).first->second;
+        }
+
+        void erase(const cell_type& cell) {
+            std::lock_guard<std::mutex> lock{this->_mutex};
+            this->_edges.erase(cell);
+        }
+
+        // moves the cached edges to the returned cells (dropping the edges mapped to nullopt)
+        template <typename F>
+        void remap(const F& new_cell) {
+            std::lock_guard<std::mutex> lock{this->_mutex};
+
+            // the nodes can only be moved between maps with equal allocators
+            map_type edges(this->_edges.get_allocator());
+            edges.reserve(this->_edges.size());
+            while (not this->_edges.empty()) {
+                // the extracted nodes are reinserted, so the edge addresses remain stable
+                auto node = this->_edges.extract(this->_edges.begin());
+                if (const auto cell = new_cell(node.key()); cell.has_value()) {
+                    node.key() = *cell;
+                    edges.insert(std::move(node));
+                }
+            }
+            this->_edges = std::move(edges);
+        }
+
+    private:
+        map_type _edges{};
+        std::mutex _mutex;
+    };
+
+    /*
+    The buffer is over-allocated by the row alignment, so that the rows can start at
+        an aligned offset regardless of the alignment guaranteed by the allocator.
+    */
+    using buffer_type = typename GraphTraits::template vector_type<word_type>;
+
+    static constexpr types::size_type _row_alignment_words = row_alignment / sizeof(word_type);
+
+    [[nodiscard]] gl_attr_force_inline static types::size_type _n_words(const types::size_type n
+    ) {
+        return (n + word_bits - constants::one) / word_bits;
+    }
+
+    [[nodiscard]] gl_attr_force_inline static types::size_type _aligned_stride(
+        const types::size_type n
+    ) {
+        const auto n_words = _n_words(n);
+        return ((n_words + _row_alignment_words - constants::one) / _row_alignment_words)
+             * _row_alignment_words;
+    }
+
+    static void _erase_column(
+        word_type* row, const types::id_type column_id, const types::size_type n_words
+    ) {
+        // remove the column bit and shift all following bits of the row by one position
+        auto& word = row[column_id / word_bits];
+        const word_type low_mask = (word_type{1} << (column_id % word_bits)) - word_type{1};
+        word = (word & low_mask) | ((word >> constants::one) & ~low_mask);
+
+        for (auto i = column_id / word_bits; i + constants::one < n_words; ++i) {
+            row[i] |= row[i + constants::one] << (word_bits - constants::one);
+            row[i + constants::one] >>= constants::one;
+        }
+    }
+
+    // the number of words preceding the first row-aligned word of the buffer
+    [[nodiscard]] static types::size_type _aligned_offset(const word_type* data) {
+        const auto misalignment = reinterpret_cast<std::uintptr_t>(data) % row_alignment;
+        return misalignment == 0 ? 0 : (row_alignment - misalignment) / sizeof(word_type);
+    }
+
+    void _reserve(const types::size_type n_vertices) {
+        if (n_vertices <= this->_capacity)
+            return;
+
+        const auto capacity = std::max(n_vertices, constants::two * this->_capacity);
+        const auto row_stride = _aligned_stride(capacity);
+        const auto buffer_size = capacity * row_stride;
+
+        buffer_type buffer(
+            buffer_size + _row_alignment_words - constants::one,
+            word_type{0},
+            this->_buffer.get_allocator()
+        );
+        const auto offset = _aligned_offset(buffer.data());
+
+        for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+            std::copy_n(
+                this->_row(id), this->_row_stride, buffer.data() + offset + id * row_stride
+            );
+
+        // the buffer has the same allocator, so the moved data (and its alignment) is preserved
+        this->_buffer = std::move(buffer);
+        this->_buffer_offset = offset;
+        this->_capacity = capacity;
+        this->_row_stride = row_stride;
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _is_valid_vertex_id(const types::id_type vertex_id
+    ) const {
+        return vertex_id < this->n_vertices();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type _n_row_words() const {
+        return _n_words(this->n_vertices());
+    }
+
+    // the number of vertices as an id (the past-the-end column id)
+    [[nodiscard]] gl_attr_force_inline types::id_type _n_vertex_ids() const {
+        return static_cast<types::id_type>(this->n_vertices());
+    }
+
+    [[nodiscard]] gl_attr_force_inline word_type* _row(const types::size_type row_idx) {
+        return this->_buffer.data() + this->_buffer_offset + row_idx * this->_row_stride;
+    }
+
+    [[nodiscard]] gl_attr_force_inline const word_type* _row(const types::size_type row_idx
+    ) const {
+        return this->_buffer.data() + this->_buffer_offset + row_idx * this->_row_stride;
+    }
+
+    [[nodiscard]] gl_attr_force_inline word_type _mask(const types::id_type column_id) const {
+        return word_type{1} << (column_id % word_bits);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _test(
+        const types::id_type row_id, const types::id_type column_id
+    ) const {
+        return (this->_row(row_id)[column_id / word_bits] & this->_mask(column_id)) != 0;
+    }
+
+    gl_attr_force_inline void _set(const types::id_type row_id, const types::id_type column_id) {
+        this->_row(row_id)[column_id / word_bits] |= this->_mask(column_id);
+    }
+
+    gl_attr_force_inline void _reset(const types::id_type row_id, const types::id_type column_id) {
+        this->_row(row_id)[column_id / word_bits] &= ~this->_mask(column_id);
+    }
+
+    [[nodiscard]] types::size_type _row_popcount(const types::id_type vertex_id) const {
+        const auto* row = this->_row(vertex_id);
+        types::size_type popcount = constants::default_size;
+        for (types::size_type i = constants::begin_idx; i < this->_n_row_words(); ++i)
+            popcount += static_cast<types::size_type>(std::popcount(row[i]));
+        return popcount;
+    }
+
+    [[nodiscard]] types::id_type _next_set_bit(
+        const types::id_type row_id, const types::id_type column_id
+    ) const {
+        // the bits beyond the last vertex column are always unset
+        const auto n_words = this->_n_row_words();
+        auto word_idx = column_id / word_bits;
+        if (word_idx >= n_words)
+            return this->_n_vertex_ids();
+
+        const auto* row = this->_row(row_id);
+        word_type word = row[word_idx] & (~word_type{0} << (column_id % word_bits));
+        while (word == 0) {
+            if (++word_idx == n_words)
+                return this->_n_vertex_ids();
+            word = row[word_idx];
+        }
+
+        return static_cast<types::id_type>(word_idx * word_bits + std::countr_zero(word));
+    }
+
+    template <typename F>
+    void _for_each_set_bit(const types::id_type row_id, const F& f) const {
+        const auto* row = this->_row(row_id);
+        for (types::size_type i = constants::begin_idx; i < this->_n_row_words(); ++i) {
+            for (word_type word = row[i]; word != 0; word &= word - word_type{1})
+                f(static_cast<types::id_type>(i * word_bits + std::countr_zero(word)));
+        }
+    }
+
+    [[nodiscard]] gl_attr_force_inline cell_type _cell(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        // undirected edges are cached once for both orientations of the cell
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            return std::minmax(first_id, second_id);
+        else
+            return cell_type{first_id, second_id};
+    }
+
+    void _check_edge_override(const types::id_type first_id, const types::id_type second_id)
+        const {
+        if (this->has_edge(first_id, second_id))
+            throw std::logic_error(std::format(
+                "Cannot override an existing edge without remove: ({}, {})", first_id, second_id
+            ));
+    }
+
+    // validates the new edges against the existing edges and against each other
+    void _check_new_edges(const std::vector<edge_ptr_type>& new_edges) const {
+        std::vector<cell_type> new_cells;
+        new_cells.reserve(new_edges.size());
+
+        for (const auto& edge : new_edges) {
+            this->_check_edge_override(edge->first_id(), edge->second_id());
+            new_cells.push_back(this->_cell(edge->first_id(), edge->second_id()));
+        }
+
+        std::ranges::sort(new_cells);
+        const auto duplicate_it = std::ranges::adjacent_find(new_cells);
+        if (duplicate_it != new_cells.end())
+            throw std::logic_error(std::format(
+                "Cannot override an existing edge without remove: ({}, {})",
+                duplicate_it->first,
+                duplicate_it->second
+            ));
+    }
+
+    void _set_edge_bits(const vertex_type& first, const vertex_type& second) {
+        const auto first_id = first.id();
+        const auto second_id = second.id();
+
+        this->_vertices[first_id] = &first;
+        this->_vertices[second_id] = &second;
+
+        this->_set(first_id, second_id);
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            this->_set(second_id, first_id);
+        else
+            ++this->_in_degrees[second_id];
+    }
+
+    [[nodiscard]] gl_attr_force_inline edge_type _make_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return edge_type{*this->_vertices[first_id], *this->_vertices[second_id]};
+    }
+
+    // returns the cached edge of the cell (the edge is created if it is not cached yet)
+    const edge_type& _materialize(const types::id_type first_id, const types::id_type second_id)
+        const {
+        return this->_edge_cache.get_or_emplace(
+            this->_cell(first_id, second_id),
+            *this->_vertices[first_id],
+            *this->_vertices[second_id]
+        );
+    }
+
+    buffer_type _buffer{};
+    types::size_type _buffer_offset = constants::default_size;
+    types::size_type _capacity = constants::default_size;
+    types::size_type _row_stride = constants::default_size;
+
+    // the addresses of the vertices are taken from the added edges
+    typename GraphTraits::template vector_type<const vertex_type*> _vertices{};
+    degree_list_type _in_degrees{}; // used only by directed graphs
+
+    mutable edge_cache _edge_cache{};
+    types::size_type _n_unique_edges = constants::default_size;
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
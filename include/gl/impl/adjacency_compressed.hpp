@@ -0,0 +1,582 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/decl/impl_tags.hpp"
+#include "gl/types/iterator_range.hpp"
+#include "gl/types/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+/*
+An immutable, read-optimized representation of a graph in which the sorted neighbor list
+    of each vertex is stored as a sequence of gap-encoded varints (LEB128) in a single
+    byte buffer: the first value of a list is the id of the smallest neighbor and each
+    following value is the difference between the consecutive neighbor ids.
+The neighbors of the vertex `v` occupy the bytes [offsets[v], offsets[v + 1]) of the buffer.
+For undirected graphs each edge is encoded in the lists of both of its incident vertices
+    (a loop is encoded only once).
+For directed graphs the in-degrees of the vertices are counted once while the structure
+    is built, so that they can be read in constant time.
+The edge descriptors are not stored - the `adjacent_edges` range decodes the neighbor lists
+    and yields temporary edges bound to the vertices of the graph, so it should be iterated
+    with `const auto&` (or by value) and the addresses of the yielded edges must not be kept.
+The edges returned by `get_edge` and `get_edges` are materialized lazily and stored
+    in a synchronized cache, so their addresses remain stable for the lifetime of the graph
+    and the graph can be read from multiple threads.
+*/
+
+template <type_traits::c_compressed_graph_traits GraphTraits>
+requires(type_traits::is_default_properties_type_v<typename GraphTraits::edge_properties_type>)
+class adjacency_compressed final {
+public:
+    using vertex_type = typename GraphTraits::vertex_type;
+
+    using edge_type = typename GraphTraits::edge_type;
+    using edge_ptr_type = typename GraphTraits::edge_ptr_type;
+    using edge_storage_type = typename GraphTraits::edge_storage_type;
+    using edge_directional_tag = typename GraphTraits::edge_directional_tag;
+
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_ptr_type>;
+
+    class neighbor_id_iterator;
+    class edge_iterator;
+    using edge_iterator_type = edge_iterator;
+
+    using byte_type = std::uint8_t;
+    using offset_list_type = typename GraphTraits::template vector_type<types::size_type>;
+    using data_type = typename GraphTraits::template vector_type<byte_type>;
+    using degree_list_type = typename GraphTraits::template vector_type<types::size_type>;
+
+    adjacency_compressed(const adjacency_compressed&) = delete;
+    adjacency_compressed& operator=(const adjacency_compressed&) = delete;
+
+    adjacency_compressed() : adjacency_compressed(allocator_type{}) {}
+
+    explicit adjacency_compressed(const allocator_type& allocator)
+    : _offsets(constants::one, constants::zero, allocator),
+      _data(allocator),
+      _vertices(allocator),
+      _in_degrees(allocator),
+      _edge_cache(allocator) {}
+
+    adjacency_compressed(const types::size_type n_vertices, const allocator_type& allocator = {})
+    : adjacency_compressed(allocator) {
+        this->_offsets.resize(n_vertices + constants::one, constants::zero);
+        this->_vertices.resize(n_vertices, nullptr);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(n_vertices, constants::zero);
+    }
+
+    /*
+    Builds the compressed structure from any graph implementation.
+    The `get_vertex` callable should return the vertex (owned by the target graph)
+        with the given id, to which the decoded edges will be bound.
+    The callable is invoked only for the vertices with incident edges.
+    */
+    template <typename SourceImpl, typename VertexGetter>
+    requires std::is_invocable_r_v<const vertex_type&, VertexGetter, types::id_type>
+    adjacency_compressed(
+        const SourceImpl& source,
+        const VertexGetter& get_vertex,
+        const allocator_type& allocator = {}
+    )
+    : adjacency_compressed(allocator) {
+        const auto n_vertices = source.n_vertices();
+        this->_n_unique_edges = source.n_unique_edges();
+
+        this->_offsets.reserve(n_vertices + constants::one);
+
+        this->_vertices.assign(n_vertices, nullptr);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.assign(n_vertices, constants::zero);
+
+        std::vector<types::id_type> neighbor_ids;
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < n_vertices;
+             ++vertex_id) {
+            neighbor_ids.clear();
+            for (const auto& edge : source.adjacent_edges(vertex_id))
+                neighbor_ids.push_back(edge.incident_vertex_id(vertex_id));
+            std::ranges::sort(neighbor_ids);
+
+            if (not neighbor_ids.empty())
+                this->_vertices[vertex_id] = &get_vertex(vertex_id);
+
+            types::id_type prev_id = constants::initial_id;
+            for (const auto neighbor_id : neighbor_ids) {
+                if (this->_vertices[neighbor_id] == nullptr)
+                    this->_vertices[neighbor_id] = &get_vertex(neighbor_id);
+                _encode(this->_data, neighbor_id - prev_id);
+                prev_id = neighbor_id;
+
+                if constexpr (type_traits::is_directed_v<edge_type>)
+                    ++this->_in_degrees[neighbor_id];
+            }
+            this->_offsets.push_back(this->_data.size());
+        }
+
+        this->_data.shrink_to_fit();
+    }
+
+    adjacency_compressed(adjacency_compressed&&) = default;
+    adjacency_compressed& operator=(adjacency_compressed&&) = default;
+
+    ~adjacency_compressed() = default;
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_offsets.size() - constants::one;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_n_unique_edges;
+    }
+
+    // --- vertex methods ---
+
+    [[nodiscard]] types::size_type in_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_in_degrees[vertex_id];
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type out_degree(const types::id_type vertex_id
+    ) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_n_neighbors(vertex_id);
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->in_degree(vertex_id) + this->out_degree(vertex_id);
+        else
+            // loops are encoded once but counted twice
+            return this->_n_neighbors(vertex_id) + this->_count_neighbor(vertex_id, vertex_id);
+    }
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return {this->_in_degrees.begin(), this->_in_degrees.end()};
+        else
+            return this->degree_map();
+    }
+
+    [[nodiscard]] std::vector<types::size_type> out_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> out_degree_map;
+            out_degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                out_degree_map.push_back(this->_n_neighbors(id));
+            return out_degree_map;
+        }
+        else {
+            return this->degree_map();
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> degree_map = this->in_degree_map();
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map[id] += this->_n_neighbors(id);
+            return degree_map;
+        }
+        else {
+            std::vector<types::size_type> degree_map;
+            degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map.push_back(this->degree(id));
+            return degree_map;
+        }
+    }
+
+    // --- edge methods ---
+
+    [[nodiscard]] bool has_edge(const types::id_type first_id, const types::id_type second_id)
+        const {
+        return this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)
+           and this->_count_neighbor(first_id, second_id) > constants::zero;
+    }
+
+    [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        const auto [first_id, second_id] = edge.incident_vertex_ids();
+        return this->has_edge(first_id, second_id) and this->_vertices[first_id] == &edge.first()
+           and this->_vertices[second_id] == &edge.second();
+    }
+
+    [[nodiscard]] types::optional_ref<const edge_type> get_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        if (not this->has_edge(first_id, second_id))
+            return std::nullopt;
+        return this->_materialize(first_id, second_id, constants::one).front();
+    }
+
+    [[nodiscard]] std::vector<types::const_ref_wrap<edge_type>> get_edges(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        using edge_ref_set = std::vector<types::const_ref_wrap<edge_type>>;
+
+        if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
+            return edge_ref_set{};
+
+        const auto n_edges = this->_count_neighbor(first_id, second_id);
+        if (n_edges == constants::zero)
+            return edge_ref_set{};
+
+        return this->_materialize(first_id, second_id, n_edges);
+    }
+
+    [[nodiscard]] types::iterator_range<edge_iterator_type> adjacent_edges(
+        const types::id_type vertex_id
+    ) const {
+        const auto neighbor_ids = this->neighbor_ids(vertex_id);
+        return make_iterator_range(
+            edge_iterator_type{this, vertex_id, neighbor_ids.begin()},
+            edge_iterator_type{this, vertex_id, neighbor_ids.end()}
+        );
+    }
+
+    // returns the sorted ids of the vertices adjacent to both given vertices
+    [[nodiscard]] std::vector<types::id_type> common_neighbors(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        const auto first_neighbor_ids = this->neighbor_ids(first_id);
+        const auto second_neighbor_ids = this->neighbor_ids(second_id);
+
+        std::vector<types::id_type> common_neighbor_ids;
+        std::ranges::set_intersection(
+            first_neighbor_ids, second_neighbor_ids, std::back_inserter(common_neighbor_ids)
+        );
+
+        // parallel edges produce repeated ids
+        const auto duplicates = std::ranges::unique(common_neighbor_ids);
+        common_neighbor_ids.erase(duplicates.begin(), duplicates.end());
+        return common_neighbor_ids;
+    }
+
+    // --- compressed specific methods ---
+
+    // returns the range decoding the sorted ids of the neighbors of the given vertex
+    [[nodiscard]] types::iterator_range<neighbor_id_iterator> neighbor_ids(
+        const types::id_type vertex_id
+    ) const {
+        const auto* begin = this->_data.data() + this->_offsets[vertex_id];
+        const auto* end = this->_data.data() + this->_offsets[vertex_id + constants::one];
+        return make_iterator_range(neighbor_id_iterator{begin, end}, neighbor_id_iterator{end});
+    }
+
+    [[nodiscard]] gl_attr_force_inline const offset_list_type& offsets() const {
+        return this->_offsets;
+    }
+
+    [[nodiscard]] gl_attr_force_inline const data_type& data() const {
+        return this->_data;
+    }
+
+    /*
+    A forward iterator decoding a gap-encoded neighbor list.
+    The dereference operator returns the decoded id by value.
+    */
+    class neighbor_id_iterator {
+    public:
+        using value_type = types::id_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = types::id_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        neighbor_id_iterator() = default;
+
+        // creates an end iterator
+        explicit neighbor_id_iterator(const byte_type* end) : _current(end), _next(end), _end(end) {}
+
+        neighbor_id_iterator(const byte_type* begin, const byte_type* end)
+        : _current(begin), _next(begin), _end(end) {
+            if (this->_current != this->_end)
+                this->_neighbor_id = _decode(this->_next);
+        }
+
+        [[nodiscard]] gl_attr_force_inline reference operator*() const {
+            return this->_neighbor_id;
+        }
+
+        gl_attr_force_inline neighbor_id_iterator& operator++() {
+            this->_current = this->_next;
+            if (this->_current != this->_end)
+                this->_neighbor_id += _decode(this->_next);
+            return *this;
+        }
+
+        gl_attr_force_inline neighbor_id_iterator operator++(int) {
+            neighbor_id_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] gl_attr_force_inline bool operator==(const neighbor_id_iterator& other
+        ) const {
+            return this->_current == other._current;
+        }
+
+    private:
+        const byte_type* _current = nullptr; // the position of the current value
+        const byte_type* _next = nullptr; // the position of the next value
+        const byte_type* _end = nullptr;
+        types::id_type _neighbor_id = constants::initial_id;
+    };
+
+    /*
+    A forward iterator yielding temporary edges which connect the given vertex with
+        its consecutive neighbors. The edges of undirected graphs are oriented so that
+        their first vertex is the one with the smaller id.
+    */
+    class edge_iterator {
+    public:
+        using value_type = edge_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = edge_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        edge_iterator() = default;
+
+        edge_iterator(
+            const adjacency_compressed* impl,
+            const types::id_type vertex_id,
+            const neighbor_id_iterator it
+        )
+        : _impl(impl), _vertex_id(vertex_id), _it(it) {}
+
+        [[nodiscard]] gl_attr_force_inline reference operator*() const {
+            const auto neighbor_id = *this->_it;
+            if constexpr (type_traits::is_directed_v<edge_type>) {
+                return this->_impl->_make_edge(this->_vertex_id, neighbor_id);
+            }
+            else {
+                const auto [first_id, second_id] = std::minmax(this->_vertex_id, neighbor_id);
+                return this->_impl->_make_edge(first_id, second_id);
+            }
+        }
+
+        gl_attr_force_inline edge_iterator& operator++() {
+            ++this->_it;
+            return *this;
+        }
+
+        gl_attr_force_inline edge_iterator operator++(int) {
+            edge_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] gl_attr_force_inline bool operator==(const edge_iterator& other) const {
+            return this->_it == other._it;
+        }
+
+    private:
+        const adjacency_compressed* _impl = nullptr;
+        types::id_type _vertex_id = constants::initial_id;
+        neighbor_id_iterator _it{};
+    };
+
+private:
+    using cell_type = types::homogeneous_pair<types::id_type>;
+
+    struct cell_hash {
+        [[nodiscard]] gl_attr_force_inline std::size_t operator()(const cell_type& cell) const {
+            const std::hash<types::id_type> hash{};
+            return hash(cell.first) ^ (hash(cell.second) * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
+    // the edges of a pmr graph are allocated from the resource of its allocator
+    [[nodiscard]] static edge_storage_type _make_edge_storage(const allocator_type& allocator) {
+        if constexpr (std::constructible_from<edge_storage_type, std::pmr::memory_resource*>
+                      and requires { allocator.resource(); })
+            return edge_storage_type{allocator.resource()};
+        else
+            return edge_storage_type{};
+    }
+
+    /*
+    The edges returned by `get_edge` and `get_edges`, grouped by their cells.
+    The cache is synchronized, because the edges are materialized by the const methods
+        of the graph, which can be called concurrently.
+    */
+    class edge_cache {
+    public:
+        using edge_ref_list_type = std::vector<types::const_ref_wrap<edge_type>>;
+
+        using map_type = std::unordered_map<
+            cell_type,
+            edge_list_type,
+            cell_hash,
+            std::equal_to<cell_type>,
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<
+                std::pair<const cell_type, edge_list_type>>>;
+
+        edge_cache() = default;
+
+        explicit edge_cache(const allocator_type& allocator)
+        : _edge_storage(_make_edge_storage(allocator)), _edges(allocator) {}
+
+        // the mutex is not moved - the cache must not be accessed while being moved
+        edge_cache(edge_cache&& other)
+        : _edge_storage(std::move(other._edge_storage)), _edges(std::move(other._edges)) {}
+
+        edge_cache& operator=(edge_cache&& other) {
+            if (this != &other) {
+                this->_edge_storage = std::move(other._edge_storage);
+                this->_edges = std::move(other._edges);
+            }
+            return *this;
+        }
+
+        ~edge_cache() = default;
+
+        // returns the first `n_edges` cached edges of the cell (creating the missing ones)
+        [[nodiscard]] edge_ref_list_type get_or_make(
+            const cell_type& cell,
+            const vertex_type& first,
+            const vertex_type& second,
+            const types::size_type n_edges
+        ) {
+            std::lock_guard<std::mutex> lock{this->_mutex};
+
+            auto& edges = this->_edges[cell];
+            while (edges.size() < n_edges)
+                edges.push_back(this->_edge_storage.make(first, second));
+
+            // the references are collected under the lock, because the list can be extended
+            edge_ref_list_type edge_refs;
+            edge_refs.reserve(n_edges);
+            for (types::size_type i = constants::begin_idx; i < n_edges; ++i)
+                edge_refs.push_back(std::cref(*edges[i]));
+            return edge_refs;
+        }
+
+    private:
+        edge_storage_type _edge_storage{};
+        map_type _edges{};
+        std::mutex _mutex;
+    };
+
+    static constexpr byte_type _payload_mask = 0x7fu;
+    static constexpr byte_type _continuation_bit = 0x80u;
+    static constexpr types::size_type _payload_bits = 7ull;
+
+    // the continuation bits of all bytes of a word
+    static constexpr std::uint64_t _continuation_mask = 0x8080808080808080ull;
+
+    static void _encode(data_type& data, types::id_type value) {
+        while (value >= _continuation_bit) {
+            data.push_back(static_cast<byte_type>(value | _continuation_bit));
+            value >>= _payload_bits;
+        }
+        data.push_back(static_cast<byte_type>(value));
+    }
+
+    [[nodiscard]] gl_attr_force_inline static types::id_type _decode(const byte_type*& it) {
+        byte_type byte = *it++;
+        types::id_type value = byte & _payload_mask;
+        for (types::size_type shift = _payload_bits; byte & _continuation_bit;
+             shift += _payload_bits) {
+            byte = *it++;
+            value |= static_cast<types::id_type>(byte & _payload_mask) << shift;
+        }
+        return value;
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _is_valid_vertex_id(const types::id_type vertex_id
+    ) const {
+        return vertex_id < this->n_vertices();
+    }
+
+    // the number of encoded values is equal to the number of their last bytes (without the
+    // continuation bit), which are counted a whole word at a time
+    [[nodiscard]] types::size_type _n_neighbors(const types::id_type vertex_id) const {
+        const auto* it = this->_data.data() + this->_offsets[vertex_id];
+        const auto* end = this->_data.data() + this->_offsets[vertex_id + constants::one];
+
+        types::size_type n_continuation_bytes = constants::default_size;
+        for (; end - it >= static_cast<std::ptrdiff_t>(sizeof(std::uint64_t));
+             it += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, it, sizeof(std::uint64_t));
+            n_continuation_bytes +=
+                static_cast<types::size_type>(std::popcount(word & _continuation_mask));
+        }
+        for (; it != end; ++it)
+            n_continuation_bytes += static_cast<types::size_type>((*it & _continuation_bit) != 0);
+
+        return this->_offsets[vertex_id + constants::one] - this->_offsets[vertex_id]
+             - n_continuation_bytes;
+    }
+
+    // the neighbor lists are sorted so the decoding stops at the first greater id
+    [[nodiscard]] types::size_type _count_neighbor(
+        const types::id_type vertex_id, const types::id_type neighbor_id
+    ) const {
+        types::size_type count = constants::default_size;
+        for (const auto id : this->neighbor_ids(vertex_id)) {
+            if (id > neighbor_id)
+                break;
+            count += static_cast<types::size_type>(id == neighbor_id);
+        }
+        return count;
+    }
+
+    [[nodiscard]] gl_attr_force_inline edge_type _make_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return edge_type{*this->_vertices[first_id], *this->_vertices[second_id]};
+    }
+
+    // returns the first `n_edges` cached edges of the cell
+    [[nodiscard]] typename edge_cache::edge_ref_list_type _materialize(
+        const types::id_type first_id, const types::id_type second_id, types::size_type n_edges
+    ) const {
+        // undirected edges are cached once for both orientations of the cell
+        cell_type cell{first_id, second_id};
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            cell = std::minmax(first_id, second_id);
+
+        return this->_edge_cache.get_or_make(
+            cell, *this->_vertices[cell.first], *this->_vertices[cell.second], n_edges
+        );
+    }
+
+    offset_list_type _offsets{};
+    data_type _data{};
+
+    // the addresses of the vertices of the graph the decoded edges are bound to
+    typename GraphTraits::template vector_type<const vertex_type*> _vertices{};
+
+    degree_list_type _in_degrees{}; // used only by directed graphs
+    types::size_type _n_unique_edges = constants::default_size;
+
+    mutable edge_cache _edge_cache{};
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -0,0 +1,466 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/decl/impl_tags.hpp"
+#include "gl/types/dereferencing_iterator.hpp"
+#include "gl/types/iterator_range.hpp"
+#include "gl/types/properties.hpp"
+#include "gl/types/types.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+namespace detail {
+
+template <typename EdgePropertiesType, typename Allocator>
+struct csr_weight_list {
+    // no weight column for the edges without weights
+    struct type {
+        type() = default;
+
+        explicit type(const Allocator&) {}
+    };
+};
+
+template <type_traits::c_weight_properties_type EdgePropertiesType, typename Allocator>
+struct csr_weight_list<EdgePropertiesType, Allocator> {
+    using weight_type = typename EdgePropertiesType::weight_type;
+    using type = std::vector<
+        weight_type,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<weight_type>>;
+};
+
+} // namespace detail
+
+/*
+An immutable compressed sparse row (CSR) representation of a graph.
+The adjacency information is stored in flat arrays: the adjacent edges of the vertex `v`
+    occupy the slots [offsets[v], offsets[v + 1]) and the ids of the vertices they lead to
+    are stored in the same slots of the target list.
+The edges themselves are stored contiguously in the order of their source vertices.
+For undirected graphs each edge is stored once and referenced from the slots of both
+    of its incident vertices.
+If the edges have weights, the weights are additionally stored in a separate column
+    (in the same slots as the targets), so that the weights of the adjacent edges of a vertex
+    can be read sequentially without accessing the edges themselves. The properties of the edges
+    are const (see `graph_traits::edge_type`), so the column cannot diverge from the edges.
+For directed graphs the in-degrees of the vertices are counted once while the structure
+    is built, so that they can be read in constant time.
+NOTE: The edge descriptors (and the edge pointers of the undirected slots) are stored in addition
+    to the target list, because the graph returns references to the edges. The edges are
+    reached through the `adjacent_edges` ranges, while the weighted algorithms read only
+    the offset, target and weight lists (see `algorithm::impl::for_each_weighted_adjacent_edge`).
+*/
+
+template <type_traits::c_csr_graph_traits GraphTraits>
+class adjacency_csr final {
+public:
+    using vertex_type = typename GraphTraits::vertex_type;
+
+    using edge_type = typename GraphTraits::edge_type;
+    using edge_directional_tag = typename GraphTraits::edge_directional_tag;
+    using edge_properties_type = typename GraphTraits::edge_properties_type;
+
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_type>;
+    using edge_ref_list_type = typename GraphTraits::template vector_type<const edge_type*>;
+    using edge_iterator_type = std::conditional_t<
+        type_traits::is_directed_v<edge_type>,
+        typename edge_list_type::const_iterator,
+        types::dereferencing_iterator<typename edge_ref_list_type::const_iterator>>;
+
+    using offset_list_type = typename GraphTraits::template vector_type<types::size_type>;
+    using target_list_type = typename GraphTraits::template vector_type<types::id_type>;
+    using weight_list_type =
+        typename detail::csr_weight_list<edge_properties_type, allocator_type>::type;
+    using degree_list_type = typename GraphTraits::template vector_type<types::size_type>;
+
+    static constexpr bool has_weight_column =
+        type_traits::c_weight_properties_type<edge_properties_type>;
+
+    adjacency_csr(const adjacency_csr&) = delete;
+    adjacency_csr& operator=(const adjacency_csr&) = delete;
+
+    adjacency_csr() : adjacency_csr(allocator_type{}) {}
+
+    explicit adjacency_csr(const allocator_type& allocator)
+    : _offsets(constants::one, constants::zero, allocator),
+      _targets(allocator),
+      _edges(allocator),
+      _edge_refs(allocator),
+      _weights(allocator),
+      _in_degrees(allocator) {}
+
+    adjacency_csr(const types::size_type n_vertices, const allocator_type& allocator = {})
+    : adjacency_csr(allocator) {
+        this->_offsets.resize(n_vertices + constants::one, constants::zero);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(n_vertices, constants::zero);
+    }
+
+    /*
+    Builds the compressed structure from any graph implementation.
+    The `get_vertex` callable should return the vertex (owned by the target graph)
+        with the given id, to which the copied edges will be bound.
+    The order of the adjacent edges of each vertex is preserved.
+    */
+    template <typename SourceImpl, typename VertexGetter>
+    requires std::is_invocable_r_v<const vertex_type&, VertexGetter, types::id_type>
+    adjacency_csr(
+        const SourceImpl& source,
+        const VertexGetter& get_vertex,
+        const allocator_type& allocator = {}
+    )
+    : adjacency_csr(allocator) {
+        // the source edges have mutable properties, while the properties of the copies are const
+        using source_edge_type = typename SourceImpl::edge_type;
+
+        const auto n_vertices = source.n_vertices();
+
+        this->_offsets.reserve(n_vertices + constants::one);
+
+        // the edges are referenced by address so the edge list cannot be reallocated
+        this->_edges.reserve(source.n_unique_edges());
+
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            this->_targets.reserve(source.n_unique_edges());
+            if constexpr (has_weight_column)
+                this->_weights.reserve(source.n_unique_edges());
+
+            for (types::id_type vertex_id = constants::initial_id; vertex_id < n_vertices;
+                 ++vertex_id) {
+                for (const auto& edge : source.adjacent_edges(vertex_id)) {
+                    this->_targets.push_back(edge.second_id());
+                    if constexpr (has_weight_column)
+                        this->_weights.push_back(edge.properties.weight);
+                    _emplace_edge_copy(this->_edges, edge, get_vertex);
+                }
+                this->_offsets.push_back(this->_targets.size());
+            }
+
+            this->_in_degrees.resize(n_vertices, constants::zero);
+            for (const auto target_id : this->_targets)
+                ++this->_in_degrees[target_id];
+        }
+        else {
+            this->_targets.reserve(constants::two * source.n_unique_edges());
+            this->_edge_refs.reserve(constants::two * source.n_unique_edges());
+            if constexpr (has_weight_column)
+                this->_weights.reserve(constants::two * source.n_unique_edges());
+
+            // the sources yielding temporary edges (the bit matrices) have no parallel edges,
+            // so their edges are identified by the ids of their vertices instead of the address
+            constexpr bool temporary_edges = not std::is_lvalue_reference_v<
+                std::ranges::range_reference_t<decltype(source.adjacent_edges(types::id_type{}))>>;
+            using edge_key_type = std::conditional_t<
+                temporary_edges,
+                types::homogeneous_pair<types::id_type>,
+                const source_edge_type*>;
+            using pending_edge_map_type = std::conditional_t<
+                temporary_edges,
+                std::map<edge_key_type, const edge_type*>,
+                std::unordered_map<edge_key_type, const edge_type*>>;
+
+            const auto edge_key = [](const source_edge_type& edge) -> edge_key_type {
+                if constexpr (temporary_edges)
+                    return std::minmax(edge.first_id(), edge.second_id());
+                else
+                    return &edge;
+            };
+
+            // maps the source edges to their copies until both of their slots are filled
+            pending_edge_map_type pending_edges;
+
+            for (types::id_type vertex_id = constants::initial_id; vertex_id < n_vertices;
+                 ++vertex_id) {
+                for (const auto& edge : source.adjacent_edges(vertex_id)) {
+                    const edge_type* edge_copy;
+
+                    const auto pending_it = pending_edges.find(edge_key(edge));
+                    if (pending_it == pending_edges.end()) {
+                        edge_copy = &_emplace_edge_copy(this->_edges, edge, get_vertex);
+                        if (not edge.is_loop())
+                            pending_edges.emplace(edge_key(edge), edge_copy);
+                    }
+                    else {
+                        edge_copy = pending_it->second;
+                        pending_edges.erase(pending_it);
+                    }
+
+                    this->_targets.push_back(edge.incident_vertex_id(vertex_id));
+                    this->_edge_refs.push_back(edge_copy);
+                    if constexpr (has_weight_column)
+                        this->_weights.push_back(edge.properties.weight);
+                }
+                this->_offsets.push_back(this->_targets.size());
+            }
+        }
+    }
+
+    adjacency_csr(adjacency_csr&&) = default;
+
+    /*
+    The structure is always moved together with its allocator: the slots of undirected graphs
+        reference the edges by address, while the move assignment of containers with different
+        memory resources would relocate the edges.
+    */
+    adjacency_csr& operator=(adjacency_csr&& other) noexcept {
+        if (this != &other) {
+            std::destroy_at(this);
+            std::construct_at(this, std::move(other));
+        }
+        return *this;
+    }
+
+    ~adjacency_csr() = default;
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_offsets.size() - constants::one;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_edges.size();
+    }
+
+    // --- vertex methods ---
+
+    [[nodiscard]] types::size_type in_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_in_degrees[vertex_id];
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type out_degree(const types::id_type vertex_id
+    ) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_n_slots(vertex_id);
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            return this->in_degree(vertex_id) + this->out_degree(vertex_id);
+        }
+        else {
+            // loops occupy a single slot but are counted twice
+            const auto targets = this->_slot_targets(vertex_id);
+            return this->_n_slots(vertex_id)
+                 + static_cast<types::size_type>(std::ranges::count(targets, vertex_id));
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return {this->_in_degrees.begin(), this->_in_degrees.end()};
+        else
+            return this->degree_map();
+    }
+
+    [[nodiscard]] std::vector<types::size_type> out_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> out_degree_map;
+            out_degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                out_degree_map.push_back(this->_n_slots(id));
+            return out_degree_map;
+        }
+        else {
+            return this->degree_map();
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> degree_map = this->out_degree_map();
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map[id] += this->_in_degrees[id];
+            return degree_map;
+        }
+        else {
+            std::vector<types::size_type> degree_map;
+            degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map.push_back(this->degree(id));
+            return degree_map;
+        }
+    }
+
+    // --- edge methods ---
+
+    [[nodiscard]] bool has_edge(const types::id_type first_id, const types::id_type second_id)
+        const {
+        if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
+            return false;
+
+        const auto targets = this->_slot_targets(first_id);
+        return std::ranges::find(targets, second_id) != targets.end();
+    }
+
+    [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        // the edges are stored contiguously so the edge can be validated by its address
+        const auto* edges_begin = this->_edges.data();
+        return std::less_equal<const edge_type*>{}(edges_begin, &edge)
+           and std::less<const edge_type*>{}(&edge, edges_begin + this->_edges.size());
+    }
+
+    [[nodiscard]] types::optional_ref<const edge_type> get_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
+            return std::nullopt;
+
+        const auto targets = this->_slot_targets(first_id);
+        const auto it = std::ranges::find(targets, second_id);
+        if (it == targets.end())
+            return std::nullopt;
+
+        const auto slot = static_cast<types::size_type>(it - this->_targets.begin());
+        return std::cref(this->_edge_at(slot));
+    }
+
+    [[nodiscard]] std::vector<types::const_ref_wrap<edge_type>> get_edges(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        using edge_ref_set = std::vector<types::const_ref_wrap<edge_type>>;
+
+        if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
+            return edge_ref_set{};
+
+        edge_ref_set matching_edges{};
+        for (auto slot = this->_offsets[first_id]; slot < this->_offsets[first_id + constants::one];
+             ++slot)
+            if (this->_targets[slot] == second_id)
+                matching_edges.push_back(std::cref(this->_edge_at(slot)));
+
+        return matching_edges;
+    }
+
+    [[nodiscard]] types::iterator_range<edge_iterator_type> adjacent_edges(
+        const types::id_type vertex_id
+    ) const {
+        const auto begin_slot = static_cast<std::ptrdiff_t>(this->_offsets[vertex_id]);
+        const auto end_slot =
+            static_cast<std::ptrdiff_t>(this->_offsets[vertex_id + constants::one]);
+
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            return make_iterator_range(
+                std::next(this->_edges.cbegin(), begin_slot),
+                std::next(this->_edges.cbegin(), end_slot)
+            );
+        }
+        else {
+            return make_iterator_range(
+                edge_iterator_type(std::next(this->_edge_refs.cbegin(), begin_slot)),
+                edge_iterator_type(std::next(this->_edge_refs.cbegin(), end_slot))
+            );
+        }
+    }
+
+    // --- csr specific methods ---
+
+    [[nodiscard]] gl_attr_force_inline const offset_list_type& offsets() const {
+        return this->_offsets;
+    }
+
+    [[nodiscard]] gl_attr_force_inline const target_list_type& targets() const {
+        return this->_targets;
+    }
+
+    [[nodiscard]] gl_attr_force_inline const weight_list_type& weights() const
+    requires(has_weight_column)
+    {
+        return this->_weights;
+    }
+
+    // the ids of the vertices adjacent to the given vertex (in the order of its adjacent edges)
+    [[nodiscard]] gl_attr_force_inline std::span<const types::id_type> adjacent_vertex_ids(
+        const types::id_type vertex_id
+    ) const {
+        return this->_slot_span(this->_targets, vertex_id);
+    }
+
+    // the weights of the adjacent edges of the given vertex (in the order of the edges)
+    [[nodiscard]] gl_attr_force_inline auto adjacent_weights(const types::id_type vertex_id) const
+    requires(has_weight_column)
+    {
+        return this->_slot_span(this->_weights, vertex_id);
+    }
+
+private:
+    template <typename SourceEdgeType, typename VertexGetter>
+    static const edge_type& _emplace_edge_copy(
+        edge_list_type& edges, const SourceEdgeType& edge, const VertexGetter& get_vertex
+    ) {
+        const auto& first = get_vertex(edge.first_id());
+        const auto& second = get_vertex(edge.second_id());
+
+        if constexpr (type_traits::is_default_properties_type_v<edge_properties_type>)
+            return edges.emplace_back(first, second);
+        else
+            return edges.emplace_back(first, second, edge.properties);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _is_valid_vertex_id(const types::id_type vertex_id
+    ) const {
+        return vertex_id < this->n_vertices();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type _n_slots(const types::id_type vertex_id
+    ) const {
+        return this->_offsets[vertex_id + constants::one] - this->_offsets[vertex_id];
+    }
+
+    [[nodiscard]] gl_attr_force_inline auto _slot_targets(const types::id_type vertex_id) const {
+        return std::ranges::subrange(
+            std::next(
+                this->_targets.begin(), static_cast<std::ptrdiff_t>(this->_offsets[vertex_id])
+            ),
+            std::next(
+                this->_targets.begin(),
+                static_cast<std::ptrdiff_t>(this->_offsets[vertex_id + constants::one])
+            )
+        );
+    }
+
+    template <typename Column>
+    [[nodiscard]] gl_attr_force_inline std::span<const typename Column::value_type> _slot_span(
+        const Column& column, const types::id_type vertex_id
+    ) const {
+        return std::span<const typename Column::value_type>{column}.subspan(
+            this->_offsets[vertex_id], this->_n_slots(vertex_id)
+        );
+    }
+
+    [[nodiscard]] gl_attr_force_inline const edge_type& _edge_at(const types::size_type slot
+    ) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_edges[slot];
+        else
+            return *this->_edge_refs[slot];
+    }
+
+    offset_list_type _offsets{};
+    target_list_type _targets{};
+    edge_list_type _edges{};
+    edge_ref_list_type _edge_refs{}; // used only by undirected graphs
+    [[no_unique_address]] weight_list_type _weights{}; // used only by weighted graphs
+    degree_list_type _in_degrees{}; // used only by directed graphs
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
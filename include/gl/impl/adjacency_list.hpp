@@ -4,13 +4,24 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
+#include "gl/storage/storage_tags.hpp"
 #include "gl/types/dereferencing_iterator.hpp"
 #include "gl/types/iterator_range.hpp"
 #include "gl/types/types.hpp"
+#include "gl/util/compact.hpp"
+#include "gl/util/sorted_intersection.hpp"
+#include "neighbor_index.hpp"
 #include "specialized/adjacency_list.hpp"
 
-namespace gl::impl {
+#include <unordered_map>
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+#include <execution>
+#endif
+
+namespace gl::inline gl_id_type_namespace::impl {
 
 template <type_traits::c_list_graph_traits GraphTraits>
 class adjacency_list final {
@@ -21,20 +32,161 @@ public:
     using edge_ptr_type = typename GraphTraits::edge_ptr_type;
     using edge_directional_tag = typename GraphTraits::edge_directional_tag;
 
-    using edge_list_type = std::vector<edge_ptr_type>;
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_ptr_type>;
     using edge_iterator_type =
         types::dereferencing_iterator<typename edge_list_type::const_iterator>;
 
     // TODO: reverese iterators should be available for bidirectional ranges
 
-    using list_type = std::vector<edge_list_type>;
+    using list_type = typename GraphTraits::template vector_type<edge_list_type>;
+
+    // the incoming edges of undirected graphs are simply their adjacent edges
+    static constexpr bool has_in_edge_index =
+        type_traits::is_directed_v<edge_type>
+        and type_traits::has_list_option_v<
+            typename GraphTraits::implementation_tag,
+            in_edge_index_t>;
+    static constexpr bool has_in_edges =
+        type_traits::is_undirected_v<edge_type> or has_in_edge_index;
+
+    using in_edge_list_type = typename GraphTraits::template vector_type<const edge_type*>;
+    using in_edge_iterator_type = std::conditional_t<
+        has_in_edge_index,
+        types::dereferencing_iterator<typename in_edge_list_type::const_iterator>,
+        edge_iterator_type>;
+
+    static constexpr bool has_edge_position_index = type_traits::
+        has_list_option_v<typename GraphTraits::implementation_tag, edge_position_index_t>;
+
+    /*
+    The position of an edge in the adjacency list of its first vertex and in the adjacency
+        list of its second vertex (undirected graphs) or the in-edge list of its target
+        (directed graphs with the in-edge index).
+    */
+    struct edge_position {
+        types::size_type first_idx;
+        types::size_type second_idx;
+    };
+
+    using edge_position_map_type = std::unordered_map<
+        const edge_type*,
+        edge_position,
+        std::hash<const edge_type*>,
+        std::equal_to<const edge_type*>,
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<
+            std::pair<const edge_type* const, edge_position>>>;
+
+    static constexpr types::size_type neighbor_index_threshold =
+        type_traits::list_neighbor_index_threshold_v<typename GraphTraits::implementation_tag>;
+    static constexpr bool has_neighbor_index = neighbor_index_threshold > constants::zero;
+
+    using neighbor_index_type = neighbor_index<edge_type, allocator_type>;
+
+    static constexpr bool has_sorted_adjacency = type_traits::
+        has_list_option_v<typename GraphTraits::implementation_tag, sorted_adjacency_t>;
+
+    static_assert(
+        not (has_sorted_adjacency and has_edge_position_index),
+        "The sorted adjacency option cannot be combined with the edge position index option"
+    );
 
     adjacency_list(const adjacency_list&) = delete;
     adjacency_list& operator=(const adjacency_list&) = delete;
 
     adjacency_list() = default;
 
-    adjacency_list(const types::size_type n_vertices) : _list(n_vertices) {}
+    explicit adjacency_list(const allocator_type& allocator)
+    : _list(allocator),
+      _in_list(_make_optional_member<in_list_type>(allocator)),
+      _edge_positions(_make_optional_member<edge_positions_type>(allocator)),
+      _neighbor_index(_make_optional_member<neighbor_index_list_type>(allocator)) {}
+
+    adjacency_list(const types::size_type n_vertices, const allocator_type& allocator = {})
+    : adjacency_list(allocator) {
+        this->_list.resize(n_vertices);
+        if constexpr (has_in_edge_index)
+            this->_in_list.resize(n_vertices);
+        if constexpr (has_neighbor_index)
+            this->_neighbor_index.resize(n_vertices);
+    }
+
+    /*
+    Builds a copy of the source adjacency list. The `copy_edge` callable should return a copy
+        of the given edge (owned by the target graph) and is invoked once for each unique edge.
+    The order of the adjacent edges of each vertex is preserved.
+    */
+    template <typename EdgeCopier>
+    requires std::is_invocable_r_v<edge_ptr_type, EdgeCopier, const edge_type&>
+    adjacency_list(
+        const adjacency_list& source,
+        const EdgeCopier& copy_edge,
+        const allocator_type& allocator = {}
+    )
+    : adjacency_list(allocator) {
+        this->_list.resize(source._list.size());
+        this->_n_unique_edges = source._n_unique_edges;
+
+        // the edges referenced more than once are mapped to the slots of their copies
+        constexpr bool map_edges = type_traits::is_undirected_v<edge_type> or has_in_edge_index
+                                or has_edge_position_index;
+        [[maybe_unused]] std::unordered_map<const edge_type*, edge_ptr_type*> edge_slots;
+        if constexpr (map_edges)
+            edge_slots.reserve(source._n_unique_edges);
+
+        // the undirected edges are copied from the adjacency lists of their first vertices
+        const auto is_owned_by = [](const edge_type& edge, const types::id_type vertex_id) {
+            return type_traits::is_directed_v<edge_type> or edge.first_id() == vertex_id;
+        };
+
+        for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id) {
+            const auto& source_edges = source._list[id];
+            auto& edges = this->_list[id];
+            edges.resize(source_edges.size());
+
+            for (types::size_type i = constants::begin_idx; i < source_edges.size(); ++i) {
+                if (not is_owned_by(*source_edges[i], id))
+                    continue;
+
+                edges[i] = copy_edge(*source_edges[i]);
+                if constexpr (map_edges)
+                    edge_slots.emplace(source_edges[i].get(), &edges[i]);
+            }
+        }
+
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id)
+                for (types::size_type i = constants::begin_idx; i < this->_list[id].size(); ++i)
+                    if (const auto& source_edge = source._list[id][i];
+                        not is_owned_by(*source_edge, id))
+                        this->_list[id][i] = *edge_slots.at(source_edge.get());
+
+        if constexpr (has_in_edge_index) {
+            this->_in_list.reserve(source._in_list.size());
+            for (const auto& source_in_edges : source._in_list) {
+                auto& in_edges = this->_in_list.emplace_back();
+                in_edges.reserve(source_in_edges.size());
+                for (const auto* source_edge : source_in_edges)
+                    in_edges.push_back(edge_slots.at(source_edge)->get());
+            }
+        }
+
+        if constexpr (has_edge_position_index) {
+            this->_edge_positions.reserve(source._edge_positions.size());
+            for (const auto& [source_edge, position] : source._edge_positions)
+                this->_edge_positions.emplace(edge_slots.at(source_edge)->get(), position);
+        }
+
+        if constexpr (has_neighbor_index) {
+            this->_neighbor_index.resize(this->_list.size());
+            for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id)
+                if (source._neighbor_index[id].is_active())
+                    this->_build_neighbor_index(id, [id](const edge_type& edge) {
+                        return edge.incident_vertex_id(id);
+                    });
+        }
+    }
 
     adjacency_list(adjacency_list&&) = default;
     adjacency_list& operator=(adjacency_list&&) = default;
@@ -55,12 +207,21 @@ public:
 
     gl_attr_force_inline void add_vertex() {
         this->_list.push_back(edge_list_type{});
+        if constexpr (has_in_edge_index)
+            this->_in_list.push_back(in_edge_list_type{});
+        if constexpr (has_neighbor_index)
+            this->_neighbor_index.push_back(neighbor_index_type{});
     }
 
     inline void add_vertices(const types::size_type n) {
         this->_list.reserve(this->n_vertices() + n);
         for (types::size_type _ = constants::begin_idx; _ < n; ++_)
             this->_list.push_back(edge_list_type{});
+
+        if constexpr (has_in_edge_index)
+            this->_in_list.resize(this->n_vertices());
+        if constexpr (has_neighbor_index)
+            this->_neighbor_index.resize(this->n_vertices());
     }
 
     [[nodiscard]] gl_attr_force_inline types::size_type in_degree(const types::id_type vertex_id
@@ -90,8 +251,20 @@ public:
         return specialized_impl::degree_map(*this);
     }
 
-    gl_attr_force_inline void remove_vertex(const vertex_type& vertex) {
+    inline void remove_vertex(const vertex_type& vertex) {
         specialized_impl::remove_vertex(*this, vertex);
+
+        if constexpr (has_neighbor_index) {
+            std::vector<bool> removed(this->n_vertices() + constants::one, false);
+            removed[vertex.id()] = true;
+            this->_rebuild_neighbor_indices(removed);
+        }
+    }
+
+    inline void remove_vertices(const std::vector<bool>& removed) {
+        specialized_impl::remove_vertices(*this, removed);
+        if constexpr (has_neighbor_index)
+            this->_rebuild_neighbor_indices(removed);
     }
 
     // --- edge methods ---
@@ -111,12 +284,38 @@ public:
         specialized_impl::add_edges_from(*this, source_id, std::move(new_edges));
     }
 
+    gl_attr_force_inline void add_edges(std::vector<edge_ptr_type> new_edges) {
+        specialized_impl::add_edges(*this, std::move(new_edges));
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    template <type_traits::c_execution_policy ExecutionPolicy>
+    gl_attr_force_inline void add_edges(
+        ExecutionPolicy&& policy, std::vector<edge_ptr_type> new_edges
+    ) {
+        // the edge position and neighbor indices are hash based and cannot be filled concurrently
+        if constexpr (has_edge_position_index or has_neighbor_index)
+            specialized_impl::add_edges(*this, std::move(new_edges));
+        else
+            specialized_impl::add_edges(*this, policy, std::move(new_edges));
+    }
+#endif
+
     [[nodiscard]] bool has_edge(const types::id_type first_id, const types::id_type second_id)
         const {
         if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
             return false;
 
+        if constexpr (has_neighbor_index)
+            if (const auto& index = this->_neighbor_index[first_id]; index.is_active())
+                return index.find(second_id) != nullptr;
+
         const auto& adjacent_edges = this->_list[first_id];
+        if constexpr (has_sorted_adjacency)
+            return std::ranges::binary_search(
+                adjacent_edges, second_id, std::less{}, _neighbor_id_projection(first_id)
+            );
+
         return std::ranges::find_if(
                    adjacent_edges,
                    [first_id, second_id](const auto& edge) {
@@ -127,6 +326,9 @@ public:
     }
 
     [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        if constexpr (has_edge_position_index)
+            return this->_edge_positions.contains(&edge);
+
         const auto first_id = edge.first_id();
         if (not (
                 this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(edge.second_id())
@@ -147,15 +349,35 @@ public:
         if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
             return std::nullopt;
 
-        const auto& adjacent_edges = this->_list[first_id];
-        const auto it =
-            std::ranges::find_if(adjacent_edges, [first_id, second_id](const auto& edge) {
-                return specialized_impl::is_edge_incident_to(edge, second_id, first_id);
-            });
+        if constexpr (has_neighbor_index) {
+            if (const auto& index = this->_neighbor_index[first_id]; index.is_active()) {
+                const auto* edge = index.find(second_id);
+                if (edge == nullptr)
+                    return std::nullopt;
+                return std::cref(*edge);
+            }
+        }
 
-        if (it == adjacent_edges.cend())
-            return std::nullopt;
-        return std::cref(**it);
+        const auto& adjacent_edges = this->_list[first_id];
+        if constexpr (has_sorted_adjacency) {
+            const auto neighbor_id = _neighbor_id_projection(first_id);
+            const auto it =
+                std::ranges::lower_bound(adjacent_edges, second_id, std::less{}, neighbor_id);
+
+            if (it == adjacent_edges.cend() or neighbor_id(*it) != second_id)
+                return std::nullopt;
+            return std::cref(**it);
+        }
+        else {
+            const auto it =
+                std::ranges::find_if(adjacent_edges, [first_id, second_id](const auto& edge) {
+                    return specialized_impl::is_edge_incident_to(edge, second_id, first_id);
+                });
+
+            if (it == adjacent_edges.cend())
+                return std::nullopt;
+            return std::cref(**it);
+        }
     }
 
     [[nodiscard]] auto get_edges(const types::id_type first_id, const types::id_type second_id)
@@ -168,8 +390,16 @@ public:
         const auto& adjacent_edges = this->_list[first_id];
 
         edge_ref_set matching_edges{};
-        matching_edges.reserve(adjacent_edges.size());
+        if constexpr (has_sorted_adjacency) {
+            const auto matching_range = std::ranges::equal_range(
+                adjacent_edges, second_id, std::less{}, _neighbor_id_projection(first_id)
+            );
+            for (const auto& edge : matching_range)
+                matching_edges.push_back(std::cref(*edge));
+            return matching_edges;
+        }
 
+        matching_edges.reserve(adjacent_edges.size());
         for (const auto& edge : adjacent_edges)
             if (specialized_impl::is_edge_incident_to(edge, second_id, first_id))
                 matching_edges.push_back(std::cref(*edge));
@@ -182,6 +412,18 @@ public:
         specialized_impl::remove_edge(*this, edge);
     }
 
+    // returns the sorted ids of the vertices adjacent to both given vertices
+    [[nodiscard]] std::vector<types::id_type> common_neighbors(
+        const types::id_type first_id, const types::id_type second_id
+    ) const
+    requires(has_sorted_adjacency)
+    {
+        return util::sorted_intersection(
+            this->_list[first_id] | std::views::transform(_neighbor_id_projection(first_id)),
+            this->_list[second_id] | std::views::transform(_neighbor_id_projection(second_id))
+        );
+    }
+
     [[nodiscard]] gl_attr_force_inline types::iterator_range<edge_iterator_type> adjacent_edges(
         const types::id_type vertex_id
     ) const {
@@ -189,6 +431,20 @@ public:
         return make_iterator_range(deref_cbegin(adjacent_edges), deref_cend(adjacent_edges));
     }
 
+    [[nodiscard]] gl_attr_force_inline types::iterator_range<in_edge_iterator_type> in_edges(
+        const types::id_type vertex_id
+    ) const
+    requires(has_in_edges)
+    {
+        if constexpr (has_in_edge_index) {
+            const auto& in_edges = this->_in_list[vertex_id];
+            return make_iterator_range(deref_cbegin(in_edges), deref_cend(in_edges));
+        }
+        else {
+            return this->adjacent_edges(vertex_id);
+        }
+    }
+
 private:
     using specialized_impl = typename specialized::list_impl_traits<adjacency_list>::type;
     friend specialized_impl;
@@ -198,8 +454,232 @@ private:
         return vertex_id < this->_list.size();
     }
 
+    // --- sorted adjacency methods ---
+
+    [[nodiscard]] gl_attr_force_inline static auto _neighbor_id_projection(
+        [[maybe_unused]] const types::id_type vertex_id
+    ) {
+        return [vertex_id](const edge_ptr_type& edge) {
+            if constexpr (type_traits::is_directed_v<edge_type>)
+                return edge->second_id();
+            else
+                return edge->incident_vertex_id(vertex_id);
+        };
+    }
+
+    /*
+    Adds the edge to the adjacency list of the vertex. With the sorted adjacency option the edge
+        is placed after all edges with the same or lower neighbor ids, otherwise it is appended.
+    */
+    const edge_type& _push_edge(const types::id_type vertex_id, edge_ptr_type edge) {
+        auto& adjacent_edges = this->_list[vertex_id];
+        if constexpr (has_sorted_adjacency) {
+            const auto neighbor_id = _neighbor_id_projection(vertex_id);
+            const auto it = std::ranges::upper_bound(
+                adjacent_edges, neighbor_id(edge), std::less{}, neighbor_id
+            );
+            return **adjacent_edges.insert(it, std::move(edge));
+        }
+        else {
+            adjacent_edges.push_back(std::move(edge));
+            return *adjacent_edges.back();
+        }
+    }
+
+    // restores the order of an adjacency list after appending edges to its sorted prefix
+    void _merge_appended_edges(
+        [[maybe_unused]] const types::id_type vertex_id,
+        [[maybe_unused]] const types::size_type n_sorted
+    ) {
+        if constexpr (has_sorted_adjacency) {
+            auto& adjacent_edges = this->_list[vertex_id];
+            const auto neighbor_id = _neighbor_id_projection(vertex_id);
+            const auto compare = [&neighbor_id](const auto& lhs, const auto& rhs) {
+                return neighbor_id(lhs) < neighbor_id(rhs);
+            };
+
+            const auto middle = adjacent_edges.begin() + static_cast<std::ptrdiff_t>(n_sorted);
+            std::stable_sort(middle, adjacent_edges.end(), compare);
+            std::inplace_merge(adjacent_edges.begin(), middle, adjacent_edges.end(), compare);
+        }
+    }
+
+    // grows each adjacency list once to fit the given number of new edges
+    void _reserve_adjacent_edges(const std::vector<types::size_type>& n_new_edges) {
+        for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id)
+            if (n_new_edges[id] > constants::zero)
+                this->_list[id].reserve(this->_list[id].size() + n_new_edges[id]);
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    /*
+    Resizes each given list to fit the given number of new edges and returns the sizes
+        of the lists before resizing (the indices of the first free slots).
+    The new slots are then filled concurrently by the `scatter` methods.
+    Only the lists of the heap storage can be resized concurrently - the memory resources
+        of the other storage types (e.g. `std::pmr::monotonic_buffer_resource`) are not
+        required to be thread-safe.
+    */
+    template <typename EdgeLists, type_traits::c_execution_policy ExecutionPolicy>
+    [[nodiscard]] static std::vector<types::size_type> _grow_edge_lists(
+        EdgeLists& edge_lists,
+        const std::vector<types::size_type>& n_new_edges,
+        ExecutionPolicy&& policy
+    ) {
+        const auto grow = [](auto& edges, const types::size_type n_new) {
+            const auto n_old = edges.size();
+            if (n_new > constants::zero)
+                edges.resize(n_old + n_new);
+            return n_old;
+        };
+
+        std::vector<types::size_type> free_slot_idx(edge_lists.size());
+        if constexpr (std::same_as<typename GraphTraits::storage_tag, storage::heap_t>)
+            std::transform(
+                policy,
+                edge_lists.begin(),
+                edge_lists.end(),
+                n_new_edges.begin(),
+                free_slot_idx.begin(),
+                grow
+            );
+        else
+            std::transform(
+                edge_lists.begin(),
+                edge_lists.end(),
+                n_new_edges.begin(),
+                free_slot_idx.begin(),
+                grow
+            );
+        return free_slot_idx;
+    }
+#endif
+
+    // restores the order of the adjacency lists after appending the given number of new edges
+    void _merge_new_adjacent_edges(
+        [[maybe_unused]] const std::vector<types::size_type>& n_new_edges
+    ) {
+        if constexpr (has_sorted_adjacency)
+            for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id)
+                if (n_new_edges[id] > constants::zero)
+                    this->_merge_appended_edges(id, this->_list[id].size() - n_new_edges[id]);
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    template <type_traits::c_execution_policy ExecutionPolicy>
+    void _merge_new_adjacent_edges(
+        [[maybe_unused]] const std::vector<types::size_type>& n_new_edges,
+        [[maybe_unused]] ExecutionPolicy&& policy
+    ) {
+        if constexpr (has_sorted_adjacency) {
+            std::vector<types::id_type> merged_ids;
+            for (types::id_type id = constants::initial_id; id < this->_list.size(); ++id)
+                if (n_new_edges[id] > constants::zero)
+                    merged_ids.push_back(id);
+
+            std::for_each(policy, merged_ids.begin(), merged_ids.end(), [&](const auto id) {
+                this->_merge_appended_edges(id, this->_list[id].size() - n_new_edges[id]);
+            });
+        }
+    }
+#endif
+
+    // --- neighbor index methods ---
+
+    // should be called after the edge is added to the adjacency list of the vertex
+    void _index_neighbor(const types::id_type vertex_id, const edge_type& edge) {
+        if constexpr (has_neighbor_index) {
+            auto& index = this->_neighbor_index[vertex_id];
+            if (index.is_active())
+                index.insert(edge.incident_vertex_id(vertex_id), &edge);
+            else if (this->_list[vertex_id].size() >= neighbor_index_threshold)
+                this->_build_neighbor_index(vertex_id, [vertex_id](const edge_type& adj_edge) {
+                    return adj_edge.incident_vertex_id(vertex_id);
+                });
+        }
+    }
+
+    // should be called before the edge is removed from the adjacency list of the vertex
+    void _unindex_neighbor(const types::id_type vertex_id, const edge_type& edge) {
+        if constexpr (has_neighbor_index) {
+            auto& index = this->_neighbor_index[vertex_id];
+            if (not index.is_active())
+                return;
+
+            // the index is released once the degree drops below half of the threshold
+            // so that the vertices with degrees close to the threshold are not rebuilt repeatedly
+            if (this->_list[vertex_id].size() <= neighbor_index_threshold / constants::two)
+                index.reset();
+            else
+                index.erase(edge.incident_vertex_id(vertex_id), &edge);
+        }
+    }
+
+    template <typename NeighborIdProjection>
+    void _build_neighbor_index(
+        const types::id_type vertex_id, const NeighborIdProjection& neighbor_id
+    ) {
+        const auto& adjacent_edges = this->_list[vertex_id];
+        auto& index = this->_neighbor_index[vertex_id];
+
+        index.reserve(adjacent_edges.size());
+        for (const auto& edge : adjacent_edges)
+            index.insert(neighbor_id(*edge), &*edge);
+    }
+
+    /*
+    The neighbor ids of all indexed vertices are changed by a vertex removal, so the indices
+        have to be rebuilt. This function must be called after the adjacency lists are compacted,
+        but before the ids of the remaining vertices are updated.
+    */
+    void _rebuild_neighbor_indices(const std::vector<bool>& removed) {
+        util::compact(this->_neighbor_index, removed);
+        const auto new_ids = util::compacted_ids(removed);
+
+        types::id_type old_id = constants::initial_id;
+        for (types::id_type vertex_id = constants::initial_id; vertex_id < this->n_vertices();
+             ++vertex_id, ++old_id) {
+            while (removed[old_id])
+                ++old_id;
+
+            this->_neighbor_index[vertex_id].reset();
+            if (this->_list[vertex_id].size() < neighbor_index_threshold)
+                continue;
+
+            this->_build_neighbor_index(vertex_id, [old_id, &new_ids](const edge_type& edge) {
+                return new_ids[edge.incident_vertex_id(old_id)];
+            });
+        }
+    }
+
+    using in_list_type = std::conditional_t<
+        has_in_edge_index,
+        typename GraphTraits::template vector_type<in_edge_list_type>,
+        std::monostate>;
+    using edge_positions_type =
+        std::conditional_t<has_edge_position_index, edge_position_map_type, std::monostate>;
+    using neighbor_index_list_type = std::conditional_t<
+        has_neighbor_index,
+        typename GraphTraits::template vector_type<neighbor_index_type>,
+        std::monostate>;
+
+    // creates an empty container which uses the allocator (or the placeholder of a disabled one)
+    template <typename Member>
+    [[nodiscard]] static Member _make_optional_member(const allocator_type& allocator) {
+        if constexpr (std::same_as<Member, std::monostate>)
+            return Member{};
+        else
+            return Member(allocator);
+    }
+
     list_type _list{};
+    [[no_unique_address]] in_list_type
+        _in_list{}; // used only by directed graphs with the in-edge index
+    [[no_unique_address]] edge_positions_type
+        _edge_positions{}; // used only by graphs with the edge position index
+    [[no_unique_address]] neighbor_index_list_type
+        _neighbor_index{}; // used only by graphs with the neighbor index
     types::size_type _n_unique_edges{constants::default_size};
 };
 
-} // namespace gl::impl
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/types/dereferencing_iterator.hpp"
 #include "gl/types/iterator_range.hpp"
@@ -11,7 +12,10 @@
 #include "gl/types/types.hpp"
 #include "specialized/adjacency_matrix.hpp"
 
-namespace gl::impl {
+#include <algorithm>
+#include <span>
+
+namespace gl::inline gl_id_type_namespace::impl {
 
 template <type_traits::c_matrix_graph_traits GraphTraits>
 class adjacency_matrix final {
@@ -22,26 +26,29 @@ public:
     using edge_ptr_type = typename GraphTraits::edge_ptr_type;
     using edge_directional_tag = typename GraphTraits::edge_directional_tag;
 
-    using edge_list_type = std::vector<edge_ptr_type>;
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_ptr_type>;
     using edge_iterator_type = types::dereferencing_iterator<
         types::non_null_iterator<typename edge_list_type::const_iterator>>;
 
     // TODO: reverese iterators should be available for bidirectional ranges
 
-    using matrix_type = std::vector<edge_list_type>;
+    // a row-major `capacity x capacity` buffer of which the leading `n_vertices x n_vertices`
+    // block is in use (all cells outside of the block are null)
+    using matrix_type = edge_list_type;
 
     adjacency_matrix(const adjacency_matrix&) = delete;
     adjacency_matrix& operator=(const adjacency_matrix&) = delete;
 
     adjacency_matrix() = default;
 
-    adjacency_matrix(const types::size_type n_vertices) : _matrix(n_vertices) {
-        // initialize a full n x n matrix with null elements
-        for (auto& row : this->_matrix) {
-            row.reserve(n_vertices);
-            std::generate_n(std::back_inserter(row), n_vertices, _make_null_edge);
-        }
-    }
+    explicit adjacency_matrix(const allocator_type& allocator) : _matrix(allocator) {}
+
+    adjacency_matrix(const types::size_type n_vertices, const allocator_type& allocator = {})
+    : _matrix(n_vertices * n_vertices, allocator),
+      _n_vertices(n_vertices),
+      _capacity(n_vertices) {}
 
     adjacency_matrix(adjacency_matrix&&) = default;
     adjacency_matrix& operator=(adjacency_matrix&&) = default;
@@ -51,36 +58,26 @@ public:
     // --- general methods ---
 
     [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
-        return this->_matrix.size();
+        return this->_n_vertices;
     }
 
     [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
         return this->_n_unique_edges;
     }
 
-    // --- vertex methods ---
-
-    void add_vertex() {
-        for (auto& row : this->_matrix)
-            row.push_back(_make_null_edge());
-        auto& new_row = this->_matrix.emplace_back();
-        new_row.reserve(this->n_vertices());
-        std::generate_n(std::back_inserter(new_row), this->n_vertices(), _make_null_edge);
+    // the number of vertices the matrix can hold without reallocating (the row stride)
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_capacity;
     }
 
-    void add_vertices(const types::size_type n) {
-        const auto new_n_vertices = this->n_vertices() + n;
+    // --- vertex methods ---
 
-        for (auto& row : this->_matrix) {
-            row.reserve(new_n_vertices);
-            std::generate_n(std::back_inserter(row), n, _make_null_edge);
-        }
+    gl_attr_force_inline void add_vertex() {
+        this->_resize(this->_n_vertices + constants::one);
+    }
 
-        for (types::size_type _ = constants::begin_idx; _ < n; ++_) {
-            auto& new_row = this->_matrix.emplace_back();
-            new_row.reserve(new_n_vertices);
-            std::generate_n(std::back_inserter(new_row), new_n_vertices, _make_null_edge);
-        }
+    gl_attr_force_inline void add_vertices(const types::size_type n) {
+        this->_resize(this->_n_vertices + n);
     }
 
     [[nodiscard]] gl_attr_force_inline types::size_type in_degree(const types::id_type vertex_id
@@ -110,8 +107,42 @@ public:
         return specialized_impl::degree_map(*this);
     }
 
-    gl_attr_force_inline void remove_vertex(const vertex_type& vertex) {
-        specialized_impl::remove_vertex(*this, vertex.id());
+    void remove_vertex(const vertex_type& vertex) {
+        std::vector<bool> removed(this->_n_vertices, false);
+        removed[vertex.id()] = true;
+        this->remove_vertices(removed);
+    }
+
+    void remove_vertices(const std::vector<bool>& removed) {
+        this->_n_unique_edges -= specialized_impl::n_incident_edges(*this, removed);
+
+        // the kept cells are moved towards the beginning of the buffer in the row-major order,
+        // so each target cell is either the source cell or a cell which has already been visited
+        types::id_type new_u_id = constants::initial_id;
+        for (types::id_type u_id = constants::initial_id; u_id < this->_n_vertices; ++u_id) {
+            if (removed[u_id])
+                continue;
+
+            types::id_type new_v_id = constants::initial_id;
+            for (types::id_type v_id = constants::initial_id; v_id < this->_n_vertices; ++v_id) {
+                if (removed[v_id])
+                    continue;
+
+                if (new_u_id != u_id or new_v_id != v_id)
+                    this->_cell(new_u_id, new_v_id) = std::move(this->_cell(u_id, v_id));
+                ++new_v_id;
+            }
+            ++new_u_id;
+        }
+
+        // release the edges left outside of the new block
+        for (types::id_type u_id = constants::initial_id; u_id < this->_n_vertices; ++u_id) {
+            const auto first_cleared_id = u_id < new_u_id ? new_u_id : constants::initial_id;
+            for (types::id_type v_id = first_cleared_id; v_id < this->_n_vertices; ++v_id)
+                this->_cell(u_id, v_id) = nullptr;
+        }
+
+        this->_n_vertices = new_u_id;
     }
 
     // --- edge methods ---
@@ -131,10 +162,15 @@ public:
         specialized_impl::add_edges_from(*this, source_id, std::move(new_edges));
     }
 
+    gl_attr_force_inline void add_edges(std::vector<edge_ptr_type> new_edges) {
+        specialized_impl::add_edges(*this, std::move(new_edges));
+    }
+
     [[nodiscard]] gl_attr_force_inline bool has_edge(
         const types::id_type first_id, const types::id_type second_id
     ) const {
-        return this->_matrix[first_id][second_id] != nullptr;
+        return this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)
+           and this->_cell(first_id, second_id) != nullptr;
     }
 
     [[nodiscard]] bool has_edge(const edge_type& edge) const {
@@ -144,7 +180,7 @@ public:
         if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
             return false;
 
-        const auto& matrix_element = this->_matrix[first_id][second_id];
+        const auto& matrix_element = this->_cell(first_id, second_id);
         return matrix_element != nullptr and &edge == matrix_element.get();
     }
 
@@ -154,7 +190,7 @@ public:
         if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
             return std::nullopt;
 
-        const auto& matrix_element = this->_matrix[first_id][second_id];
+        const auto& matrix_element = this->_cell(first_id, second_id);
         if (not matrix_element)
             return std::nullopt;
         return std::cref(*matrix_element);
@@ -167,10 +203,11 @@ public:
     [[nodiscard]] inline types::iterator_range<edge_iterator_type> adjacent_edges(
         const types::id_type vertex_id
     ) const {
-        const auto& row = this->_matrix[vertex_id];
+        const auto row_begin = this->_row_begin(vertex_id);
+        const auto row_end = std::next(row_begin, this->_n_vertices);
         return make_iterator_range(
-            types::dereferencing_iterator(non_null_cbegin(row)),
-            types::dereferencing_iterator(non_null_cend(row))
+            types::dereferencing_iterator(types::non_null_iterator(row_begin, row_begin, row_end)),
+            types::dereferencing_iterator(types::non_null_iterator(row_begin, row_end, row_end))
         );
     }
 
@@ -178,17 +215,69 @@ private:
     using specialized_impl = typename specialized::matrix_impl_traits<adjacency_matrix>::type;
     friend specialized_impl;
 
-    static constexpr edge_ptr_type _make_null_edge() {
-        return nullptr;
-    }
+    template <type_traits::c_instantiation_of<adjacency_matrix> AdjacencyMatrix>
+    friend typename AdjacencyMatrix::edge_ptr_type& specialized::detail::strict_get(
+        AdjacencyMatrix& self, const typename AdjacencyMatrix::edge_type* edge
+    );
 
     [[nodiscard]] gl_attr_force_inline bool _is_valid_vertex_id(const types::id_type vertex_id
     ) const {
-        return vertex_id < this->_matrix.size();
+        return vertex_id < this->_n_vertices;
+    }
+
+    [[nodiscard]] gl_attr_force_inline edge_ptr_type& _cell(
+        const types::id_type first_id, const types::id_type second_id
+    ) {
+        return this->_matrix[first_id * this->_capacity + second_id];
+    }
+
+    [[nodiscard]] gl_attr_force_inline const edge_ptr_type& _cell(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return this->_matrix[first_id * this->_capacity + second_id];
+    }
+
+    [[nodiscard]] gl_attr_force_inline typename matrix_type::const_iterator _row_begin(
+        const types::id_type vertex_id
+    ) const {
+        return std::next(this->_matrix.cbegin(), vertex_id * this->_capacity);
+    }
+
+    [[nodiscard]] gl_attr_force_inline std::span<edge_ptr_type> _row(const types::id_type vertex_id
+    ) {
+        return {this->_matrix.data() + vertex_id * this->_capacity, this->_n_vertices};
+    }
+
+    [[nodiscard]] gl_attr_force_inline std::span<const edge_ptr_type> _row(
+        const types::id_type vertex_id
+    ) const {
+        return {this->_matrix.data() + vertex_id * this->_capacity, this->_n_vertices};
+    }
+
+    void _resize(const types::size_type n_vertices) {
+        if (n_vertices > this->_capacity) {
+            // the capacity is (at least) doubled so that adding the vertices one by one
+            // takes amortized O(n) time
+            const auto capacity = std::max(n_vertices, this->_capacity * constants::two);
+
+            matrix_type matrix(capacity * capacity, this->_matrix.get_allocator());
+            for (types::id_type id = constants::initial_id; id < this->_n_vertices; ++id) {
+                const auto row = this->_row(id);
+                std::ranges::move(row, std::next(matrix.begin(), id * capacity));
+            }
+
+            this->_matrix = std::move(matrix);
+            this->_capacity = capacity;
+        }
+
+        // the cells of the new vertices are already null
+        this->_n_vertices = n_vertices;
     }
 
     matrix_type _matrix{};
+    types::size_type _n_vertices{constants::default_size};
+    types::size_type _capacity{constants::default_size};
     types::size_type _n_unique_edges{constants::default_size};
 };
 
-} // namespace gl::impl
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -0,0 +1,424 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "cell_index.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/decl/impl_tags.hpp"
+#include "gl/io/format.hpp"
+#include "gl/types/dereferencing_iterator.hpp"
+#include "gl/types/iterator_range.hpp"
+#include "gl/types/types.hpp"
+#include "gl/util/compact.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+/*
+A sparse adjacency matrix representation which stores only the non-empty cells of the matrix.
+The cells are indexed by a flat open addressing hash table keyed on the (first_id, second_id)
+    pairs, so the `has_edge` and `get_edge` queries take constant time (on average),
+    while the memory usage is O(V + E) instead of O(V^2).
+The edges are owned by the rows of their incident vertices (for undirected graphs
+    each edge is shared by the rows of both of its vertices) and the hash table stores
+    the positions of the edges in these rows.
+The removed edges are replaced by the last edges of the rows, so the order of the adjacent
+    edges is not preserved on removal.
+For directed graphs the in-degrees of the vertices are kept in per-vertex counters updated
+    on edge insertion and removal.
+*/
+
+template <type_traits::c_sparse_matrix_graph_traits GraphTraits>
+class adjacency_sparse_matrix final {
+public:
+    using vertex_type = typename GraphTraits::vertex_type;
+
+    using edge_type = typename GraphTraits::edge_type;
+    using edge_ptr_type = typename GraphTraits::edge_ptr_type;
+    using edge_directional_tag = typename GraphTraits::edge_directional_tag;
+
+    using allocator_type = typename GraphTraits::allocator_type;
+
+    using edge_list_type = typename GraphTraits::template vector_type<edge_ptr_type>;
+    using edge_iterator_type =
+        types::dereferencing_iterator<typename edge_list_type::const_iterator>;
+
+    using row_list_type = typename GraphTraits::template vector_type<edge_list_type>;
+    using degree_list_type = typename GraphTraits::template vector_type<types::size_type>;
+
+    adjacency_sparse_matrix(const adjacency_sparse_matrix&) = delete;
+    adjacency_sparse_matrix& operator=(const adjacency_sparse_matrix&) = delete;
+
+    adjacency_sparse_matrix() = default;
+
+    explicit adjacency_sparse_matrix(const allocator_type& allocator)
+    : _rows(allocator), _cells(allocator), _in_degrees(allocator) {}
+
+    adjacency_sparse_matrix(
+        const types::size_type n_vertices, const allocator_type& allocator = {}
+    )
+    : adjacency_sparse_matrix(allocator) {
+        this->_rows.resize(n_vertices);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(n_vertices, constants::zero);
+    }
+
+    adjacency_sparse_matrix(adjacency_sparse_matrix&&) = default;
+    adjacency_sparse_matrix& operator=(adjacency_sparse_matrix&&) = default;
+
+    ~adjacency_sparse_matrix() = default;
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_rows.size();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_n_unique_edges;
+    }
+
+    // --- vertex methods ---
+
+    gl_attr_force_inline void add_vertex() {
+        this->_rows.emplace_back();
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.push_back(constants::zero);
+    }
+
+    gl_attr_force_inline void add_vertices(const types::size_type n) {
+        this->_rows.resize(this->n_vertices() + n);
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.resize(this->n_vertices(), constants::zero);
+    }
+
+    [[nodiscard]] types::size_type in_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_in_degrees[vertex_id];
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type out_degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return this->_rows[vertex_id].size();
+        else
+            return this->degree(vertex_id);
+    }
+
+    [[nodiscard]] types::size_type degree(const types::id_type vertex_id) const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            return this->in_degree(vertex_id) + this->out_degree(vertex_id);
+        }
+        else {
+            // loops are stored once but counted twice
+            return this->_rows[vertex_id].size()
+                 + static_cast<types::size_type>(this->_cells.find(vertex_id, vertex_id) != nullptr);
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> in_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            return {this->_in_degrees.begin(), this->_in_degrees.end()};
+        else
+            return this->degree_map();
+    }
+
+    [[nodiscard]] std::vector<types::size_type> out_degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> out_degree_map;
+            out_degree_map.reserve(this->n_vertices());
+            for (const auto& row : this->_rows)
+                out_degree_map.push_back(row.size());
+            return out_degree_map;
+        }
+        else {
+            return this->degree_map();
+        }
+    }
+
+    [[nodiscard]] std::vector<types::size_type> degree_map() const {
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            std::vector<types::size_type> degree_map = this->in_degree_map();
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map[id] += this->_rows[id].size();
+            return degree_map;
+        }
+        else {
+            std::vector<types::size_type> degree_map;
+            degree_map.reserve(this->n_vertices());
+            for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+                degree_map.push_back(this->degree(id));
+            return degree_map;
+        }
+    }
+
+    void remove_vertex(const vertex_type& vertex) {
+        std::vector<bool> removed(this->n_vertices(), false);
+        removed[vertex.id()] = true;
+        this->remove_vertices(removed);
+    }
+
+    void remove_vertices(const std::vector<bool>& removed) {
+        // the rows of the removed vertices are dropped entirely, so only the edges
+        // incident with the removed vertices have to be erased from the remaining rows
+        for (types::id_type id = constants::initial_id; id < this->n_vertices(); ++id)
+            if (not removed[id])
+                std::erase_if(this->_rows[id], [&removed](const auto& edge) {
+                    return removed[edge->first_id()] or removed[edge->second_id()];
+                });
+
+        util::compact(this->_rows, removed);
+
+        // the ids of the vertices change so the cell index has to be rebuilt
+        this->_rebuild_cells(util::compacted_ids(removed));
+    }
+
+    // --- edge methods ---
+
+    const edge_type& add_edge(edge_ptr_type edge) {
+        this->_check_edge_override(*edge);
+
+        const auto& added_edge = this->_insert_edge(std::move(edge));
+        ++this->_n_unique_edges;
+        return added_edge;
+    }
+
+    void add_edges_from(const types::id_type source_id, std::vector<edge_ptr_type> new_edges) {
+        this->_check_new_edges(new_edges);
+
+        auto& row_source = this->_rows[source_id];
+        row_source.reserve(row_source.size() + new_edges.size());
+        this->_insert_edges(std::move(new_edges));
+    }
+
+    void add_edges(std::vector<edge_ptr_type> new_edges) {
+        this->_check_new_edges(new_edges);
+        this->_insert_edges(std::move(new_edges));
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool has_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return this->_find(first_id, second_id) != nullptr;
+    }
+
+    [[nodiscard]] bool has_edge(const edge_type& edge) const {
+        const auto* position = this->_find(edge.first_id(), edge.second_id());
+        return position != nullptr and &edge == &this->_edge_at(edge, *position);
+    }
+
+    [[nodiscard]] types::optional_ref<const edge_type> get_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        const auto* position = this->_find(first_id, second_id);
+        if (position == nullptr)
+            return std::nullopt;
+
+        const auto [row_id, _] = _cell(first_id, second_id);
+        return std::cref(*this->_rows[row_id][position->first_idx]);
+    }
+
+    void remove_edge(const edge_type& edge) {
+        if (not this->has_edge(edge))
+            throw std::invalid_argument(std::format(
+                "Got invalid edge [vertices = ({}, {}) | addr = {}]",
+                edge.first_id(),
+                edge.second_id(),
+                io::format(&edge)
+            ));
+
+        const auto [first_id, second_id] = _cell(edge.first_id(), edge.second_id());
+        const auto position = *this->_cells.find(first_id, second_id);
+        this->_cells.erase(first_id, second_id);
+
+        // for undirected graphs the edge is destroyed when it is erased from the first row
+        if constexpr (type_traits::is_undirected_v<edge_type>) {
+            if (first_id != second_id)
+                this->_erase_from_row(second_id, position.second_idx);
+        }
+        else {
+            --this->_in_degrees[second_id];
+        }
+        this->_erase_from_row(first_id, position.first_idx);
+
+        --this->_n_unique_edges;
+    }
+
+    [[nodiscard]] types::iterator_range<edge_iterator_type> adjacent_edges(
+        const types::id_type vertex_id
+    ) const {
+        const auto& row = this->_rows[vertex_id];
+        return make_iterator_range(
+            edge_iterator_type(row.cbegin()), edge_iterator_type(row.cend())
+        );
+    }
+
+private:
+    using cell_type = types::homogeneous_pair<types::id_type>;
+
+    // the positions of an edge in the rows of the first and the second vertex of its cell
+    struct cell_position {
+        types::size_type first_idx = constants::zero;
+        types::size_type second_idx = constants::zero; // used only by undirected graphs
+    };
+
+    // undirected edges are stored in the table once for both orientations of the cell
+    [[nodiscard]] gl_attr_force_inline static cell_type _cell(
+        const types::id_type first_id, const types::id_type second_id
+    ) {
+        if constexpr (type_traits::is_undirected_v<edge_type>)
+            return std::minmax(first_id, second_id);
+        else
+            return cell_type{first_id, second_id};
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool _is_valid_vertex_id(const types::id_type vertex_id
+    ) const {
+        return vertex_id < this->n_vertices();
+    }
+
+    [[nodiscard]] const cell_position* _find(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        if (not (this->_is_valid_vertex_id(first_id) and this->_is_valid_vertex_id(second_id)))
+            return nullptr;
+
+        const auto [cell_first_id, cell_second_id] = _cell(first_id, second_id);
+        return this->_cells.find(cell_first_id, cell_second_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline const edge_type& _edge_at(
+        const edge_type& edge, const cell_position& position
+    ) const {
+        const auto [row_id, _] = _cell(edge.first_id(), edge.second_id());
+        return *this->_rows[row_id][position.first_idx];
+    }
+
+    void _check_edge_override(const edge_type& edge) const {
+        const auto [first_id, second_id] = edge.incident_vertex_ids();
+
+        if (this->has_edge(first_id, second_id))
+            throw std::logic_error(std::format(
+                "Cannot override an existing edge without remove: ({}, {})", first_id, second_id
+            ));
+    }
+
+    // validates the new edges against the present edges and each other
+    void _check_new_edges(const std::vector<edge_ptr_type>& new_edges) const {
+        std::vector<cell_type> new_cells;
+        new_cells.reserve(new_edges.size());
+
+        for (const auto& edge : new_edges) {
+            this->_check_edge_override(*edge);
+            new_cells.push_back(_cell(edge->first_id(), edge->second_id()));
+        }
+
+        std::ranges::sort(new_cells);
+        const auto duplicate_it = std::ranges::adjacent_find(new_cells);
+        if (duplicate_it != new_cells.end())
+            throw std::logic_error(std::format(
+                "Cannot override an existing edge without remove: ({}, {})",
+                duplicate_it->first,
+                duplicate_it->second
+            ));
+    }
+
+    void _insert_edges(std::vector<edge_ptr_type> new_edges) {
+        this->_cells.reserve(this->_cells.size() + new_edges.size());
+        for (auto& edge : new_edges)
+            this->_insert_edge(std::move(edge));
+        this->_n_unique_edges += new_edges.size();
+    }
+
+    const edge_type& _insert_edge(edge_ptr_type edge) {
+        const auto [first_id, second_id] = _cell(edge->first_id(), edge->second_id());
+        auto& row_first = this->_rows[first_id];
+
+        if constexpr (type_traits::is_directed_v<edge_type>) {
+            this->_cells.insert(first_id, second_id, cell_position{row_first.size()});
+            ++this->_in_degrees[second_id];
+        }
+        else {
+            auto& row_second = this->_rows[second_id];
+            this->_cells.insert(
+                first_id,
+                second_id,
+                cell_position{
+                    row_first.size(), first_id == second_id ? row_first.size() : row_second.size()
+                }
+            );
+            if (first_id != second_id)
+                row_second.push_back(edge);
+        }
+
+        row_first.push_back(std::move(edge));
+        return *row_first.back();
+    }
+
+    // erases the edge at the given position by moving the last edge of the row into its slot
+    void _erase_from_row(const types::id_type row_id, const types::size_type idx) {
+        auto& row = this->_rows[row_id];
+
+        if (idx != row.size() - constants::one) {
+            row[idx] = std::move(row.back());
+
+            const auto [first_id, second_id] = _cell(row[idx]->first_id(), row[idx]->second_id());
+            auto* moved_position = this->_cells.find(first_id, second_id);
+            if (row_id == first_id)
+                moved_position->first_idx = idx;
+            if (row_id == second_id)
+                moved_position->second_idx = idx;
+        }
+
+        row.pop_back();
+    }
+
+    // rebuilds the cell index (and the in-degree counters) after the vertex ids have changed
+    void _rebuild_cells(const std::vector<types::id_type>& new_ids) {
+        this->_cells.clear();
+        this->_n_unique_edges = constants::default_size;
+        if constexpr (type_traits::is_directed_v<edge_type>)
+            this->_in_degrees.assign(this->n_vertices(), constants::zero);
+
+        types::size_type n_row_edges = constants::default_size;
+        for (const auto& row : this->_rows)
+            n_row_edges += row.size();
+        this->_cells.reserve(n_row_edges);
+
+        for (types::id_type row_id = constants::initial_id; row_id < this->n_vertices(); ++row_id) {
+            const auto& row = this->_rows[row_id];
+            for (types::size_type idx = constants::begin_idx; idx < row.size(); ++idx) {
+                const auto [first_id, second_id] =
+                    _cell(new_ids[row[idx]->first_id()], new_ids[row[idx]->second_id()]);
+
+                auto* position = this->_cells.find(first_id, second_id);
+                if (position == nullptr) {
+                    position = &this->_cells.insert(first_id, second_id, cell_position{});
+                    ++this->_n_unique_edges;
+                    if constexpr (type_traits::is_directed_v<edge_type>)
+                        ++this->_in_degrees[second_id];
+                }
+
+                if (row_id == first_id)
+                    position->first_idx = idx;
+                if (row_id == second_id)
+                    position->second_idx = idx;
+            }
+        }
+    }
+
+    row_list_type _rows{};
+    cell_index<cell_position, allocator_type> _cells{};
+    degree_list_type _in_degrees{}; // used only by directed graphs
+    types::size_type _n_unique_edges = constants::default_size;
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -0,0 +1,102 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "detail/open_addressing_table.hpp"
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+/*
+An open addressing hash table (see `detail::open_addressing_table`) mapping
+    the (first_id, second_id) cells of an adjacency matrix to the values associated with them.
+Each cell can be stored in the table at most once.
+*/
+
+template <typename ValueType, typename Allocator = std::allocator<ValueType>>
+class cell_index {
+public:
+    using value_type = ValueType;
+    using allocator_type = Allocator;
+
+    cell_index() = default;
+
+    explicit cell_index(const allocator_type& allocator) : _table(allocator) {}
+
+    cell_index(const cell_index&) = delete;
+    cell_index& operator=(const cell_index&) = delete;
+
+    cell_index(cell_index&&) = default;
+    cell_index& operator=(cell_index&&) = default;
+
+    ~cell_index() = default;
+
+    [[nodiscard]] gl_attr_force_inline types::size_type size() const {
+        return this->_table.size();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_table.capacity();
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type n) {
+        this->_table.reserve(n);
+    }
+
+    gl_attr_force_inline void clear() {
+        this->_table.clear();
+    }
+
+    // inserts the value of the given cell, which must not be present in the table
+    gl_attr_force_inline value_type& insert(
+        const types::id_type first_id, const types::id_type second_id, const value_type& value
+    ) {
+        return this->_table.insert(cell_type{first_id, second_id}, value);
+    }
+
+    [[nodiscard]] gl_attr_force_inline value_type* find(
+        const types::id_type first_id, const types::id_type second_id
+    ) {
+        return this->_table.find(cell_type{first_id, second_id});
+    }
+
+    [[nodiscard]] gl_attr_force_inline const value_type* find(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return this->_table.find(cell_type{first_id, second_id});
+    }
+
+    gl_attr_force_inline bool erase(const types::id_type first_id, const types::id_type second_id) {
+        return this->_table.erase(cell_type{first_id, second_id});
+    }
+
+private:
+    using cell_type = types::homogeneous_pair<types::id_type>;
+
+    struct key_traits {
+        static constexpr cell_type empty_key{constants::invalid_id, constants::invalid_id};
+
+        [[nodiscard]] gl_attr_force_inline static std::uint64_t hash(const cell_type& cell) {
+            // the ids are mixed before fibonacci hashing so that both of them affect the upper bits
+            return static_cast<std::uint64_t>(cell.first)
+                 ^ (static_cast<std::uint64_t>(cell.second) * _mix_multiplier);
+        }
+
+        static constexpr std::uint64_t _mix_multiplier = 0xC2B2AE3D27D4EB4Full;
+    };
+
+    using table_type =
+        detail::open_addressing_table<cell_type, value_type, key_traits, allocator_type>;
+
+    table_type _table{};
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
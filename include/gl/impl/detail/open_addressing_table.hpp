@@ -0,0 +1,215 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::impl::detail {
+
+// the value predicate of the open addressing table matching the values of any entry
+struct any_table_value {
+    template <typename ValueType>
+    [[nodiscard]] gl_attr_force_inline constexpr bool operator()(const ValueType&) const noexcept {
+        return true;
+    }
+};
+
+/*
+An open addressing (linear probing) hash table mapping the keys to the values.
+The `KeyTraits` type defines the `empty_key` which marks the empty slots (and therefore cannot
+    be inserted) and the `hash` function, the result of which is mapped to a slot with
+    fibonacci hashing.
+The uniqueness of the inserted keys is not checked - the entries with equal keys can be
+    distinguished with the value predicates of the `find` and `erase` methods.
+The table does not allocate any memory until it is activated with `reserve` or `insert`.
+*/
+
+template <typename KeyType, typename ValueType, typename KeyTraits, typename Allocator>
+class open_addressing_table {
+public:
+    using key_type = KeyType;
+    using value_type = ValueType;
+    using allocator_type = Allocator;
+
+    open_addressing_table() = default;
+
+    explicit open_addressing_table(const allocator_type& allocator) : _entries(allocator) {}
+
+    open_addressing_table(const open_addressing_table&) = delete;
+    open_addressing_table& operator=(const open_addressing_table&) = delete;
+
+    open_addressing_table(open_addressing_table&&) = default;
+    open_addressing_table& operator=(open_addressing_table&&) = default;
+
+    open_addressing_table(open_addressing_table&& other, const allocator_type& allocator)
+    : _entries(std::move(other._entries), allocator),
+      _size(other._size),
+      _capacity(other._capacity) {}
+
+    ~open_addressing_table() = default;
+
+    [[nodiscard]] gl_attr_force_inline bool is_active() const {
+        return this->_capacity != constants::zero;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type size() const {
+        return this->_size;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_capacity;
+    }
+
+    void reserve(const types::size_type n) {
+        const auto capacity = _capacity_for(n);
+        if (capacity > this->_capacity)
+            this->_rehash(capacity);
+    }
+
+    // releases the memory of the table
+    void clear() {
+        this->_entries = entry_list_type(this->_entries.get_allocator());
+        this->_size = constants::zero;
+        this->_capacity = constants::zero;
+    }
+
+    value_type& insert(const key_type& key, const value_type& value) {
+        this->reserve(this->_size + constants::one);
+        ++this->_size;
+        return this->_insert_entry(entry{key, value}).value;
+    }
+
+    // returns the value of the first entry with the given key, which satisfies the predicate
+    template <std::predicate<const value_type&> ValuePredicate = any_table_value>
+    [[nodiscard]] value_type* find(const key_type& key, const ValuePredicate& pred = {}) {
+        const auto idx = this->_find_idx(key, pred);
+        return idx == this->_capacity ? nullptr : &this->_entries[idx].value;
+    }
+
+    template <std::predicate<const value_type&> ValuePredicate = any_table_value>
+    [[nodiscard]] const value_type* find(const key_type& key, const ValuePredicate& pred = {})
+        const {
+        const auto idx = this->_find_idx(key, pred);
+        return idx == this->_capacity ? nullptr : &this->_entries[idx].value;
+    }
+
+    // removes the first entry with the given key, which satisfies the predicate
+    template <std::predicate<const value_type&> ValuePredicate = any_table_value>
+    bool erase(const key_type& key, const ValuePredicate& pred = {}) {
+        auto hole = this->_find_idx(key, pred);
+        if (hole == this->_capacity)
+            return false;
+
+        // backward shift deletion: move the following entries of the probe sequence
+        // into the hole unless it would place them before their home slots
+        for (auto idx = this->_next_idx(hole); not this->_entries[idx].is_empty();
+             idx = this->_next_idx(idx)) {
+            const auto home_idx = this->_home_idx(this->_entries[idx].key);
+            if (this->_distance(home_idx, idx) >= this->_distance(hole, idx)) {
+                this->_entries[hole] = this->_entries[idx];
+                hole = idx;
+            }
+        }
+
+        this->_entries[hole] = entry{};
+        --this->_size;
+        return true;
+    }
+
+private:
+    struct entry {
+        key_type key = KeyTraits::empty_key;
+        value_type value{};
+
+        [[nodiscard]] gl_attr_force_inline bool is_empty() const {
+            return this->key == KeyTraits::empty_key;
+        }
+    };
+
+    using entry_list_type = std::vector<
+        entry,
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<entry>>;
+
+    // the load factor of the table is kept at or below 1/2
+    [[nodiscard]] gl_attr_force_inline static types::size_type _capacity_for(
+        const types::size_type n
+    ) {
+        return std::bit_ceil(std::max(n * constants::two, _min_capacity));
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type _home_idx(const key_type& key) const {
+        // fibonacci hashing - the upper bits of the product are used as the slot index
+        const auto shift = _hash_digits - std::countr_zero(this->_capacity);
+        return static_cast<types::size_type>((KeyTraits::hash(key) * _hash_multiplier) >> shift);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type _next_idx(const types::size_type idx
+    ) const {
+        return (idx + constants::one) & (this->_capacity - constants::one);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type _distance(
+        const types::size_type from, const types::size_type to
+    ) const {
+        return (to - from) & (this->_capacity - constants::one);
+    }
+
+    // returns the index of the slot of the matching entry or the capacity if there is none
+    template <typename ValuePredicate>
+    [[nodiscard]] types::size_type _find_idx(const key_type& key, const ValuePredicate& pred)
+        const {
+        if (not this->is_active())
+            return this->_capacity;
+
+        for (auto idx = this->_home_idx(key); not this->_entries[idx].is_empty();
+             idx = this->_next_idx(idx)) {
+            const auto& current = this->_entries[idx];
+            if (current.key == key and pred(current.value))
+                return idx;
+        }
+
+        return this->_capacity;
+    }
+
+    entry& _insert_entry(const entry& new_entry) {
+        auto idx = this->_home_idx(new_entry.key);
+        while (not this->_entries[idx].is_empty())
+            idx = this->_next_idx(idx);
+        return this->_entries[idx] = new_entry;
+    }
+
+    void _rehash(const types::size_type capacity) {
+        auto entries = std::exchange(
+            this->_entries, entry_list_type(capacity, this->_entries.get_allocator())
+        );
+        const auto old_capacity = std::exchange(this->_capacity, capacity);
+
+        for (types::size_type idx = constants::begin_idx; idx < old_capacity; ++idx)
+            if (not entries[idx].is_empty())
+                this->_insert_entry(entries[idx]);
+    }
+
+    static constexpr types::size_type _min_capacity = 16ull;
+    static constexpr std::uint64_t _hash_multiplier = 0x9E3779B97F4A7C15ull;
+    static constexpr int _hash_digits = std::numeric_limits<std::uint64_t>::digits;
+
+    entry_list_type _entries{};
+    types::size_type _size = constants::zero;
+    types::size_type _capacity = constants::zero;
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl::detail
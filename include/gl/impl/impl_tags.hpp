@@ -4,17 +4,27 @@
 
 #pragma once
 
+#include "adjacency_bit_matrix.hpp"
+#include "adjacency_compressed.hpp"
+#include "adjacency_csr.hpp"
 #include "adjacency_list.hpp"
 #include "adjacency_matrix.hpp"
+#include "adjacency_sparse_matrix.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/decl/impl_tags.hpp"
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace impl {
 
-struct list_t {
+/*
+The adjacency list implementation tag parametrized with a set of list options.
+The `list_t` alias denotes the list representation with no options.
+*/
+template <type_traits::c_list_option... Options>
+struct basic_list_t {
     template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
-    requires(std::same_as<typename GraphTraits::implementation_tag, list_t>)
+    requires(std::same_as<typename GraphTraits::implementation_tag, basic_list_t>)
     using type = adjacency_list<GraphTraits>;
 };
 
@@ -24,6 +34,34 @@ struct matrix_t {
     using type = adjacency_matrix<GraphTraits>;
 };
 
+/*
+The bit-packed adjacency matrix implementation tag, available only for the graphs with
+    no edge properties. The edges of such graphs are not stored - see `adjacency_bit_matrix`.
+*/
+struct bit_matrix_t {
+    template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+    requires(std::same_as<typename GraphTraits::implementation_tag, bit_matrix_t>)
+    using type = adjacency_bit_matrix<GraphTraits>;
+};
+
+struct sparse_matrix_t {
+    template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+    requires(std::same_as<typename GraphTraits::implementation_tag, sparse_matrix_t>)
+    using type = adjacency_sparse_matrix<GraphTraits>;
+};
+
+struct csr_t {
+    template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+    requires(std::same_as<typename GraphTraits::implementation_tag, csr_t>)
+    using type = adjacency_csr<GraphTraits>;
+};
+
+struct compressed_t {
+    template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+    requires(std::same_as<typename GraphTraits::implementation_tag, compressed_t>)
+    using type = adjacency_compressed<GraphTraits>;
+};
+
 } // namespace impl
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
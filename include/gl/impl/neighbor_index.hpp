@@ -0,0 +1,100 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "detail/open_addressing_table.hpp"
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace gl::inline gl_id_type_namespace::impl {
+
+/*
+An open addressing hash table (see `detail::open_addressing_table`) mapping the ids
+    of the neighbors of a vertex to the edges connecting the vertex with them.
+Parallel edges are stored as separate entries with the same neighbor id.
+The index does not allocate any memory until it is activated with `reserve` or `insert`.
+*/
+
+template <typename EdgeType, typename Allocator = std::allocator<EdgeType>>
+class neighbor_index {
+public:
+    using edge_type = EdgeType;
+    using allocator_type = Allocator;
+
+    neighbor_index() = default;
+
+    explicit neighbor_index(const allocator_type& allocator) : _table(allocator) {}
+
+    neighbor_index(const neighbor_index&) = delete;
+    neighbor_index& operator=(const neighbor_index&) = delete;
+
+    neighbor_index(neighbor_index&&) = default;
+    neighbor_index& operator=(neighbor_index&&) = default;
+
+    // allows the indices to be stored in allocator-aware containers
+    neighbor_index(neighbor_index&& other, const allocator_type& allocator)
+    : _table(std::move(other._table), allocator) {}
+
+    ~neighbor_index() = default;
+
+    [[nodiscard]] gl_attr_force_inline bool is_active() const {
+        return this->_table.is_active();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type size() const {
+        return this->_table.size();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_table.capacity();
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type n) {
+        this->_table.reserve(n);
+    }
+
+    gl_attr_force_inline void reset() {
+        this->_table.clear();
+    }
+
+    gl_attr_force_inline void insert(const types::id_type neighbor_id, const edge_type* edge) {
+        this->_table.insert(neighbor_id, edge);
+    }
+
+    // returns any edge connecting the vertex with the given neighbor or nullptr if there is none
+    [[nodiscard]] const edge_type* find(const types::id_type neighbor_id) const {
+        const auto* edge = this->_table.find(neighbor_id);
+        return edge == nullptr ? nullptr : *edge;
+    }
+
+    bool erase(const types::id_type neighbor_id, const edge_type* edge) {
+        return this->_table.erase(neighbor_id, [edge](const edge_type* indexed_edge) {
+            return indexed_edge == edge;
+        });
+    }
+
+private:
+    struct key_traits {
+        // the invalid id is never a neighbor id
+        static constexpr types::id_type empty_key = constants::invalid_id;
+
+        [[nodiscard]] gl_attr_force_inline static std::uint64_t hash(const types::id_type id) {
+            return static_cast<std::uint64_t>(id);
+        }
+    };
+
+    using table_type =
+        detail::open_addressing_table<types::id_type, const edge_type*, key_traits, allocator_type>;
+
+    table_type _table{};
+};
+
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -4,14 +4,21 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/decl/impl_tags.hpp"
+#include "gl/util/compact.hpp"
 
 #include <algorithm>
 #include <format>
 #include <unordered_set>
 #include <vector>
 
-namespace gl::impl {
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+#include <atomic>
+#include <execution>
+#endif
+
+namespace gl::inline gl_id_type_namespace::impl {
 
 template <type_traits::c_list_graph_traits GraphTraits>
 class adjacency_list;
@@ -20,6 +27,16 @@ namespace specialized {
 
 namespace detail {
 
+template <typename EdgeType>
+[[nodiscard]] std::invalid_argument invalid_edge_error(const EdgeType* edge) {
+    return std::invalid_argument(std::format(
+        "Got invalid edge [vertices = ({}, {}) | addr = {}]",
+        edge->first_id(),
+        edge->second_id(),
+        io::format(edge)
+    ));
+}
+
 template <type_traits::c_instantiation_of<adjacency_list> AdjacencyList, typename AddressProjection>
 requires std::is_invocable_r_v<
     const typename AdjacencyList::edge_type*,
@@ -31,16 +48,65 @@ requires std::is_invocable_r_v<
     // find the edge by address
     const auto it = std::ranges::find(edge_set, edge, AddressProjection{});
     if (it == edge_set.end())
-        throw std::invalid_argument(std::format(
-            "Got invalid edge [vertices = ({}, {}) | addr = {}]",
-            edge->first_id(),
-            edge->second_id(),
-            io::format(edge)
-        ));
+        throw invalid_edge_error(edge);
 
     return it;
 }
 
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+// increments the counter at the given index and returns its previous value (thread-safe)
+[[nodiscard]] gl_attr_force_inline types::size_type fetch_increment(
+    std::vector<types::size_type>& counters, const types::id_type idx
+) {
+    return std::atomic_ref<types::size_type>{counters[idx]}.fetch_add(
+        constants::one, std::memory_order_relaxed
+    );
+}
+#endif
+
+/*
+Removes the element at the given index of an edge list by moving the last element
+    of the list into its slot. The `on_move` callback is invoked with the moved element
+    and its new index.
+*/
+template <typename EdgeList, typename OnMove>
+void swap_erase(EdgeList& edges, const types::size_type idx, OnMove on_move) {
+    const auto last_idx = edges.size() - constants::one;
+    if (idx != last_idx) {
+        edges[idx] = std::move(edges[last_idx]);
+        on_move(edges[idx], idx);
+    }
+    edges.pop_back();
+}
+
+/*
+Removes the elements satisfying the predicate from an edge list in a single stable pass.
+The `on_erase` callback is invoked with each removed element and the `on_move` callback
+    is invoked with each remaining element which changed its index and the new index.
+*/
+template <typename EdgeList, typename Predicate, typename OnErase, typename OnMove>
+types::size_type erase_edges_if(
+    EdgeList& edges, Predicate pred, OnErase on_erase, OnMove on_move
+) {
+    types::size_type n_kept = constants::default_size;
+    for (types::size_type i = constants::begin_idx; i < edges.size(); ++i) {
+        if (pred(edges[i])) {
+            on_erase(edges[i]);
+            continue;
+        }
+
+        if (n_kept != i) {
+            edges[n_kept] = std::move(edges[i]);
+            on_move(edges[n_kept], n_kept);
+        }
+        ++n_kept;
+    }
+
+    const auto n_erased = edges.size() - n_kept;
+    edges.erase(edges.begin() + static_cast<std::ptrdiff_t>(n_kept), edges.end());
+    return n_erased;
+}
+
 } // namespace detail
 
 template <type_traits::c_instantiation_of<adjacency_list> AdjacencyList>
@@ -52,6 +118,7 @@ struct directed_adjacency_list {
     using edge_ptr_type = typename impl_type::edge_ptr_type;
     using edge_list_type = typename impl_type::edge_list_type;
     using edge_iterator_type = typename impl_type::edge_iterator_type::iterator_type;
+    using edge_position = typename impl_type::edge_position;
 
     struct address_projection {
         [[nodiscard]] gl_attr_force_inline auto operator()(const edge_type& edge) {
@@ -66,6 +133,9 @@ struct directed_adjacency_list {
     [[nodiscard]] static types::size_type in_degree(
         const impl_type& self, const types::id_type vertex_id
     ) {
+        if constexpr (impl_type::has_in_edge_index)
+            return self._in_list[vertex_id].size();
+
         types::size_type in_deg = constants::default_size;
         for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
             const auto& adj_edges = self._list[id];
@@ -93,7 +163,14 @@ struct directed_adjacency_list {
     }
 
     [[nodiscard]] static std::vector<types::size_type> in_degree_map(const impl_type& self) {
-        std::vector<types::id_type> in_degree_map(self._list.size(), constants::zero);
+        if constexpr (impl_type::has_in_edge_index) {
+            const auto in_degree_view =
+                self._in_list
+                | std::views::transform([](const auto& in_edges) { return in_edges.size(); });
+            return std::vector<types::size_type>(in_degree_view.begin(), in_degree_view.end());
+        }
+
+        std::vector<types::size_type> in_degree_map(self._list.size(), constants::zero);
 
         for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
             std::ranges::for_each(self._list[id], [&in_degree_map](const auto& edge) {
@@ -114,11 +191,16 @@ struct directed_adjacency_list {
     }
 
     [[nodiscard]] static std::vector<types::size_type> degree_map(const impl_type& self) {
-        std::vector<types::id_type> degree_map(self._list.size(), constants::zero);
+        std::vector<types::size_type> degree_map(self._list.size(), constants::zero);
 
         for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
             degree_map[id] += self._list[id].size();
 
+            if constexpr (impl_type::has_in_edge_index) {
+                degree_map[id] += self._in_list[id].size();
+                continue;
+            }
+
             // update in degrees
             std::ranges::for_each(self._list[id], [&degree_map](const auto& edge) {
                 ++degree_map[edge->second_id()];
@@ -129,7 +211,15 @@ struct directed_adjacency_list {
     }
 
     static void remove_vertex(impl_type& self, const vertex_type& vertex) {
+        if constexpr (impl_type::has_in_edge_index) {
+            _remove_indexed_vertex(self, vertex);
+            return;
+        }
+
         const auto vertex_id = vertex.id();
+        const auto is_incident = [&vertex](const auto& edge) {
+            return edge->is_incident_with(vertex);
+        };
 
         // remove all edges incident to the vertex
         for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
@@ -137,37 +227,153 @@ struct directed_adjacency_list {
             if (id == vertex_id or adj_edges.empty())
                 continue;
 
-            const auto rem_subrange = std::ranges::remove_if(
-                adj_edges, [&vertex](const auto& edge) { return edge->is_incident_with(vertex); }
-            );
-            self._n_unique_edges -= std::ranges::distance(rem_subrange.begin(), rem_subrange.end());
-            adj_edges.erase(rem_subrange.begin(), rem_subrange.end());
+            self._n_unique_edges -=
+                _erase_edges_if(self, adj_edges, &edge_position::first_idx, is_incident);
         }
 
         // remove the list of edges incident from the vertex entirely
+        _erase_edge_positions(self, self._list[vertex_id]);
         self._n_unique_edges -= self._list[vertex_id].size();
         self._list.erase(std::next(std::begin(self._list), vertex_id));
     }
 
+    static void remove_vertices(impl_type& self, const std::vector<bool>& removed) {
+        const auto is_removed_target = [&removed](const auto& edge) {
+            return removed[edge->second_id()];
+        };
+        const auto is_removed_source = [&removed](const auto& edge) {
+            return removed[edge->first_id()];
+        };
+
+        for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
+            if (removed[id]) {
+                _erase_edge_positions(self, self._list[id]);
+                self._n_unique_edges -= self._list[id].size();
+                continue;
+            }
+
+            self._n_unique_edges -= _erase_edges_if(
+                self, self._list[id], &edge_position::first_idx, is_removed_target
+            );
+            if constexpr (impl_type::has_in_edge_index)
+                _erase_edges_if(
+                    self, self._in_list[id], &edge_position::second_idx, is_removed_source
+                );
+        }
+
+        util::compact(self._list, removed);
+        if constexpr (impl_type::has_in_edge_index)
+            util::compact(self._in_list, removed);
+    }
+
     static const edge_type& add_edge(impl_type& self, edge_ptr_type edge) {
-        auto& adjacent_edges_first = self._list[edge->first_id()];
-        adjacent_edges_first.push_back(std::move(edge));
+        _index_edge_position(self, edge.get());
+        if constexpr (impl_type::has_in_edge_index)
+            self._in_list[edge->second_id()].push_back(edge.get());
+
+        const auto source_id = edge->first_id();
+        const auto& new_edge = self._push_edge(source_id, std::move(edge));
+        self._index_neighbor(source_id, new_edge);
+
         ++self._n_unique_edges;
-        return *adjacent_edges_first.back();
+        return new_edge;
     }
 
     static void add_edges_from(
         impl_type& self, const types::id_type source_id, std::vector<edge_ptr_type> new_edges
     ) {
         auto& adjacent_edges_source = self._list[source_id];
+        const auto n_sorted = adjacent_edges_source.size();
         adjacent_edges_source.reserve(adjacent_edges_source.size() + new_edges.size());
 
-        for (auto& edge : new_edges)
+        for (auto& edge : new_edges) {
+            _index_edge_position(self, edge.get());
+            if constexpr (impl_type::has_in_edge_index)
+                self._in_list[edge->second_id()].push_back(edge.get());
             adjacent_edges_source.push_back(std::move(edge));
+            self._index_neighbor(source_id, *adjacent_edges_source.back());
+        }
 
+        self._merge_appended_edges(source_id, n_sorted);
         self._n_unique_edges += new_edges.size();
     }
 
+    static void add_edges(impl_type& self, std::vector<edge_ptr_type> new_edges) {
+        // count the new edges of each list so that every list is grown only once
+        std::vector<types::size_type> n_new_edges(self._list.size(), constants::zero);
+        for (const auto& edge : new_edges)
+            ++n_new_edges[edge->first_id()];
+        self._reserve_adjacent_edges(n_new_edges);
+
+        if constexpr (impl_type::has_in_edge_index) {
+            std::vector<types::size_type> n_new_in_edges(self._list.size(), constants::zero);
+            for (const auto& edge : new_edges)
+                ++n_new_in_edges[edge->second_id()];
+
+            for (types::id_type id = constants::initial_id; id < self._in_list.size(); ++id)
+                if (n_new_in_edges[id] > constants::zero)
+                    self._in_list[id].reserve(self._in_list[id].size() + n_new_in_edges[id]);
+        }
+
+        for (auto& edge : new_edges) {
+            const auto source_id = edge->first_id();
+            _index_edge_position(self, edge.get());
+            if constexpr (impl_type::has_in_edge_index)
+                self._in_list[edge->second_id()].push_back(edge.get());
+
+            auto& adjacent_edges_source = self._list[source_id];
+            adjacent_edges_source.push_back(std::move(edge));
+            self._index_neighbor(source_id, *adjacent_edges_source.back());
+        }
+
+        self._merge_new_adjacent_edges(n_new_edges);
+        self._n_unique_edges += new_edges.size();
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    /*
+    Two-pass bulk insertion: the degree histogram of the new edges is counted concurrently,
+        each list is resized once and the edges are then scattered concurrently into the
+        free slots of their lists (the order of the new edges within a list is unspecified
+        for parallel policies).
+    */
+    template <type_traits::c_execution_policy ExecutionPolicy>
+    static void add_edges(
+        impl_type& self, ExecutionPolicy&& policy, std::vector<edge_ptr_type> new_edges
+    ) {
+        std::vector<types::size_type> n_new_edges(self._list.size(), constants::zero);
+        [[maybe_unused]] std::vector<types::size_type> n_new_in_edges;
+        if constexpr (impl_type::has_in_edge_index)
+            n_new_in_edges.resize(self._list.size(), constants::zero);
+
+        std::for_each(policy, new_edges.begin(), new_edges.end(), [&](const auto& edge) {
+            (void)detail::fetch_increment(n_new_edges, edge->first_id());
+            if constexpr (impl_type::has_in_edge_index)
+                (void)detail::fetch_increment(n_new_in_edges, edge->second_id());
+        });
+
+        auto free_slot_idx = impl_type::_grow_edge_lists(self._list, n_new_edges, policy);
+        [[maybe_unused]] std::vector<types::size_type> free_in_slot_idx;
+        if constexpr (impl_type::has_in_edge_index)
+            free_in_slot_idx = impl_type::_grow_edge_lists(self._in_list, n_new_in_edges, policy);
+
+        std::for_each(policy, new_edges.begin(), new_edges.end(), [&](auto& edge) {
+            if constexpr (impl_type::has_in_edge_index) {
+                const auto target_id = edge->second_id();
+                self._in_list[target_id][detail::fetch_increment(free_in_slot_idx, target_id)] =
+                    edge.get();
+            }
+
+            const auto source_id = edge->first_id();
+            self._list[source_id][detail::fetch_increment(free_slot_idx, source_id)] =
+                std::move(edge);
+        });
+
+        self._merge_new_adjacent_edges(n_new_edges, policy);
+        self._n_unique_edges += new_edges.size();
+    }
+#endif
+
     [[nodiscard]] gl_attr_force_inline static bool is_edge_incident_to(
         const edge_ptr_type& edge,
         const types::id_type vertex_id,
@@ -183,10 +389,138 @@ struct directed_adjacency_list {
     }
 
     static void remove_edge(impl_type& self, const edge_type& edge) {
+        if constexpr (impl_type::has_edge_position_index) {
+            _remove_indexed_edge(self, edge);
+            return;
+        }
+
         auto& adj_edges = self._list.at(edge.first_id());
-        adj_edges.erase(detail::strict_find<impl_type, address_projection>(adj_edges, &edge));
+        const auto it = detail::strict_find<impl_type, address_projection>(adj_edges, &edge);
+        self._unindex_neighbor(edge.first_id(), edge);
+
+        if constexpr (impl_type::has_in_edge_index) {
+            // if the edge was found in the source list, it will also be present in the target list
+            auto& in_edges = self._in_list[edge.second_id()];
+            in_edges.erase(std::ranges::find(in_edges, &edge));
+        }
+
+        adj_edges.erase(it);
+        --self._n_unique_edges;
+    }
+
+private:
+    // --- edge position index methods ---
+
+    static void _index_edge_position(impl_type& self, const edge_type* edge) {
+        if constexpr (impl_type::has_edge_position_index) {
+            // the edge will be placed at the back of its lists
+            types::size_type second_idx = constants::default_size;
+            if constexpr (impl_type::has_in_edge_index)
+                second_idx = self._in_list[edge->second_id()].size();
+
+            self._edge_positions.emplace(
+                edge, edge_position{self._list[edge->first_id()].size(), second_idx}
+            );
+        }
+    }
+
+    template <typename EdgeList>
+    gl_attr_force_inline static void _erase_edge_positions(
+        impl_type& self, const EdgeList& edges
+    ) {
+        if constexpr (impl_type::has_edge_position_index)
+            for (const auto& edge : edges)
+                self._edge_positions.erase(&*edge);
+    }
+
+    [[nodiscard]] gl_attr_force_inline static auto _position_updater(
+        impl_type& self, types::size_type edge_position::*position_idx
+    ) {
+        return [&self, position_idx](const auto& edge, const types::size_type idx) {
+            self._edge_positions.at(&*edge).*position_idx = idx;
+        };
+    }
+
+    template <typename EdgeList, typename Predicate>
+    static types::size_type _erase_edges_if(
+        impl_type& self,
+        EdgeList& edges,
+        types::size_type edge_position::*position_idx,
+        Predicate pred
+    ) {
+        if constexpr (impl_type::has_edge_position_index)
+            return detail::erase_edges_if(
+                edges,
+                pred,
+                [&self](const auto& edge) { self._edge_positions.erase(&*edge); },
+                _position_updater(self, position_idx)
+            );
+        else
+            return std::erase_if(edges, pred);
+    }
+
+    static void _remove_indexed_edge(impl_type& self, const edge_type& edge) {
+        const auto position_it = self._edge_positions.find(&edge);
+        if (position_it == self._edge_positions.end())
+            throw detail::invalid_edge_error(&edge);
+
+        const auto [first_idx, second_idx] = position_it->second;
+        const auto source_id = edge.first_id();
+        const auto target_id = edge.second_id();
+        self._edge_positions.erase(position_it);
+        self._unindex_neighbor(source_id, edge);
+
+        if constexpr (impl_type::has_in_edge_index)
+            detail::swap_erase(
+                self._in_list[target_id],
+                second_idx,
+                _position_updater(self, &edge_position::second_idx)
+            );
+
+        // the edge is destroyed here, so it cannot be accessed afterwards
+        detail::swap_erase(
+            self._list[source_id], first_idx, _position_updater(self, &edge_position::first_idx)
+        );
         --self._n_unique_edges;
     }
+
+    // --- in-edge index methods ---
+
+    static void _remove_indexed_vertex(impl_type& self, const vertex_type& vertex) {
+        const auto vertex_id = vertex.id();
+        const auto is_incident = [&vertex](const auto& edge) {
+            return edge->is_incident_with(vertex);
+        };
+
+        // the in-edge index limits the scanned lists to the ones of the adjacent vertices
+        std::unordered_set<types::id_type> target_id_set, source_id_set;
+        for (const auto& edge : self._list[vertex_id])
+            target_id_set.insert(edge->second_id());
+        for (const auto* edge : self._in_list[vertex_id])
+            source_id_set.insert(edge->first_id());
+
+        // remove the edges incident from the vertex from the in-edge lists of their targets
+        for (const auto target_id : target_id_set)
+            if (target_id != vertex_id)
+                _erase_edges_if(
+                    self, self._in_list[target_id], &edge_position::second_idx, is_incident
+                );
+
+        // remove the edges incident to the vertex from the lists of their sources
+        for (const auto source_id : source_id_set) {
+            if (source_id == vertex_id)
+                continue;
+            self._n_unique_edges -= _erase_edges_if(
+                self, self._list[source_id], &edge_position::first_idx, is_incident
+            );
+        }
+
+        // remove the lists of the vertex entirely
+        _erase_edge_positions(self, self._list[vertex_id]);
+        self._n_unique_edges -= self._list[vertex_id].size();
+        self._list.erase(std::next(std::begin(self._list), vertex_id));
+        self._in_list.erase(std::next(std::begin(self._in_list), vertex_id));
+    }
 };
 
 template <type_traits::c_instantiation_of<adjacency_list> AdjacencyList>
@@ -198,6 +532,7 @@ struct undirected_adjacency_list {
     using edge_ptr_type = typename impl_type::edge_ptr_type;
     using edge_list_type = typename impl_type::edge_list_type;
     using edge_iterator_type = typename impl_type::edge_iterator_type::iterator_type;
+    using edge_position = typename impl_type::edge_position;
 
     struct address_projection {
         [[nodiscard]] gl_attr_force_inline auto operator()(const edge_type& edge) {
@@ -264,44 +599,132 @@ struct undirected_adjacency_list {
         }
 
         // remove all edges incident with the vertex (scan only the selected vertices)
-        for (const auto& incident_vertex_id : incident_vertex_id_set) {
-            auto& adj_edges = self._list[incident_vertex_id];
-            const auto rem_subrange = std::ranges::remove_if(
-                adj_edges, [&vertex](const auto& edge) { return edge->is_incident_with(vertex); }
-            );
-            adj_edges.erase(rem_subrange.begin(), rem_subrange.end());
-        }
+        for (const auto& incident_vertex_id : incident_vertex_id_set)
+            _erase_edges_if(self, incident_vertex_id, [&vertex](const auto& edge) {
+                return edge->is_incident_with(vertex);
+            });
 
         // remove the list of edges incident from the vertex entirely
+        _erase_edge_positions(self, self._list[vertex_id]);
         self._n_unique_edges -= self._list[vertex_id].size();
         self._list.erase(std::next(std::begin(self._list), vertex_id));
     }
 
+    static void remove_vertices(impl_type& self, const std::vector<bool>& removed) {
+        for (types::id_type id = constants::initial_id; id < self._list.size(); ++id) {
+            if (removed[id]) {
+                // edges connecting two removed vertices are counted only from the lower id side
+                for (const auto& edge : self._list[id]) {
+                    const auto incident_id = edge->incident_vertex_id(id);
+                    if (not removed[incident_id] or id <= incident_id)
+                        --self._n_unique_edges;
+                }
+                _erase_edge_positions(self, self._list[id]);
+                continue;
+            }
+
+            _erase_edges_if(self, id, [id, &removed](const auto& edge) {
+                return removed[edge->incident_vertex_id(id)];
+            });
+        }
+
+        util::compact(self._list, removed);
+    }
+
     static const edge_type& add_edge(impl_type& self, edge_ptr_type edge) {
-        auto& adjacent_edges_first = self._list[edge->first_id()];
+        _index_edge_position(self, edge.get());
+
+        if (not edge->is_loop()) {
+            self._push_edge(edge->second_id(), edge);
+            self._index_neighbor(edge->second_id(), *edge);
+        }
 
-        if (not edge->is_loop())
-            self._list[edge->second_id()].push_back(edge);
-        adjacent_edges_first.push_back(std::move(edge));
+        const auto first_id = edge->first_id();
+        const auto& new_edge = self._push_edge(first_id, std::move(edge));
+        self._index_neighbor(first_id, new_edge);
 
         ++self._n_unique_edges;
-        return *adjacent_edges_first.back();
+        return new_edge;
     }
 
     static void add_edges_from(
         impl_type& self, const types::id_type source_id, std::vector<edge_ptr_type> new_edges
     ) {
         auto& adjacent_edges_source = self._list[source_id];
+        const auto n_sorted = adjacent_edges_source.size();
         adjacent_edges_source.reserve(adjacent_edges_source.size() + new_edges.size());
 
         for (auto& edge : new_edges) {
+            _index_edge_position(self, edge.get());
+            if (not edge->is_loop()) {
+                self._push_edge(edge->second_id(), edge);
+                self._index_neighbor(edge->second_id(), *edge);
+            }
+            adjacent_edges_source.push_back(std::move(edge));
+            self._index_neighbor(source_id, *adjacent_edges_source.back());
+        }
+
+        self._merge_appended_edges(source_id, n_sorted);
+        self._n_unique_edges += new_edges.size();
+    }
+
+    static void add_edges(impl_type& self, std::vector<edge_ptr_type> new_edges) {
+        // count the new edges of each list so that every list is grown only once
+        std::vector<types::size_type> n_new_edges(self._list.size(), constants::zero);
+        for (const auto& edge : new_edges) {
+            ++n_new_edges[edge->first_id()];
             if (not edge->is_loop())
+                ++n_new_edges[edge->second_id()];
+        }
+        self._reserve_adjacent_edges(n_new_edges);
+
+        for (auto& edge : new_edges) {
+            const auto first_id = edge->first_id();
+            _index_edge_position(self, edge.get());
+
+            if (not edge->is_loop()) {
                 self._list[edge->second_id()].push_back(edge);
-            adjacent_edges_source.push_back(std::move(edge));
+                self._index_neighbor(edge->second_id(), *edge);
+            }
+
+            auto& adjacent_edges_first = self._list[first_id];
+            adjacent_edges_first.push_back(std::move(edge));
+            self._index_neighbor(first_id, *adjacent_edges_first.back());
         }
 
+        self._merge_new_adjacent_edges(n_new_edges);
+        self._n_unique_edges += new_edges.size();
+    }
+
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+    // the concurrent two-pass counterpart of `add_edges` (see the directed specialization)
+    template <type_traits::c_execution_policy ExecutionPolicy>
+    static void add_edges(
+        impl_type& self, ExecutionPolicy&& policy, std::vector<edge_ptr_type> new_edges
+    ) {
+        std::vector<types::size_type> n_new_edges(self._list.size(), constants::zero);
+        std::for_each(policy, new_edges.begin(), new_edges.end(), [&](const auto& edge) {
+            (void)detail::fetch_increment(n_new_edges, edge->first_id());
+            if (not edge->is_loop())
+                (void)detail::fetch_increment(n_new_edges, edge->second_id());
+        });
+
+        auto free_slot_idx = impl_type::_grow_edge_lists(self._list, n_new_edges, policy);
+        std::for_each(policy, new_edges.begin(), new_edges.end(), [&](auto& edge) {
+            if (not edge->is_loop()) {
+                const auto second_id = edge->second_id();
+                self._list[second_id][detail::fetch_increment(free_slot_idx, second_id)] = edge;
+            }
+
+            const auto first_id = edge->first_id();
+            self._list[first_id][detail::fetch_increment(free_slot_idx, first_id)] =
+                std::move(edge);
+        });
+
+        self._merge_new_adjacent_edges(n_new_edges, policy);
         self._n_unique_edges += new_edges.size();
     }
+#endif
 
     [[nodiscard]] inline static bool is_edge_incident_to(
         const edge_ptr_type& edge, const types::id_type vertex_id, const types::id_type source_id
@@ -314,25 +737,109 @@ struct undirected_adjacency_list {
     }
 
     static void remove_edge(impl_type& self, const edge_type& edge) {
+        if constexpr (impl_type::has_edge_position_index) {
+            _remove_indexed_edge(self, edge);
+            return;
+        }
+
         if (edge.is_loop()) {
             auto& adj_edges_first = self._list.at(edge.first_id());
-            adj_edges_first.erase(
-                detail::strict_find<impl_type, address_projection>(adj_edges_first, &edge)
-            );
+            const auto it =
+                detail::strict_find<impl_type, address_projection>(adj_edges_first, &edge);
+            self._unindex_neighbor(edge.first_id(), edge);
+            adj_edges_first.erase(it);
         }
         else {
             auto& adj_edges_first = self._list.at(edge.first_id());
             auto& adj_edges_second = self._list.at(edge.second_id());
 
-            adj_edges_first.erase(
-                detail::strict_find<impl_type, address_projection>(adj_edges_first, &edge)
-            );
+            const auto it =
+                detail::strict_find<impl_type, address_projection>(adj_edges_first, &edge);
+            self._unindex_neighbor(edge.first_id(), edge);
+            self._unindex_neighbor(edge.second_id(), edge);
+
+            adj_edges_first.erase(it);
             // if the edge was found in the first list, it will also be present in the second list
             adj_edges_second.erase(std::ranges::find(adj_edges_second, &edge, address_projection{})
             );
         }
         --self._n_unique_edges;
     }
+
+private:
+    // --- edge position index methods ---
+
+    static void _index_edge_position(impl_type& self, const edge_type* edge) {
+        if constexpr (impl_type::has_edge_position_index) {
+            // the edge will be placed at the back of its lists
+            const auto first_idx = self._list[edge->first_id()].size();
+            self._edge_positions.emplace(
+                edge,
+                edge_position{
+                    first_idx, edge->is_loop() ? first_idx : self._list[edge->second_id()].size()
+                }
+            );
+        }
+    }
+
+    gl_attr_force_inline static void _erase_edge_positions(
+        impl_type& self, const edge_list_type& edges
+    ) {
+        if constexpr (impl_type::has_edge_position_index)
+            for (const auto& edge : edges)
+                self._edge_positions.erase(edge.get());
+    }
+
+    [[nodiscard]] gl_attr_force_inline static auto _position_updater(
+        impl_type& self, const types::id_type vertex_id
+    ) {
+        return [&self, vertex_id](const edge_ptr_type& edge, const types::size_type idx) {
+            auto& position = self._edge_positions.at(edge.get());
+            if (edge->first_id() == vertex_id)
+                position.first_idx = idx;
+            if (edge->second_id() == vertex_id)
+                position.second_idx = idx;
+        };
+    }
+
+    template <typename Predicate>
+    static types::size_type _erase_edges_if(
+        impl_type& self, const types::id_type vertex_id, Predicate pred
+    ) {
+        if constexpr (impl_type::has_edge_position_index)
+            return detail::erase_edges_if(
+                self._list[vertex_id],
+                pred,
+                [&self](const edge_ptr_type& edge) { self._edge_positions.erase(edge.get()); },
+                _position_updater(self, vertex_id)
+            );
+        else
+            return std::erase_if(self._list[vertex_id], pred);
+    }
+
+    static void _remove_indexed_edge(impl_type& self, const edge_type& edge) {
+        const auto position_it = self._edge_positions.find(&edge);
+        if (position_it == self._edge_positions.end())
+            throw detail::invalid_edge_error(&edge);
+
+        const auto [first_idx, second_idx] = position_it->second;
+        const auto first_id = edge.first_id();
+        const auto second_id = edge.second_id();
+        self._edge_positions.erase(position_it);
+
+        self._unindex_neighbor(first_id, edge);
+        if (first_id != second_id)
+            self._unindex_neighbor(second_id, edge);
+
+        if (first_id != second_id)
+            detail::swap_erase(
+                self._list[second_id], second_idx, _position_updater(self, second_id)
+            );
+
+        // the edge is destroyed here, so it cannot be accessed afterwards
+        detail::swap_erase(self._list[first_id], first_idx, _position_updater(self, first_id));
+        --self._n_unique_edges;
+    }
 };
 
 template <type_traits::c_instantiation_of<adjacency_list> AdjacencyList>
@@ -354,4 +861,4 @@ struct list_impl_traits<AdjacencyList> {
 
 } // namespace specialized
 
-} // namespace gl::impl
+} // namespace gl::inline gl_id_type_namespace::impl
@@ -4,12 +4,13 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/decl/impl_tags.hpp"
 
 #include <algorithm>
 #include <vector>
 
-namespace gl::impl {
+namespace gl::inline gl_id_type_namespace::impl {
 
 template <type_traits::c_matrix_graph_traits GraphTraits>
 class adjacency_matrix;
@@ -20,15 +21,23 @@ namespace detail {
 
 template <type_traits::c_instantiation_of<adjacency_matrix> AdjacencyMatrix>
 [[nodiscard]] typename AdjacencyMatrix::edge_ptr_type& strict_get(
-    typename AdjacencyMatrix::matrix_type& matrix, const typename AdjacencyMatrix::edge_type* edge
+    AdjacencyMatrix& self, const typename AdjacencyMatrix::edge_type* edge
 ) {
+    const auto first_id = edge->first_id();
+    const auto second_id = edge->second_id();
+
+    if (not (self._is_valid_vertex_id(first_id) and self._is_valid_vertex_id(second_id)))
+        throw std::out_of_range(std::format(
+            "Got invalid edge vertex ids [first = {} | second = {}]", first_id, second_id
+        ));
+
     // get the edge and validate the address
-    auto& matrix_element = matrix.at(edge->first_id()).at(edge->second_id());
+    auto& matrix_element = self._cell(first_id, second_id);
     if (edge != matrix_element.get())
         throw std::invalid_argument(std::format(
             "Got invalid edge [vertices = ({}, {}) | addr = {}]",
-            edge->first_id(),
-            edge->second_id(),
+            first_id,
+            second_id,
             io::format(edge)
         ));
 
@@ -47,6 +56,36 @@ inline void check_edge_override(
         ));
 }
 
+// validates the new edges against the existing edges and against each other
+template <type_traits::c_instantiation_of<adjacency_matrix> AdjacencyMatrix>
+void check_new_edges(
+    const AdjacencyMatrix& adj_matrix,
+    const std::vector<typename AdjacencyMatrix::edge_ptr_type>& new_edges
+) {
+    std::vector<types::homogeneous_pair<types::id_type>> new_cells;
+    new_cells.reserve(new_edges.size());
+
+    for (const auto& edge : new_edges) {
+        check_edge_override(adj_matrix, edge);
+
+        // the cells of undirected edges are normalized so that (u, v) and (v, u) collide
+        const auto [first_id, second_id] = edge->incident_vertex_ids();
+        if constexpr (type_traits::is_undirected_v<typename AdjacencyMatrix::edge_type>)
+            new_cells.emplace_back(std::min(first_id, second_id), std::max(first_id, second_id));
+        else
+            new_cells.emplace_back(first_id, second_id);
+    }
+
+    std::ranges::sort(new_cells);
+    const auto duplicate_it = std::ranges::adjacent_find(new_cells);
+    if (duplicate_it != new_cells.end())
+        throw std::logic_error(std::format(
+            "Cannot override an existing edge without remove: ({}, {})",
+            duplicate_it->first,
+            duplicate_it->second
+        ));
+}
+
 } // namespace detail
 
 template <type_traits::c_instantiation_of<adjacency_matrix> AdjacencyMatrix>
@@ -60,17 +99,17 @@ struct directed_adjacency_matrix {
     [[nodiscard]] gl_attr_force_inline static types::size_type in_degree(
         const impl_type& self, const types::id_type vertex_id
     ) {
-        return std::ranges::count_if(
-            self._matrix,
-            [](const auto& edge) { return edge != nullptr; },
-            [vertex_id](const auto& row) -> const edge_ptr_type& { return row[vertex_id]; }
-        );
+        // a strided walk over the column of the vertex
+        types::size_type in_degree = constants::default_size;
+        for (types::id_type id = constants::initial_id; id < self._n_vertices; ++id)
+            in_degree += static_cast<types::size_type>(self._cell(id, vertex_id) != nullptr);
+        return in_degree;
     }
 
     [[nodiscard]] gl_attr_force_inline static types::size_type out_degree(
         const impl_type& self, const types::id_type vertex_id
     ) {
-        return std::ranges::count_if(self._matrix[vertex_id], [](const auto& edge) {
+        return std::ranges::count_if(self._row(vertex_id), [](const auto& edge) {
             return edge != nullptr;
         });
     }
@@ -82,32 +121,34 @@ struct directed_adjacency_matrix {
     }
 
     [[nodiscard]] static std::vector<types::size_type> in_degree_map(const impl_type& self) {
-        std::vector<types::id_type> in_degree_map(self._matrix.size(), constants::zero);
+        std::vector<types::size_type> in_degree_map(self._n_vertices, constants::zero);
 
-        for (const auto& row : self._matrix)
-            for (types::id_type id = constants::initial_id; id < self._matrix.size(); ++id)
+        for (types::id_type u_id = constants::initial_id; u_id < self._n_vertices; ++u_id) {
+            const auto row = self._row(u_id);
+            for (types::id_type id = constants::initial_id; id < self._n_vertices; ++id)
                 if (row[id] != nullptr)
                     ++in_degree_map[id];
+        }
 
         return in_degree_map;
     }
 
     [[nodiscard]] static std::vector<types::size_type> out_degree_map(const impl_type& self) {
-        std::vector<types::id_type> out_degree_map;
-        out_degree_map.reserve(self._matrix.size());
+        std::vector<types::size_type> out_degree_map;
+        out_degree_map.reserve(self._n_vertices);
 
-        for (types::id_type id = constants::initial_id; id < self._matrix.size(); ++id)
+        for (types::id_type id = constants::initial_id; id < self._n_vertices; ++id)
             out_degree_map.push_back(out_degree(self, id));
 
         return out_degree_map;
     }
 
     [[nodiscard]] static std::vector<types::size_type> degree_map(const impl_type& self) {
-        std::vector<types::id_type> degree_map(self._matrix.size(), constants::zero);
+        std::vector<types::size_type> degree_map(self._n_vertices, constants::zero);
 
-        for (types::id_type u_id = constants::initial_id; u_id < self._matrix.size(); ++u_id) {
-            const auto& row = self._matrix[u_id];
-            for (types::id_type v_id = constants::initial_id; v_id < self._matrix.size(); ++v_id) {
+        for (types::id_type u_id = constants::initial_id; u_id < self._n_vertices; ++u_id) {
+            const auto row = self._row(u_id);
+            for (types::id_type v_id = constants::initial_id; v_id < self._n_vertices; ++v_id) {
                 if (row[v_id] != nullptr) {
                     ++degree_map[u_id];
                     ++degree_map[v_id];
@@ -118,21 +159,24 @@ struct directed_adjacency_matrix {
         return degree_map;
     }
 
-    static void remove_vertex(impl_type& self, const types::id_type vertex_id) {
-        self._n_unique_edges -= self.adjacent_edges(vertex_id).distance();
-        self._matrix.erase(std::next(std::begin(self._matrix), vertex_id));
-
-        for (auto& row : self._matrix) {
-            const auto vertex_it = std::next(std::begin(row), vertex_id);
-            self._n_unique_edges -= static_cast<types::size_type>(*vertex_it != nullptr);
-            row.erase(vertex_it);
+    // returns the number of edges incident with at least one of the marked vertices
+    [[nodiscard]] static types::size_type n_incident_edges(
+        const impl_type& self, const std::vector<bool>& removed
+    ) {
+        types::size_type n_edges = constants::default_size;
+        for (types::id_type u_id = constants::initial_id; u_id < self._n_vertices; ++u_id) {
+            const auto row = self._row(u_id);
+            for (types::id_type v_id = constants::initial_id; v_id < row.size(); ++v_id)
+                if (row[v_id] != nullptr and (removed[u_id] or removed[v_id]))
+                    ++n_edges;
         }
+        return n_edges;
     }
 
     static const edge_type& add_edge(impl_type& self, edge_ptr_type edge) {
         detail::check_edge_override<impl_type>(self, edge);
 
-        auto& matrix_element = self._matrix[edge->first_id()][edge->second_id()];
+        auto& matrix_element = self._cell(edge->first_id(), edge->second_id());
         matrix_element = std::move(edge);
         ++self._n_unique_edges;
 
@@ -142,19 +186,26 @@ struct directed_adjacency_matrix {
     static void add_edges_from(
         impl_type& self, const types::id_type source_id, std::vector<edge_ptr_type> new_edges
     ) {
-        // validate new edges
-        for (auto& edge : new_edges)
-            detail::check_edge_override(self, edge);
+        detail::check_new_edges(self, new_edges);
 
-        auto& matrix_row_source = self._matrix[source_id];
+        const auto matrix_row_source = self._row(source_id);
         for (auto& edge : new_edges)
             matrix_row_source[edge->second_id()] = std::move(edge);
 
         self._n_unique_edges += new_edges.size();
     }
 
+    static void add_edges(impl_type& self, std::vector<edge_ptr_type> new_edges) {
+        detail::check_new_edges(self, new_edges);
+
+        for (auto& edge : new_edges)
+            self._cell(edge->first_id(), edge->second_id()) = std::move(edge);
+
+        self._n_unique_edges += new_edges.size();
+    }
+
     static inline void remove_edge(impl_type& self, const edge_type& edge) {
-        detail::strict_get<impl_type>(self._matrix, &edge) = nullptr;
+        detail::strict_get<impl_type>(self, &edge) = nullptr;
         --self._n_unique_edges;
     }
 };
@@ -183,7 +234,7 @@ struct undirected_adjacency_matrix {
         const impl_type& self, const types::id_type vertex_id
     ) {
         types::size_type degree = constants::default_size;
-        for (const auto& edge : self._matrix[vertex_id])
+        for (const auto& edge : self._row(vertex_id))
             if (edge)
                 degree += constants::one + static_cast<types::size_type>(edge->is_loop());
         return degree;
@@ -202,10 +253,10 @@ struct undirected_adjacency_matrix {
     }
 
     [[nodiscard]] static std::vector<types::size_type> degree_map(const impl_type& self) {
-        std::vector<types::id_type> degree_map(self._matrix.size(), constants::zero);
+        std::vector<types::size_type> degree_map(self._n_vertices, constants::zero);
 
-        for (types::id_type u_id = constants::initial_id; u_id < self._matrix.size(); ++u_id) {
-            const auto& row = self._matrix[u_id];
+        for (types::id_type u_id = constants::initial_id; u_id < self._n_vertices; ++u_id) {
+            const auto row = self._row(u_id);
             for (types::id_type v_id = constants::initial_id; v_id <= u_id; ++v_id) {
                 if (row[v_id] != nullptr) {
                     ++degree_map[u_id];
@@ -217,12 +268,19 @@ struct undirected_adjacency_matrix {
         return degree_map;
     }
 
-    static void remove_vertex(impl_type& self, const types::id_type vertex_id) {
-        self._n_unique_edges -= self.adjacent_edges(vertex_id).distance();
-        self._matrix.erase(std::next(std::begin(self._matrix), vertex_id));
-
-        for (auto& row : self._matrix)
-            row.erase(std::next(std::begin(row), vertex_id));
+    // returns the number of edges incident with at least one of the marked vertices
+    [[nodiscard]] static types::size_type n_incident_edges(
+        const impl_type& self, const std::vector<bool>& removed
+    ) {
+        // each edge is stored in both of its cells, so only the lower triangle is scanned
+        types::size_type n_edges = constants::default_size;
+        for (types::id_type u_id = constants::initial_id; u_id < self._n_vertices; ++u_id) {
+            const auto row = self._row(u_id);
+            for (types::id_type v_id = constants::initial_id; v_id <= u_id; ++v_id)
+                if (row[v_id] != nullptr and (removed[u_id] or removed[v_id]))
+                    ++n_edges;
+        }
+        return n_edges;
     }
 
     static const edge_type& add_edge(impl_type& self, edge_ptr_type edge) {
@@ -232,8 +290,8 @@ struct undirected_adjacency_matrix {
         const auto second_id = edge->second_id();
 
         if (not edge->is_loop())
-            self._matrix[second_id][first_id] = edge;
-        auto& matrix_element = self._matrix.at(first_id).at(second_id);
+            self._cell(second_id, first_id) = edge;
+        auto& matrix_element = self._cell(first_id, second_id);
         matrix_element = edge;
 
         ++self._n_unique_edges;
@@ -243,32 +301,45 @@ struct undirected_adjacency_matrix {
     static void add_edges_from(
         impl_type& self, const types::id_type source_id, std::vector<edge_ptr_type> new_edges
     ) {
-        // validate new edges
-        for (auto& edge : new_edges)
-            detail::check_edge_override(self, edge);
+        detail::check_new_edges(self, new_edges);
 
-        auto& matrix_row_source = self._matrix[source_id];
+        const auto matrix_row_source = self._row(source_id);
         for (auto& edge : new_edges) {
             if (not edge->is_loop())
-                self._matrix[edge->second_id()][source_id] = edge;
+                self._cell(edge->second_id(), source_id) = edge;
             matrix_row_source[edge->second_id()] = std::move(edge);
         }
 
         self._n_unique_edges += new_edges.size();
     }
 
+    static void add_edges(impl_type& self, std::vector<edge_ptr_type> new_edges) {
+        detail::check_new_edges(self, new_edges);
+
+        for (auto& edge : new_edges) {
+            const auto first_id = edge->first_id();
+            const auto second_id = edge->second_id();
+
+            if (not edge->is_loop())
+                self._cell(second_id, first_id) = edge;
+            self._cell(first_id, second_id) = std::move(edge);
+        }
+
+        self._n_unique_edges += new_edges.size();
+    }
+
     static void remove_edge(impl_type& self, const edge_type& edge) {
         if (edge.is_loop()) {
-            detail::strict_get<impl_type>(self._matrix, &edge) = nullptr;
+            detail::strict_get<impl_type>(self, &edge) = nullptr;
         }
         else {
             const auto first_id = edge.first_id();
             const auto second_id = edge.second_id();
 
-            detail::strict_get<impl_type>(self._matrix, &edge) = nullptr;
+            detail::strict_get<impl_type>(self, &edge) = nullptr;
             // if the edge was found in the first matrix cell,
             // it will also be present in the second matrix cell
-            self._matrix[second_id][first_id] = nullptr;
+            self._cell(second_id, first_id) = nullptr;
         }
         --self._n_unique_edges;
     }
@@ -293,4 +364,4 @@ struct matrix_impl_traits<AdjacencyMatrix> {
 
 } // namespace specialized
 
-} // namespace gl::impl
+} // namespace gl::inline gl_id_type_namespace::impl
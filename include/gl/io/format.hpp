@@ -5,9 +5,10 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/types/traits/concepts.hpp"
 
-namespace gl::io {
+namespace gl::inline gl_id_type_namespace::io {
 
 /*
 Custom format functions (casts to types compatible with std::formatter)
@@ -37,4 +38,4 @@ template <type_traits::c_strong_smart_ptr PtrType>
     return formatter(ptr.get());
 }
 
-} // namespace gl::io
+} // namespace gl::inline gl_id_type_namespace::io
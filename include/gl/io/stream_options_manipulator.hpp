@@ -5,11 +5,12 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/util/enum.hpp"
 
 #include <iostream>
 
-namespace gl::io {
+namespace gl::inline gl_id_type_namespace::io {
 
 using index_type = int;
 using iword_type = long;
@@ -213,4 +214,4 @@ template <detail::c_bit_position_enum BitPosition>
     );
 }
 
-} // namespace gl::io
+} // namespace gl::inline gl_id_type_namespace::io
@@ -0,0 +1,178 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "graph_utility.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace {
+
+/*
+A non-owning view of a directed graph with all edges reversed.
+
+The adjacent edges of a vertex in the view are the incoming edges of the vertex in the
+    underlying graph (the edge objects are not modified - the edge `(u, v)` of the graph is
+    reported as an edge adjacent to `v`, which leads to `u`).
+Creating the view is O(1). If the graph has the `impl::in_edge_index_t` list option,
+    the in-edge index of the graph is used directly. Otherwise the transposed index of the
+    graph is built in O(V + E) on the first call to `adjacent_edges` and cached in the view
+    (the index is built exactly once, even if the view is used by multiple threads).
+The transposed index stores the addresses of the graph's edges, unless the adjacent edge ranges
+    of the graph yield temporary edges (e.g. for the compressed graphs), in which case
+    the index stores the (moved) temporary edges.
+
+The view satisfies the `type_traits::c_graph_view` concept, so it can be passed to all
+    algorithms applicable to directed graphs. The view must outlive all ranges returned by it
+    and the underlying graph must not be modified while the view is used.
+*/
+
+template <type_traits::c_directed_graph GraphType>
+class reverse_view final {
+public:
+    using graph_type = GraphType;
+    using traits_type = typename graph_type::traits_type;
+
+    using vertex_type = typename graph_type::vertex_type;
+    using vertex_properties_type = typename graph_type::vertex_properties_type;
+
+    using edge_type = typename graph_type::edge_type;
+    using edge_directional_tag = typename graph_type::edge_directional_tag;
+    using edge_properties_type = typename graph_type::edge_properties_type;
+
+    // whether the in-edge index of the graph is used instead of the cached transposed index
+    static constexpr bool uses_in_edge_index =
+        requires(const graph_type& graph) { graph.in_edges(types::id_type{}); };
+
+    explicit reverse_view(const graph_type& graph) : _graph(&graph) {}
+
+    reverse_view(const reverse_view&) = delete;
+    reverse_view& operator=(const reverse_view&) = delete;
+
+    reverse_view(reverse_view&&) = delete;
+    reverse_view& operator=(reverse_view&&) = delete;
+
+    ~reverse_view() = default;
+
+    [[nodiscard]] gl_attr_force_inline const graph_type& graph() const {
+        return *this->_graph;
+    }
+
+    // --- general methods ---
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_vertices() const {
+        return this->_graph->n_vertices();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_removed_vertices() const {
+        return this->_graph->n_removed_vertices();
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type n_unique_edges() const {
+        return this->_graph->n_unique_edges();
+    }
+
+    // --- vertex methods ---
+
+    [[nodiscard]] gl_attr_force_inline auto vertices() const {
+        return this->_graph->vertices();
+    }
+
+    [[nodiscard]] gl_attr_force_inline auto vertex_ids() const {
+        return this->_graph->vertex_ids();
+    }
+
+    [[nodiscard]] gl_attr_force_inline const vertex_type& get_vertex(const types::id_type vertex_id
+    ) const {
+        return this->_graph->get_vertex(vertex_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool has_vertex(const types::id_type vertex_id) const {
+        return this->_graph->has_vertex(vertex_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool has_vertex(const vertex_type& vertex) const {
+        return this->_graph->has_vertex(vertex);
+    }
+
+    // --- edge methods ---
+
+    // checks whether the reversed edge `(first_id, second_id)` exists in the view
+    [[nodiscard]] gl_attr_force_inline bool has_edge(
+        const types::id_type first_id, const types::id_type second_id
+    ) const {
+        return this->_graph->has_edge(second_id, first_id);
+    }
+
+    [[nodiscard]] gl_attr_force_inline bool has_edge(const edge_type& edge) const {
+        return this->_graph->has_edge(edge);
+    }
+
+    // returns the incoming edges of the vertex in the underlying graph
+    [[nodiscard]] auto adjacent_edges(const types::id_type vertex_id) const {
+        if constexpr (uses_in_edge_index) {
+            return this->_graph->in_edges(vertex_id);
+        }
+        else {
+            const auto& in_edges = this->_transposed_index()[this->get_vertex(vertex_id).id()];
+            if constexpr (stores_edge_addresses)
+                return make_iterator_range(deref_cbegin(in_edges), deref_cend(in_edges));
+            else
+                return make_const_iterator_range(in_edges);
+        }
+    }
+
+    [[nodiscard]] gl_attr_force_inline auto adjacent_edges(const vertex_type& vertex) const {
+        return this->adjacent_edges(vertex.id());
+    }
+
+    // --- incidence methods ---
+
+    [[nodiscard]] gl_attr_force_inline std::vector<types::size_type> in_degree_map() const {
+        return this->_graph->out_degree_map();
+    }
+
+    [[nodiscard]] gl_attr_force_inline std::vector<types::size_type> out_degree_map() const {
+        return this->_graph->in_degree_map();
+    }
+
+private:
+    static constexpr bool stores_edge_addresses =
+        type_traits::c_stable_edge_graph_view<graph_type>;
+
+    using in_edge_list_type = std::conditional_t<
+        stores_edge_addresses,
+        std::vector<const edge_type*>,
+        std::vector<edge_type>>;
+
+    [[nodiscard]] const std::vector<in_edge_list_type>& _transposed_index() const {
+        std::call_once(this->_transposed_index_flag, [this] {
+            const auto in_degree_map = this->_graph->in_degree_map();
+
+            this->_in_edges.resize(this->_graph->n_vertices());
+            for (const auto vertex_id : this->_graph->vertex_ids())
+                this->_in_edges[vertex_id].reserve(in_degree_map[vertex_id]);
+
+            for (const auto vertex_id : this->_graph->vertex_ids())
+                for (auto&& edge : this->_graph->adjacent_edges(vertex_id)) {
+                    if constexpr (stores_edge_addresses)
+                        this->_in_edges[edge.second_id()].push_back(&edge);
+                    else
+                        this->_in_edges[edge.second_id()].push_back(std::move(edge));
+                }
+        });
+
+        return this->_in_edges;
+    }
+
+    const graph_type* _graph;
+
+    mutable std::once_flag _transposed_index_flag;
+    mutable std::vector<in_edge_list_type> _in_edges;
+};
+
+} // namespace gl::inline gl_id_type_namespace
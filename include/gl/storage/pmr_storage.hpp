@@ -0,0 +1,101 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace gl::inline gl_id_type_namespace::storage {
+
+/*
+A deleter releasing an object allocated from a memory resource.
+The deleter stores the resource, so the objects can be released independently of the
+    storage which created them (the resource itself must outlive the objects).
+*/
+
+template <typename T>
+class pmr_deleter {
+public:
+    pmr_deleter() = default;
+
+    explicit pmr_deleter(std::pmr::memory_resource* resource) : _resource(resource) {}
+
+    void operator()(T* ptr) const {
+        std::pmr::polymorphic_allocator<T> allocator{this->_resource};
+        std::allocator_traits<std::pmr::polymorphic_allocator<T>>::destroy(allocator, ptr);
+        allocator.deallocate(ptr, constants::one);
+    }
+
+    [[nodiscard]] gl_attr_force_inline std::pmr::memory_resource* resource() const {
+        return this->_resource;
+    }
+
+private:
+    std::pmr::memory_resource* _resource = nullptr;
+};
+
+template <typename T>
+using pmr_unique_ptr = std::unique_ptr<T, pmr_deleter<T>>;
+
+/*
+An element storage allocating the objects from a `std::pmr::memory_resource`.
+The exclusively owned objects (vertices and directed edges) are referenced with `pmr_unique_ptr`,
+    while the shared objects (undirected edges) are created with `std::allocate_shared`,
+    so their control blocks are also allocated from the resource.
+*/
+
+template <typename T, typename PtrType>
+class pmr_storage {
+public:
+    using value_type = T;
+    using ptr_type = PtrType;
+    using allocator_type = std::pmr::polymorphic_allocator<T>;
+
+    pmr_storage() = default;
+
+    explicit pmr_storage(std::pmr::memory_resource* resource) : _resource(resource) {}
+
+    template <typename... Args>
+    [[nodiscard]] ptr_type make(Args&&... args) const {
+        allocator_type allocator{this->_resource};
+
+        if constexpr (std::same_as<ptr_type, std::shared_ptr<T>>) {
+            return std::allocate_shared<T>(allocator, std::forward<Args>(args)...);
+        }
+        else {
+            T* ptr = allocator.allocate(constants::one);
+            try {
+                std::allocator_traits<allocator_type>::construct(
+                    allocator, ptr, std::forward<Args>(args)...
+                );
+            }
+            catch (...) {
+                allocator.deallocate(ptr, constants::one);
+                throw;
+            }
+            return ptr_type{ptr, pmr_deleter<T>{this->_resource}};
+        }
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type) const {}
+
+    [[nodiscard]] gl_attr_force_inline std::pmr::memory_resource* resource() const {
+        return this->_resource;
+    }
+
+private:
+    // the default resource is captured when the storage is created
+    std::pmr::memory_resource* _resource = std::pmr::get_default_resource();
+};
+
+} // namespace gl::inline gl_id_type_namespace::storage
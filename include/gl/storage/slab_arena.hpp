@@ -0,0 +1,292 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::storage {
+
+template <typename T>
+class slab_arena;
+
+template <typename T>
+class arena_ptr;
+
+namespace detail {
+
+template <typename T>
+class arena_state;
+
+template <typename T>
+struct arena_slot {
+    [[nodiscard]] gl_attr_force_inline T* object() {
+        return std::launder(reinterpret_cast<T*>(this->storage));
+    }
+
+    alignas(T) std::byte storage[sizeof(T)];
+
+    union {
+        arena_state<T>* owner; // valid while the slot holds an object
+        arena_slot* next_free; // valid while the slot is on the free list
+    };
+
+    types::size_type ref_count;
+};
+
+/*
+The actual memory pool of a slab arena.
+The state is always heap allocated so that its address (stored in every occupied slot)
+    remains valid when the owning arena is moved.
+*/
+
+template <typename T>
+class arena_state {
+public:
+    using slot_type = arena_slot<T>;
+
+    arena_state() = default;
+
+    arena_state(const arena_state&) = delete;
+    arena_state& operator=(const arena_state&) = delete;
+
+    arena_state(arena_state&&) = delete;
+    arena_state& operator=(arena_state&&) = delete;
+
+    ~arena_state() = default;
+
+    [[nodiscard]] slot_type* allocate() {
+        if (this->_free_list == nullptr)
+            this->_add_slab(this->_next_slab_size());
+
+        slot_type* slot = this->_free_list;
+        this->_free_list = slot->next_free;
+        --this->_n_free;
+        return slot;
+    }
+
+    gl_attr_force_inline void deallocate(slot_type* slot) {
+        slot->next_free = this->_free_list;
+        this->_free_list = slot;
+        ++this->_n_free;
+    }
+
+    void reserve(const types::size_type n) {
+        if (n <= this->_n_free)
+            return;
+
+        this->_add_slab(std::max(n - this->_n_free, this->_next_slab_size()));
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type size() const {
+        return this->_capacity - this->_n_free;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_capacity;
+    }
+
+private:
+    [[nodiscard]] gl_attr_force_inline types::size_type _next_slab_size() const {
+        return std::clamp(this->_capacity, _min_slab_size, _max_slab_size);
+    }
+
+    void _add_slab(const types::size_type slab_size) {
+        auto& slab = this->_slabs.emplace_back(new slot_type[slab_size]);
+
+        // link the new slots in reverse so that they are allocated in the address order
+        for (auto i = slab_size; i > constants::zero; --i)
+            this->deallocate(&slab[i - constants::one]);
+
+        this->_capacity += slab_size;
+    }
+
+    static constexpr types::size_type _min_slab_size = 64ull;
+    static constexpr types::size_type _max_slab_size = 65536ull;
+
+    std::vector<std::unique_ptr<slot_type[]>> _slabs{};
+    slot_type* _free_list = nullptr;
+    types::size_type _n_free = constants::zero;
+    types::size_type _capacity = constants::zero;
+};
+
+} // namespace detail
+
+/*
+A non-atomic reference counting handle to an object allocated in a slab arena.
+Copying the handle does not allocate - it only increments the reference counter
+    stored next to the object in its arena slot.
+When the last handle is released the object is destroyed and its slot is returned
+    to the arena's free list.
+*/
+
+template <typename T>
+class arena_ptr {
+public:
+    using element_type = T;
+
+    arena_ptr() = default;
+
+    arena_ptr(std::nullptr_t) {}
+
+    arena_ptr(const arena_ptr& other) : _slot(other._slot) {
+        if (this->_slot)
+            ++this->_slot->ref_count;
+    }
+
+    arena_ptr(arena_ptr&& other) noexcept : _slot(std::exchange(other._slot, nullptr)) {}
+
+    arena_ptr& operator=(const arena_ptr& other) {
+        arena_ptr(other).swap(*this);
+        return *this;
+    }
+
+    arena_ptr& operator=(arena_ptr&& other) noexcept {
+        arena_ptr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    arena_ptr& operator=(std::nullptr_t) {
+        this->_release();
+        return *this;
+    }
+
+    gl_attr_force_inline void swap(arena_ptr& other) noexcept {
+        std::swap(this->_slot, other._slot);
+    }
+
+    ~arena_ptr() {
+        this->_release();
+    }
+
+    [[nodiscard]] gl_attr_force_inline T* get() const {
+        return this->_slot ? this->_slot->object() : nullptr;
+    }
+
+    [[nodiscard]] gl_attr_force_inline T& operator*() const {
+        return *this->_slot->object();
+    }
+
+    [[nodiscard]] gl_attr_force_inline T* operator->() const {
+        return this->_slot->object();
+    }
+
+    [[nodiscard]] gl_attr_force_inline explicit operator bool() const {
+        return this->_slot != nullptr;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type use_count() const {
+        return this->_slot ? this->_slot->ref_count : constants::zero;
+    }
+
+    [[nodiscard]] friend bool operator==(const arena_ptr&, const arena_ptr&) = default;
+
+    [[nodiscard]] friend gl_attr_force_inline bool operator==(
+        const arena_ptr& ptr, std::nullptr_t
+    ) {
+        return ptr._slot == nullptr;
+    }
+
+private:
+    using slot_type = detail::arena_slot<T>;
+
+    friend class slab_arena<T>;
+
+    explicit arena_ptr(slot_type* slot) : _slot(slot) {}
+
+    void _release() {
+        auto* slot = std::exchange(this->_slot, nullptr);
+        if (slot == nullptr or --slot->ref_count > constants::zero)
+            return;
+
+        auto* owner = slot->owner;
+        std::destroy_at(slot->object());
+        owner->deallocate(slot);
+    }
+
+    slot_type* _slot = nullptr;
+};
+
+/*
+A slab arena allocating objects of type T in geometrically growing slabs of slots.
+The addresses of the allocated objects are stable until the objects are released.
+The arena must outlive all handles to the objects allocated in it.
+*/
+
+template <typename T>
+class slab_arena {
+public:
+    using value_type = T;
+    using ptr_type = arena_ptr<T>;
+
+    slab_arena() = default;
+
+    slab_arena(const slab_arena&) = delete;
+    slab_arena& operator=(const slab_arena&) = delete;
+
+    slab_arena(slab_arena&&) noexcept = default;
+
+    slab_arena& operator=(slab_arena&& other) noexcept {
+        // the current state is handed over to `other` instead of being released, because
+        // the objects allocated in it may still be referenced when the arena is assigned to
+        std::swap(this->_state, other._state);
+        return *this;
+    }
+
+    ~slab_arena() = default;
+
+    template <typename... Args>
+    [[nodiscard]] ptr_type make(Args&&... args) {
+        auto& state = this->_get_state();
+        auto* slot = state.allocate();
+
+        try {
+            std::construct_at(reinterpret_cast<T*>(slot->storage), std::forward<Args>(args)...);
+        }
+        catch (...) {
+            state.deallocate(slot);
+            throw;
+        }
+
+        slot->owner = &state;
+        slot->ref_count = constants::one;
+        return ptr_type{slot};
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type n) {
+        this->_get_state().reserve(n);
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type size() const {
+        return this->_state ? this->_state->size() : constants::zero;
+    }
+
+    [[nodiscard]] gl_attr_force_inline types::size_type capacity() const {
+        return this->_state ? this->_state->capacity() : constants::zero;
+    }
+
+private:
+    using state_type = detail::arena_state<T>;
+
+    [[nodiscard]] gl_attr_force_inline state_type& _get_state() {
+        // the state is created lazily so that moved-from arenas remain usable
+        if (not this->_state)
+            this->_state = std::make_unique<state_type>();
+        return *this->_state;
+    }
+
+    std::unique_ptr<state_type> _state{};
+};
+
+} // namespace gl::inline gl_id_type_namespace::storage
@@ -0,0 +1,118 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/decl/storage_tags.hpp"
+#include "gl/edge_tags.hpp"
+#include "gl/vertex_descriptor.hpp"
+#include "pmr_storage.hpp"
+#include "slab_arena.hpp"
+
+namespace gl::inline gl_id_type_namespace::storage {
+
+/*
+The default vertex storage: each vertex is allocated separately using `std::unique_ptr`.
+*/
+
+template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+struct heap_vertex_storage {
+    using value_type = VertexType;
+    using ptr_type = types::vertex_ptr_type<VertexType>;
+
+    template <typename... Args>
+    [[nodiscard]] gl_attr_force_inline ptr_type make(Args&&... args) const {
+        return gl::detail::make_vertex<VertexType>(std::forward<Args>(args)...);
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type) const {}
+};
+
+/*
+The default edge storage: each edge is allocated separately using the smart pointer type
+    specified by its directional tag (`std::unique_ptr` or `std::shared_ptr`).
+*/
+
+template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+struct heap_edge_storage {
+    using value_type = EdgeType;
+    using ptr_type = types::edge_ptr_type<EdgeType>;
+
+    template <typename... Args>
+    [[nodiscard]] gl_attr_force_inline ptr_type make(Args&&... args) const {
+        return gl::detail::make_edge<EdgeType>(std::forward<Args>(args)...);
+    }
+
+    gl_attr_force_inline void reserve(const types::size_type) const {}
+};
+
+struct heap_t {
+    template <typename T>
+    using allocator_type = std::allocator<T>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_ptr_type = types::vertex_ptr_type<VertexType>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_storage_type = heap_vertex_storage<VertexType>;
+
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_ptr_type = types::edge_ptr_type<EdgeType>;
+
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_storage_type = heap_edge_storage<EdgeType>;
+};
+
+/*
+Both the vertices and the edges of the graph are allocated in per-graph slab arenas.
+The vertices are therefore stored in (mostly) contiguous, address-stable blocks
+    instead of separate heap locations.
+*/
+
+struct arena_t {
+    template <typename T>
+    using allocator_type = std::allocator<T>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_ptr_type = arena_ptr<VertexType>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_storage_type = slab_arena<VertexType>;
+
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_ptr_type = arena_ptr<EdgeType>;
+
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_storage_type = slab_arena<EdgeType>;
+};
+
+/*
+Both the vertices and the edges of the graph, as well as the graph's vertex list and the containers
+    of its implementation, are allocated from a `std::pmr::memory_resource` passed to the graph's
+    constructor (`std::pmr::get_default_resource()` by default).
+*/
+
+struct pmr_t {
+    template <typename T>
+    using allocator_type = std::pmr::polymorphic_allocator<T>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_ptr_type = pmr_unique_ptr<VertexType>;
+
+    template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
+    using vertex_storage_type = pmr_storage<VertexType, vertex_ptr_type<VertexType>>;
+
+    // undirected edges are shared by the adjacency lists of both of their vertices
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_ptr_type = std::conditional_t<
+        type_traits::is_undirected_v<EdgeType>,
+        std::shared_ptr<EdgeType>,
+        pmr_unique_ptr<EdgeType>>;
+
+    template <type_traits::c_instantiation_of<edge_descriptor> EdgeType>
+    using edge_storage_type = pmr_storage<EdgeType, edge_ptr_type<EdgeType>>;
+};
+
+} // namespace gl::inline gl_id_type_namespace::storage
@@ -4,18 +4,22 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/graph_utility.hpp"
 #include "gl/util/pow.hpp"
 
-namespace gl::topology {
+namespace gl::inline gl_id_type_namespace::topology {
 
 namespace detail {
 
-[[nodiscard]] gl_attr_force_inline auto get_binary_target_ids(const types::size_type source_id) {
-    return std::make_pair(
-        constants::two * source_id + constants::one, constants::two * source_id + constants::two
-    );
+[[nodiscard]] gl_attr_force_inline types::homogeneous_pair<types::id_type> get_binary_target_ids(
+    const types::id_type source_id
+) {
+    return {
+        static_cast<types::id_type>(constants::two * source_id + constants::one),
+        static_cast<types::id_type>(constants::two * source_id + constants::two)
+    };
 }
 
 constexpr types::size_type min_non_trivial_bin_tree_depth = constants::two;
@@ -78,4 +82,4 @@ template <type_traits::c_graph GraphType>
     }
 }
 
-} // namespace gl::topology
+} // namespace gl::inline gl_id_type_namespace::topology
@@ -4,10 +4,11 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/graph.hpp"
 
-namespace gl::topology {
+namespace gl::inline gl_id_type_namespace::topology {
 
 template <type_traits::c_graph GraphType>
 [[nodiscard]] GraphType biclique(
@@ -17,7 +18,8 @@ template <type_traits::c_graph GraphType>
     GraphType graph{n_vertices};
 
     for (types::id_type source_id = constants::initial_id; source_id < n_vertices_a; ++source_id) {
-        for (types::id_type target_id = n_vertices_a; target_id < n_vertices; ++target_id) {
+        for (auto target_id = static_cast<types::id_type>(n_vertices_a); target_id < n_vertices;
+             ++target_id) {
             graph.add_edge(source_id, target_id);
             if constexpr (type_traits::is_directed_v<GraphType>)
                 graph.add_edge(target_id, source_id);
@@ -27,4 +29,4 @@ template <type_traits::c_graph GraphType>
     return graph;
 }
 
-} // namespace gl::topology
+} // namespace gl::inline gl_id_type_namespace::topology
@@ -4,10 +4,11 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/graph.hpp"
 
-namespace gl::topology {
+namespace gl::inline gl_id_type_namespace::topology {
 
 template <type_traits::c_graph GraphType>
 [[nodiscard]] GraphType clique(const types::size_type n_vertices) {
@@ -24,4 +25,4 @@ template <type_traits::c_graph GraphType>
     return graph;
 }
 
-} // namespace gl::topology
+} // namespace gl::inline gl_id_type_namespace::topology
@@ -4,17 +4,20 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/graph.hpp"
 
-namespace gl::topology {
+namespace gl::inline gl_id_type_namespace::topology {
 
 template <type_traits::c_graph GraphType>
 [[nodiscard]] GraphType cycle(const types::size_type n_vertices) {
     GraphType graph{n_vertices};
 
     for (types::id_type source_id = constants::initial_id; source_id < n_vertices; ++source_id)
-        graph.add_edge(source_id, (source_id + constants::one) % n_vertices);
+        graph.add_edge(
+            source_id, static_cast<types::id_type>((source_id + constants::one) % n_vertices)
+        );
 
     return graph;
 }
@@ -26,7 +29,8 @@ template <type_traits::c_graph GraphType>
 
         for (types::id_type source_id = constants::initial_id; source_id < n_vertices;
              ++source_id) {
-            const auto target_id = (source_id + constants::one) % n_vertices;
+            const auto target_id =
+                static_cast<types::id_type>((source_id + constants::one) % n_vertices);
             graph.add_edge(source_id, target_id);
             graph.add_edge(target_id, source_id);
         }
@@ -38,4 +42,4 @@ template <type_traits::c_graph GraphType>
     }
 }
 
-} // namespace gl::topology
+} // namespace gl::inline gl_id_type_namespace::topology
@@ -4,10 +4,11 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/graph.hpp"
 
-namespace gl::topology {
+namespace gl::inline gl_id_type_namespace::topology {
 
 template <type_traits::c_graph GraphType>
 [[nodiscard]] GraphType path(const types::size_type n_vertices) {
@@ -15,7 +16,7 @@ template <type_traits::c_graph GraphType>
 
     for (types::id_type source_id = constants::initial_id; source_id < n_vertices - constants::one;
          ++source_id)
-        graph.add_edge(source_id, source_id + constants::one);
+        graph.add_edge(source_id, static_cast<types::id_type>(source_id + constants::one));
 
     return graph;
 }
@@ -28,7 +29,7 @@ template <type_traits::c_graph GraphType>
         for (types::id_type source_id = constants::initial_id;
              source_id < n_vertices - constants::one;
              ++source_id) {
-            const auto target_id = source_id + constants::one;
+            const auto target_id = static_cast<types::id_type>(source_id + constants::one);
             graph.add_edge(source_id, target_id);
             graph.add_edge(target_id, source_id);
         }
@@ -40,4 +41,4 @@ template <type_traits::c_graph GraphType>
     }
 }
 
-} // namespace gl::topology
+} // namespace gl::inline gl_id_type_namespace::topology
@@ -0,0 +1,146 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/decl/graph_traits.hpp"
+#include "properties.hpp"
+#include "types.hpp"
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace {
+
+template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+class graph;
+
+namespace types {
+
+/*
+A marker which can be used as the vertex properties type of the graph traits to make
+    the graph store the vertex properties column-wise: the properties of all vertices are stored
+    in a single vector owned by the graph (indexed by the vertex ids) instead of inside
+    the vertices.
+The `properties` member of such vertices is a `column_property_ref` to the vertex's element
+    of the column.
+*/
+template <type_traits::c_properties Properties>
+requires(not type_traits::is_default_properties_type_v<Properties>)
+struct columnar {
+    using properties_type = Properties;
+};
+
+/*
+The column is a pmr vector, so that the column references do not depend on the storage
+    of the graph: the graphs with the pmr storage allocate the column from their memory resource,
+    while the other graphs use the global allocator (`std::pmr::new_delete_resource()`).
+*/
+template <type_traits::c_properties Properties>
+using property_column = std::pmr::vector<Properties>;
+
+/*
+A reference to an element of a property column owned by a graph.
+Copying the reference binds the copy to the same element, while assigning to the reference
+    (either a value or another reference) assigns the referenced property value.
+The referenced value can be accessed with `get()`, `*` or `->`.
+*/
+template <type_traits::c_properties Properties>
+class column_property_ref final {
+public:
+    using value_type = Properties;
+    using column_type = property_column<value_type>;
+
+    template <type_traits::c_instantiation_of<graph_traits> GraphTraits>
+    friend class gl::graph;
+
+    column_property_ref() = default;
+
+    column_property_ref(const column_property_ref&) = default;
+    column_property_ref(column_property_ref&&) = default;
+
+    column_property_ref& operator=(const column_property_ref& other) {
+        this->get() = other.get();
+        return *this;
+    }
+
+    column_property_ref& operator=(column_property_ref&& other) {
+        this->get() = other.get();
+        return *this;
+    }
+
+    column_property_ref& operator=(const value_type& value) {
+        this->get() = value;
+        return *this;
+    }
+
+    ~column_property_ref() = default;
+
+    [[nodiscard]] gl_attr_force_inline value_type& get() const {
+        return (*this->_column)[this->_index];
+    }
+
+    [[nodiscard]] gl_attr_force_inline value_type& operator*() const {
+        return this->get();
+    }
+
+    [[nodiscard]] gl_attr_force_inline value_type* operator->() const {
+        return &this->get();
+    }
+
+    gl_attr_force_inline operator value_type&() const {
+        return this->get();
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const column_property_ref& property)
+    requires(type_traits::c_writable<value_type>)
+    {
+        os << property.get();
+        return os;
+    }
+
+    friend std::istream& operator>>(std::istream& is, const column_property_ref& property)
+    requires(type_traits::c_readable<value_type&>)
+    {
+        is >> property.get();
+        return is;
+    }
+
+private:
+    column_property_ref(column_type& column, const types::size_type index)
+    : _column(&column), _index(index) {}
+
+    column_type* _column = nullptr;
+    types::size_type _index = 0ull;
+};
+
+// --- vertex properties storage ---
+
+template <type_traits::c_properties Properties>
+struct properties_storage {
+    using value_type = Properties;
+    using member_type = Properties;
+};
+
+template <type_traits::c_properties Properties>
+struct properties_storage<columnar<Properties>> {
+    using value_type = Properties;
+    using member_type = column_property_ref<Properties>;
+};
+
+} // namespace types
+
+namespace type_traits {
+
+template <typename T>
+concept c_columnar_properties = c_instantiation_of<T, types::columnar>;
+
+template <typename T>
+concept c_column_property_ref = c_instantiation_of<T, types::column_property_ref>;
+
+} // namespace type_traits
+
+} // namespace gl::inline gl_id_type_namespace
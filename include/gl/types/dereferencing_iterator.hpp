@@ -5,11 +5,12 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "type_traits.hpp"
 
 #include <algorithm>
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace types {
 
@@ -118,4 +119,4 @@ template <type_traits::c_const_range Range>
     return types::dereferencing_iterator(std::ranges::cend(range));
 }
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "type_traits.hpp"
 #include "types.hpp"
 
@@ -27,7 +28,7 @@
 #undef _GL_IT_RANGE_NOT_FINAL
 #endif
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace types {
 
@@ -44,6 +45,8 @@ class iterator_range
     final
 #endif
 {
+    static constexpr bool _yields_references = std::is_reference_v<std::iter_reference_t<Iterator>>;
+
 public:
     using iterator = Iterator;
 #if __cplusplus >= 202302L
@@ -129,19 +132,29 @@ public:
     }
 
     [[nodiscard]] inline value_type& element_at(types::size_type position)
-    requires(not type_traits::c_const_iterator<iterator>)
+    requires(not type_traits::c_const_iterator<iterator> and _yields_references)
+    {
+        this->_validate_element_position(position);
+        return *std::ranges::next(this->begin(), position);
+    }
+
+    [[nodiscard]] inline const value_type& element_at(types::size_type position) const
+    requires(_yields_references)
     {
         this->_validate_element_position(position);
         return *std::ranges::next(this->begin(), position);
     }
 
-    [[nodiscard]] inline const value_type& element_at(types::size_type position) const {
+    // the iterators yielding temporary elements (e.g. materialized edges) are accessed by value
+    [[nodiscard]] inline value_type element_at(types::size_type position) const
+    requires(not _yields_references)
+    {
         this->_validate_element_position(position);
         return *std::ranges::next(this->begin(), position);
     }
 
     [[nodiscard]] gl_attr_force_inline value_type& operator[](types::size_type position)
-    requires(not type_traits::c_const_iterator<iterator>)
+    requires(not type_traits::c_const_iterator<iterator> and _yields_references)
     {
         return this->element_at(position);
     }
@@ -149,7 +162,15 @@ public:
     // clang-format off
     // gl_attr_force_inline misplacement
 
-    [[nodiscard]] gl_attr_force_inline const value_type& operator[](types::size_type position) const {
+    [[nodiscard]] gl_attr_force_inline const value_type& operator[](types::size_type position) const
+    requires(_yields_references)
+    {
+        return this->element_at(position);
+    }
+
+    [[nodiscard]] gl_attr_force_inline value_type operator[](types::size_type position) const
+    requires(not _yields_references)
+    {
         return this->element_at(position);
     }
 
@@ -212,4 +233,4 @@ make_const_iterator_range(const Range& range) {
     };
 }
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
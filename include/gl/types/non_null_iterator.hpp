@@ -5,11 +5,12 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "type_traits.hpp"
 
 #include <algorithm>
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace types {
 
@@ -207,4 +208,4 @@ requires(std::bidirectional_iterator<decltype(std::ranges::cend(range))>)
     );
 }
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/util/enum.hpp"
 #include "traits/concepts.hpp"
 
@@ -19,7 +20,7 @@
 #undef _GL_PROPERTY_TYPES_NOT_FINAL
 #endif
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace types {
 
@@ -257,4 +258,4 @@ concept c_weight_properties_type = c_properties<Properties> and requires(Propert
 
 } // namespace type_traits
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
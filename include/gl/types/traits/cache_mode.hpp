@@ -5,8 +5,9 @@
 #pragma once
 
 #include "concepts.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
-namespace gl::type_traits {
+namespace gl::inline gl_id_type_namespace::type_traits {
 
 enum class cache_mode_value { none, lazy, eager };
 
@@ -22,4 +23,4 @@ using eager_cache = cache_mode<cache_mode_value::eager>;
 template <typename T>
 concept c_cache_mode = c_one_of<T, no_cache, lazy_cache, eager_cache>;
 
-} // namespace gl::type_traits
+} // namespace gl::inline gl_id_type_namespace::type_traits
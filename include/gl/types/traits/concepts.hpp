@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/types/types.hpp"
 
 #include <concepts>
@@ -11,7 +12,20 @@
 #include <ranges>
 #include <type_traits>
 
-namespace gl::type_traits {
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+#include <execution>
+#endif
+
+namespace gl::inline gl_id_type_namespace {
+
+namespace storage {
+
+template <typename T>
+class arena_ptr;
+
+} // namespace storage
+
+namespace type_traits {
 
 template <typename T>
 concept c_properties =
@@ -73,7 +87,8 @@ concept c_const_range = requires(R& r) {
 
 template <typename T>
 concept c_strong_smart_ptr =
-    c_instantiation_of<T, std::unique_ptr> or c_instantiation_of<T, std::shared_ptr>;
+    c_instantiation_of<T, std::unique_ptr> or c_instantiation_of<T, std::shared_ptr>
+    or c_instantiation_of<T, storage::arena_ptr>;
 
 template <typename T>
 concept c_strong_ptr = c_strong_smart_ptr<T> or std::is_pointer_v<T>;
@@ -114,10 +129,17 @@ concept c_has_numeric_limits_max = requires {
     { std::numeric_limits<T>::max() } -> std::same_as<T>;
 };
 
+#ifdef GL_CONFIG_EXECUTION_POLICIES
+template <typename T>
+concept c_execution_policy = std::is_execution_policy_v<std::remove_cvref_t<T>>;
+#endif
+
 template <typename T>
 concept c_readable = requires(T value, std::istream& is) { is >> value; };
 
 template <typename T>
 concept c_writable = requires(T value, std::ostream& os) { os << value; };
 
-} // namespace gl::type_traits
+} // namespace type_traits
+
+} // namespace gl::inline gl_id_type_namespace
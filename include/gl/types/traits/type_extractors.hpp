@@ -5,8 +5,9 @@
 #pragma once
 
 #include "concepts.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
-namespace gl::type_traits {
+namespace gl::inline gl_id_type_namespace::type_traits {
 
 template <typename T>
 struct ptr_element_type;
@@ -24,4 +25,4 @@ struct ptr_element_type<T*> {
 template <typename T>
 using ptr_element_type_t = typename ptr_element_type<T>::type;
 
-} // namespace gl::type_traits
+} // namespace gl::inline gl_id_type_namespace::type_traits
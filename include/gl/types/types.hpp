@@ -4,14 +4,21 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
+
 #include <cstdint>
 #include <optional>
 #include <utility>
 
-namespace gl::types {
+namespace gl::inline gl_id_type_namespace::types {
 
 using size_type = std::uint64_t;
+
+#ifdef GL_CONFIG_ID_TYPE_32
+using id_type = std::uint32_t;
+#else
 using id_type = size_type;
+#endif
 
 template <typename T>
 using homogeneous_pair = std::pair<T, T>;
@@ -25,4 +32,4 @@ using optional_cref = std::optional<std::reference_wrapper<const std::remove_cvr
 template <typename T>
 using const_ref_wrap = std::reference_wrapper<const T>;
 
-} // namespace gl::types
+} // namespace gl::inline gl_id_type_namespace::types
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::util {
+
+/*
+Removes the elements at the positions marked in the `removed` mask in a single pass,
+    preserving the order of the remaining elements.
+*/
+template <typename T, typename Allocator>
+void compact(std::vector<T, Allocator>& elements, const std::vector<bool>& removed) {
+    types::size_type n_kept = constants::default_size;
+    for (types::size_type i = constants::begin_idx; i < elements.size(); ++i) {
+        if (removed[i])
+            continue;
+
+        if (n_kept != i)
+            elements[n_kept] = std::move(elements[i]);
+        ++n_kept;
+    }
+
+    elements.erase(elements.begin() + static_cast<std::ptrdiff_t>(n_kept), elements.end());
+}
+
+/*
+Returns a map of the indices of the elements which are not marked in the `removed` mask
+    to their indices after compaction.
+*/
+[[nodiscard]] inline std::vector<types::id_type> compacted_ids(const std::vector<bool>& removed) {
+    std::vector<types::id_type> new_ids(removed.size());
+
+    types::id_type new_id = constants::initial_id;
+    for (types::size_type i = constants::begin_idx; i < removed.size(); ++i)
+        new_ids[i] = removed[i] ? new_id : new_id++;
+
+    return new_ids;
+}
+
+} // namespace gl::inline gl_id_type_namespace::util
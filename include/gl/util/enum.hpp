@@ -5,10 +5,11 @@
 #pragma once
 
 #include "gl/attributes/force_inline.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 
 #include <type_traits>
 
-namespace gl::util {
+namespace gl::inline gl_id_type_namespace::util {
 
 // TODO [C++23]: replace with std::to_underlying
 template <typename Enum>
@@ -17,4 +18,4 @@ requires(std::is_enum_v<Enum>)
     return static_cast<std::underlying_type_t<Enum>>(e);
 }
 
-} // namespace gl::util
+} // namespace gl::inline gl_id_type_namespace::util
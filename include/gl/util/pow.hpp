@@ -4,13 +4,14 @@
 
 #pragma once
 
+#include "gl/attributes/id_type_namespace.hpp"
 #include "gl/constants.hpp"
 #include "gl/types/types.hpp"
 
 #include <algorithm>
 #include <tuple>
 
-namespace gl::util {
+namespace gl::inline gl_id_type_namespace::util {
 
 // exponentation function for u64 integral type
 [[nodiscard]] inline constexpr types::size_type upow(types::size_type base, types::size_type exp) {
@@ -40,4 +41,4 @@ namespace gl::util {
     return (upow(base, i_end + constants::one) - upow(base, i_begin)) / (base - constants::one);
 }
 
-} // namespace gl::util
+} // namespace gl::inline gl_id_type_namespace::util
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "gl/constants.hpp"
+#include "gl/types/types.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <vector>
+
+namespace gl::inline gl_id_type_namespace::util {
+
+namespace detail {
+
+// the ratio of the range sizes above which the galloping search is used instead of merging
+constexpr inline types::size_type gallop_size_ratio = 8ull;
+
+template <typename T, std::ranges::random_access_range R1, std::ranges::random_access_range R2>
+void merge_intersection(const R1& first, const R2& second, std::vector<T>& intersection) {
+    auto first_it = std::ranges::begin(first);
+    auto second_it = std::ranges::begin(second);
+
+    while (first_it != std::ranges::end(first) and second_it != std::ranges::end(second)) {
+        const T first_value = *first_it;
+        const T second_value = *second_it;
+
+        if (first_value < second_value) {
+            ++first_it;
+        }
+        else if (second_value < first_value) {
+            ++second_it;
+        }
+        else {
+            if (intersection.empty() or intersection.back() != first_value)
+                intersection.push_back(first_value);
+            ++first_it;
+            ++second_it;
+        }
+    }
+}
+
+template <
+    typename T,
+    std::ranges::random_access_range ShortRange,
+    std::ranges::random_access_range LongRange>
+void gallop_intersection(
+    const ShortRange& short_range, const LongRange& long_range, std::vector<T>& intersection
+) {
+    auto long_it = std::ranges::begin(long_range);
+    const auto long_end = std::ranges::end(long_range);
+
+    for (const T value : short_range) {
+        if (not intersection.empty() and intersection.back() == value)
+            continue;
+
+        // exponentially extend the searched range until it contains the lower bound of the value
+        auto lo = long_it;
+        std::ranges::range_difference_t<LongRange> step = constants::one;
+        while (step < long_end - lo and *(lo + step) < value) {
+            lo += step;
+            step *= constants::two;
+        }
+        const auto hi = step < long_end - lo ? lo + step + constants::one : long_end;
+
+        long_it = std::ranges::lower_bound(lo, hi, value);
+        if (long_it == long_end)
+            return;
+
+        if (*long_it == value)
+            intersection.push_back(value);
+    }
+}
+
+} // namespace detail
+
+/*
+Returns the intersection of two ranges sorted in the non-descending order as a sorted vector
+    of unique values.
+If one of the ranges is much longer than the other, the values of the shorter range are looked up
+    in the longer range with the galloping (exponential) search instead of merging the ranges.
+*/
+template <std::ranges::random_access_range R1, std::ranges::random_access_range R2>
+requires std::ranges::sized_range<R1> and std::ranges::sized_range<R2>
+[[nodiscard]] std::vector<std::ranges::range_value_t<R1>> sorted_intersection(
+    const R1& first, const R2& second
+) {
+    using value_type = std::ranges::range_value_t<R1>;
+
+    const auto first_size = static_cast<types::size_type>(std::ranges::size(first));
+    const auto second_size = static_cast<types::size_type>(std::ranges::size(second));
+
+    std::vector<value_type> intersection;
+    if (first_size == constants::zero or second_size == constants::zero)
+        return intersection;
+
+    if (second_size / detail::gallop_size_ratio > first_size)
+        detail::gallop_intersection(first, second, intersection);
+    else if (first_size / detail::gallop_size_ratio > second_size)
+        detail::gallop_intersection(second, first, intersection);
+    else
+        detail::merge_intersection(first, second, intersection);
+
+    return intersection;
+}
+
+} // namespace gl::inline gl_id_type_namespace::util
@@ -0,0 +1,108 @@
+// Copyright (c) 2024 Jakub Musiał
+// This file is part of the CPP-GL project (https://github.com/SpectraL519/cpp-gl).
+// Licensed under the MIT License. See the LICENSE file in the project root for full license information.
+
+#pragma once
+
+#include "gl/attributes/id_type_namespace.hpp"
+#include "graph_utility.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace gl::inline gl_id_type_namespace {
+
+/*
+A multi-version graph which allows the readers to traverse consistent snapshots of the graph
+    while the writers keep modifying it.
+
+The writers modify a private working graph (`modify`) and make the changes visible to the
+    readers by publishing a new version (`publish`), which is a frozen (immutable, csr) copy
+    of the working graph. Taking a snapshot is O(1) and never waits for a modification or
+    a publication to finish - the readers only load the pointer to the latest version,
+    which is stored in an atomic shared pointer.
+A version is reclaimed as soon as it is neither the latest version nor held by any reader.
+
+All methods can be called concurrently. The modifications and publications are serialized
+    with a writer lock, so a publication always captures the graph between two modifications.
+*/
+
+template <type_traits::c_graph GraphType>
+requires(not type_traits::c_immutable_impl_tag<typename GraphType::implementation_tag>)
+class versioned_graph final {
+public:
+    using graph_type = GraphType;
+    using snapshot_type = typename graph_type::frozen_graph_type;
+    using snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    versioned_graph() : versioned_graph(graph_type{}) {}
+
+    explicit versioned_graph(graph_type&& graph)
+    : _graph(std::move(graph)),
+      _snapshot(std::make_shared<const snapshot_type>(this->_graph.freeze())) {}
+
+    versioned_graph(const versioned_graph&) = delete;
+    versioned_graph& operator=(const versioned_graph&) = delete;
+
+    versioned_graph(versioned_graph&&) = delete;
+    versioned_graph& operator=(versioned_graph&&) = delete;
+
+    ~versioned_graph() = default;
+
+    // returns the latest published version of the graph
+    [[nodiscard]] gl_attr_force_inline snapshot_ptr_type snapshot() const {
+        return this->_snapshot.load(std::memory_order_acquire);
+    }
+
+    // the number of versions published so far (the initial version is `0`)
+    [[nodiscard]] gl_attr_force_inline types::size_type version() const {
+        return this->_version.load(std::memory_order_acquire);
+    }
+
+    // applies the modification to the working graph and returns its result
+    template <std::invocable<graph_type&> Modification>
+    decltype(auto) modify(Modification&& modification) {
+        std::lock_guard<std::mutex> lock{this->_write_mutex};
+        return std::invoke(std::forward<Modification>(modification), this->_graph);
+    }
+
+    // publishes the current state of the working graph as a new version and returns it
+    snapshot_ptr_type publish() {
+        std::lock_guard<std::mutex> lock{this->_write_mutex};
+        return this->_publish();
+    }
+
+    // applies the modification to the working graph and publishes the modified graph
+    template <std::invocable<graph_type&> Modification>
+    snapshot_ptr_type modify_and_publish(Modification&& modification) {
+        std::lock_guard<std::mutex> lock{this->_write_mutex};
+        std::invoke(std::forward<Modification>(modification), this->_graph);
+        return this->_publish();
+    }
+
+private:
+    // requires the writer lock to be held
+    snapshot_ptr_type _publish() {
+        auto published = std::make_shared<const snapshot_type>(this->_graph.freeze());
+
+        // the version is incremented after the new snapshot is stored, so a reader which
+        // observes a version always gets a snapshot at least as recent as that version
+        this->_snapshot.store(published, std::memory_order_release);
+        this->_version.fetch_add(constants::one, std::memory_order_release);
+
+        return published;
+    }
+
+    graph_type _graph;
+    std::mutex _write_mutex;
+
+    std::atomic<snapshot_ptr_type> _snapshot;
+    std::atomic<types::size_type> _version = constants::zero;
+};
+
+} // namespace gl::inline gl_id_type_namespace
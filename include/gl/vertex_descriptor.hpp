@@ -5,6 +5,7 @@
 #pragma once
 
 #include "decl/graph_traits.hpp"
+#include "gl/attributes/id_type_namespace.hpp"
 #include "graph_io.hpp"
 #include "types/properties.hpp"
 #include "types/type_traits.hpp"
@@ -13,7 +14,7 @@
 #include <compare>
 #include <format>
 
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 template <type_traits::c_properties Properties = types::empty_properties>
 class vertex_descriptor final {
@@ -119,4 +120,4 @@ template <type_traits::c_instantiation_of<vertex_descriptor> VertexType>
 
 } // namespace detail
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
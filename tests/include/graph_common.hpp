@@ -0,0 +1,39 @@
+#pragma once
+
+#include "constants.hpp"
+#include "namespaces.hpp"
+
+#include <gl/graph.hpp>
+
+#include <vector>
+
+namespace gl_testing::graph_common {
+
+// the rows of the bit-packed adjacency matrices of such graphs span multiple words
+inline constexpr lib_t::size_type n_vertex_removal_graph_vertices = 70ull;
+
+// the removed vertices lie in different words of the bit-packed matrix rows
+inline const std::vector<lib_t::id_type> vertex_removal_ids{
+    constants::vertex_id_1,
+    constants::vertex_id_3,
+    40ull,
+    41ull,
+    n_vertex_removal_graph_vertices - constants::one_element
+};
+
+// creates the graph on which the removal of the `vertex_removal_ids` vertices is tested
+template <lib_tt::c_instantiation_of<lib::graph> GraphType>
+[[nodiscard]] GraphType make_vertex_removal_graph() {
+    constexpr auto n_vertices = n_vertex_removal_graph_vertices;
+
+    GraphType graph{n_vertices};
+    for (const auto vertex_id : graph.vertex_ids()) {
+        graph.add_edge(vertex_id, (vertex_id * constants::three) % n_vertices);
+        if (vertex_id % constants::two == constants::zero)
+            graph.add_edge(vertex_id, (vertex_id + constants::one) % n_vertices);
+    }
+
+    return graph;
+}
+
+} // namespace gl_testing::graph_common
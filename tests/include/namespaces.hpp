@@ -1,7 +1,9 @@
 #pragma once
 
+#include <gl/attributes/id_type_namespace.hpp>
+
 // required for the type alias
-namespace gl {
+namespace gl::inline gl_id_type_namespace {
 
 namespace impl {} // namespace impl
 
@@ -9,7 +11,7 @@ namespace types {} // namespace types
 
 namespace type_traits {} // namespace type_traits
 
-} // namespace gl
+} // namespace gl::inline gl_id_type_namespace
 
 namespace gl_testing {
 
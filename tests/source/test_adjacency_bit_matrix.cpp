@@ -0,0 +1,360 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/graph.hpp>
+#include <gl/impl/adjacency_bit_matrix.hpp>
+
+#include <doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_adjacency_bit_matrix");
+
+namespace {
+
+// spans multiple words of a matrix row
+constexpr lib_t::size_type n_vertices_multiword = 150ull;
+
+} // namespace
+
+TEST_CASE("the bit matrix representation should be selected only with the bit_matrix_t tag") {
+    using bit_matrix_traits_type = lib::bit_matrix_graph_traits<lib::undirected_t>;
+    using matrix_traits_type = lib::matrix_graph_traits<lib::directed_t>;
+
+    CHECK(std::same_as<
+          typename lib::graph<bit_matrix_traits_type>::implementation_type,
+          lib_i::adjacency_bit_matrix<bit_matrix_traits_type>>);
+    CHECK(std::same_as<
+          typename lib::graph<matrix_traits_type>::implementation_type,
+          lib_i::adjacency_matrix<matrix_traits_type>>);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "directional_tag-independent tests", EdgeDirectionalTag, edge_directional_tag_template
+) {
+    using traits_type = lib::bit_matrix_graph_traits<EdgeDirectionalTag>;
+    using sut_type = lib_i::adjacency_bit_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+    using edge_ptr_type = typename sut_type::edge_ptr_type;
+
+    std::vector<vertex_type> vertices;
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_multiword; ++id)
+        vertices.emplace_back(id);
+
+    const auto make_edge = [&vertices](
+                               const lib_t::id_type first_id, const lib_t::id_type second_id
+                           ) {
+        return lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id]);
+    };
+
+    sut_type sut{n_vertices_multiword};
+
+    SUBCASE("the matrix rows should be aligned to the cache line size") {
+        REQUIRE_EQ(sut.n_vertices(), n_vertices_multiword);
+        const auto row_size = sut.row_stride() * sizeof(typename sut_type::word_type);
+        CHECK_EQ(row_size % sut_type::row_alignment, constants::zero);
+
+        for (lib_t::id_type id = lib::constants::initial_id; id < sut.n_vertices(); ++id)
+            CHECK_EQ(
+                reinterpret_cast<std::uintptr_t>(sut.row_data(id)) % sut_type::row_alignment,
+                constants::zero
+            );
+    }
+
+    SUBCASE("add_edge should return the added edge by value and set the adjacency bits") {
+        const auto last_id = n_vertices_multiword - constants::one_element;
+
+        static_assert(std::same_as<
+                      decltype(sut.add_edge(vertices[constants::vertex_id_1], vertices[last_id])),
+                      edge_type>);
+
+        const auto added_edge = sut.add_edge(vertices[constants::vertex_id_1], vertices[last_id]);
+        CHECK_EQ(&added_edge.first(), &vertices[constants::vertex_id_1]);
+        CHECK_EQ(&added_edge.second(), &vertices[last_id]);
+        CHECK_EQ(sut.n_unique_edges(), constants::one_element);
+        CHECK(sut.has_edge(constants::vertex_id_1, last_id));
+        CHECK(sut.has_edge(added_edge));
+        CHECK_EQ(
+            sut.has_edge(last_id, constants::vertex_id_1),
+            lib::type_traits::is_undirected_v<edge_type>
+        );
+
+        // the edges returned by get_edge are stored, so their addresses are stable
+        const auto edge_ref = sut.get_edge(constants::vertex_id_1, last_id);
+        REQUIRE(edge_ref.has_value());
+        CHECK_EQ(edge_ref->get().incident_vertex_ids(), added_edge.incident_vertex_ids());
+        CHECK_EQ(&sut.get_edge(constants::vertex_id_1, last_id)->get(), &edge_ref->get());
+
+        CHECK_THROWS_AS(sut.add_edge(make_edge(constants::vertex_id_1, last_id)), std::logic_error);
+    }
+
+    SUBCASE("edges added with add_edges_from should be yielded as temporary edges") {
+        static_assert(not std::is_lvalue_reference_v<
+                      std::iter_reference_t<typename sut_type::edge_iterator_type>>);
+
+        std::vector<edge_ptr_type> new_edges;
+        for (lib_t::id_type id = constants::vertex_id_2; id < n_vertices_multiword;
+             id += constants::two)
+            new_edges.push_back(make_edge(constants::vertex_id_1, id));
+        const auto n_new_edges = new_edges.size();
+
+        sut.add_edges_from(constants::vertex_id_1, std::move(new_edges));
+        REQUIRE_EQ(sut.n_unique_edges(), n_new_edges);
+        REQUIRE_EQ(sut.out_degree(constants::vertex_id_1), n_new_edges);
+
+        const auto adjacent_edges = sut.adjacent_edges(constants::vertex_id_1);
+        REQUIRE_EQ(adjacent_edges.distance(), n_new_edges);
+
+        lib_t::id_type expected_id = constants::vertex_id_2;
+        for (const auto& edge : adjacent_edges) {
+            CHECK_EQ(edge.first_id(), constants::vertex_id_1);
+            CHECK_EQ(edge.second_id(), expected_id);
+            CHECK_EQ(&edge.first(), &vertices[constants::vertex_id_1]);
+            CHECK_EQ(&edge.second(), &vertices[expected_id]);
+            CHECK(sut.has_edge(edge));
+
+            // the edges returned by get_edge are stored, so their addresses are stable
+            const auto edge_ref = sut.get_edge(edge.first_id(), edge.second_id());
+            REQUIRE(edge_ref.has_value());
+            CHECK_EQ(edge_ref->get().incident_vertex_ids(), edge.incident_vertex_ids());
+            CHECK_EQ(&sut.get_edge(edge.first_id(), edge.second_id())->get(), &edge_ref->get());
+            expected_id += constants::two;
+        }
+    }
+
+    SUBCASE("add_edges should throw an error if the new edges are duplicated") {
+        std::vector<edge_ptr_type> duplicate_edges;
+        duplicate_edges.push_back(make_edge(constants::vertex_id_1, constants::vertex_id_2));
+        duplicate_edges.push_back(make_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+        CHECK_THROWS_AS(sut.add_edges(std::move(duplicate_edges)), std::logic_error);
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+        // the reversed edge is a duplicate only in undirected graphs
+        std::vector<edge_ptr_type> reversed_edges;
+        reversed_edges.push_back(make_edge(constants::vertex_id_1, constants::vertex_id_2));
+        reversed_edges.push_back(make_edge(constants::vertex_id_2, constants::vertex_id_1));
+
+        if constexpr (lib::type_traits::is_undirected_v<edge_type>) {
+            CHECK_THROWS_AS(sut.add_edges(std::move(reversed_edges)), std::logic_error);
+            CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+            CHECK_EQ(sut.degree(constants::vertex_id_1), constants::zero);
+        }
+        else {
+            sut.add_edges(std::move(reversed_edges));
+            CHECK_EQ(sut.n_unique_edges(), constants::two);
+            CHECK_EQ(sut.degree(constants::vertex_id_1), constants::two);
+        }
+    }
+
+    SUBCASE("remove_edge should clear the adjacency bits and throw for invalid edges") {
+        const auto edge = sut.add_edge(make_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+        const auto not_added_edge = make_edge(constants::vertex_id_2, constants::vertex_id_3);
+        CHECK_FALSE(sut.has_edge(*not_added_edge));
+        CHECK_THROWS_AS(sut.remove_edge(*not_added_edge), std::invalid_argument);
+
+        sut.remove_edge(edge);
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_2, constants::vertex_id_1));
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, constants::vertex_id_2));
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+    }
+
+    SUBCASE("remove_vertex should shift the adjacency bits of the following vertices") {
+        const auto removed_id = constants::vertex_id_2;
+        const auto last_id = n_vertices_multiword - constants::one_element;
+
+        sut.add_edge(make_edge(constants::vertex_id_1, removed_id));
+        sut.add_edge(make_edge(removed_id, last_id));
+        sut.add_edge(make_edge(constants::vertex_id_1, last_id));
+        const auto& kept_edge = sut.get_edge(constants::vertex_id_1, last_id)->get();
+
+        std::vector<edge_ptr_type> new_edges;
+        new_edges.push_back(make_edge(last_id, last_id));
+        sut.add_edges_from(last_id, std::move(new_edges));
+
+        sut.remove_vertex(vertices[removed_id]);
+
+        const auto new_last_id = last_id - constants::one_element;
+        REQUIRE_EQ(sut.n_vertices(), n_vertices_multiword - constants::one_element);
+        CHECK_EQ(sut.n_unique_edges(), constants::two);
+        CHECK(sut.has_edge(constants::vertex_id_1, new_last_id));
+        CHECK(sut.has_edge(new_last_id, new_last_id));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, removed_id));
+        CHECK_FALSE(sut.has_edge(removed_id, new_last_id));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, last_id));
+
+        // the previously materialized edge should be preserved
+        CHECK_EQ(&sut.get_edge(constants::vertex_id_1, new_last_id)->get(), &kept_edge);
+    }
+
+    SUBCASE("remove_incident_edges should clear the row and the column of the vertex") {
+        const auto isolated_id = constants::vertex_id_2;
+        const auto last_id = n_vertices_multiword - constants::one_element;
+
+        sut.add_edge(make_edge(constants::vertex_id_1, isolated_id));
+        sut.add_edge(make_edge(isolated_id, last_id));
+        sut.add_edge(make_edge(isolated_id, isolated_id));
+        sut.add_edge(make_edge(constants::vertex_id_1, last_id));
+
+        sut.remove_incident_edges(isolated_id);
+        REQUIRE_EQ(sut.n_vertices(), n_vertices_multiword);
+        CHECK_EQ(sut.n_unique_edges(), constants::one_element);
+        CHECK_EQ(sut.degree(isolated_id), constants::zero);
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, isolated_id));
+        CHECK(sut.has_edge(constants::vertex_id_1, last_id));
+    }
+
+    SUBCASE("has_edge(id, id) and get_edge(id, id) should return false/nullopt if either id is "
+            "invalid") {
+        CHECK_FALSE(sut.has_edge(n_vertices_multiword, constants::vertex_id_1));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, n_vertices_multiword));
+        CHECK_FALSE(sut.get_edge(n_vertices_multiword, constants::vertex_id_1));
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, n_vertices_multiword));
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    edge_directional_tag_template,
+    lib::directed_t, // directed adj bit matrix
+    lib::undirected_t // undirected adj bit matrix
+);
+
+TEST_CASE("degrees of the directed adjacency bit matrix should be computed from the set bits") {
+    using traits_type = lib::bit_matrix_graph_traits<lib::directed_t>;
+    using sut_type = lib_i::adjacency_bit_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+
+    std::vector<vertex_type> vertices;
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_multiword; ++id)
+        vertices.emplace_back(id);
+
+    sut_type sut{n_vertices_multiword};
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_multiword; ++id)
+        sut.add_edge(
+            lib::detail::make_edge<edge_type>(vertices[constants::vertex_id_1], vertices[id])
+        );
+
+    CHECK_EQ(sut.out_degree(constants::vertex_id_1), n_vertices_multiword);
+    CHECK_EQ(sut.in_degree(constants::vertex_id_1), constants::one);
+    CHECK_EQ(sut.degree(constants::vertex_id_1), n_vertices_multiword + constants::one);
+
+    const auto in_degree_map = sut.in_degree_map();
+    const auto out_degree_map = sut.out_degree_map();
+    const auto degree_map = sut.degree_map();
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_multiword; ++id) {
+        CHECK_EQ(in_degree_map[id], sut.in_degree(id));
+        CHECK_EQ(out_degree_map[id], sut.out_degree(id));
+        CHECK_EQ(degree_map[id], sut.degree(id));
+    }
+}
+
+TEST_CASE("in-degrees of the directed adjacency bit matrix should follow the edge changes") {
+    using traits_type = lib::bit_matrix_graph_traits<lib::directed_t>;
+    using sut_type = lib_i::adjacency_bit_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+    vertices.emplace_back(constants::n_elements);
+
+    sut_type sut{constants::n_elements};
+    sut.add_edge(vertices[constants::vertex_id_1], vertices[constants::vertex_id_3]);
+    sut.add_edge(vertices[constants::vertex_id_2], vertices[constants::vertex_id_3]);
+    const auto removed_edge =
+        sut.add_edge(vertices[constants::vertex_id_3], vertices[constants::vertex_id_2]);
+
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{constants::zero, constants::one, constants::two}
+    ));
+
+    sut.remove_edge(removed_edge);
+    CHECK_EQ(sut.in_degree(constants::vertex_id_2), constants::zero);
+
+    // the loop is both an incoming and an outgoing edge of the vertex
+    sut.add_edge(vertices[constants::vertex_id_3], vertices[constants::vertex_id_3]);
+    CHECK_EQ(sut.in_degree(constants::vertex_id_3), constants::three);
+
+    sut.remove_incident_edges(constants::vertex_id_3);
+    CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{constants::zero, constants::zero, constants::zero}
+    ));
+
+    sut.add_vertex();
+    CHECK_EQ(sut.in_degree(constants::n_elements), constants::zero);
+
+    sut.add_edge(vertices[constants::vertex_id_1], vertices[constants::n_elements]);
+    sut.add_edge(vertices[constants::vertex_id_2], vertices[constants::n_elements]);
+    sut.add_edge(vertices[constants::n_elements], vertices[constants::vertex_id_2]);
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{
+            constants::zero, constants::one, constants::zero, constants::two
+        }
+    ));
+
+    // the vertex ids are compacted after the removal of the first vertex
+    sut.remove_vertices(std::vector<bool>{true, false, false, false});
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{constants::one, constants::zero, constants::one}
+    ));
+
+    sut.remove_vertex(vertices[constants::vertex_id_1]);
+    CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(), std::vector<lib_t::size_type>{constants::zero, constants::zero}
+    ));
+}
+
+TEST_CASE("degrees of the undirected adjacency bit matrix should count the loops twice") {
+    using traits_type = lib::bit_matrix_graph_traits<lib::undirected_t>;
+    using sut_type = lib_i::adjacency_bit_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    sut_type sut{constants::n_elements};
+    sut.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_1], vertices[constants::vertex_id_2]
+    ));
+    sut.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_2]
+    ));
+
+    CHECK_EQ(sut.n_unique_edges(), constants::two);
+    CHECK_EQ(sut.degree(constants::vertex_id_1), constants::one);
+    CHECK_EQ(sut.degree(constants::vertex_id_2), constants::three);
+    CHECK_EQ(sut.degree(constants::vertex_id_3), constants::zero);
+    CHECK(std::ranges::equal(
+        sut.degree_map(),
+        std::vector<lib_t::size_type>{constants::one, constants::three, constants::zero}
+    ));
+
+    const auto edge_1_2 = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+    const auto edge_2_1 = sut.get_edge(constants::vertex_id_2, constants::vertex_id_1);
+    REQUIRE(edge_1_2.has_value());
+    REQUIRE(edge_2_1.has_value());
+    CHECK_EQ(&edge_1_2->get(), &edge_2_1->get());
+
+    sut.remove_vertex(vertices[constants::vertex_id_2]);
+    CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+}
+
+TEST_SUITE_END(); // test_adjacency_bit_matrix
+
+} // namespace gl_testing
@@ -0,0 +1,266 @@
+#include "constants.hpp"
+
+#include <gl/graph_traits.hpp>
+#include <gl/impl/adjacency_compressed.hpp>
+#include <gl/impl/adjacency_list.hpp>
+
+#include <doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_adjacency_compressed");
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "directional_tag-independent tests", EdgeDirectionalTag, edge_directional_tag_template
+) {
+    using traits_type = lib::compressed_graph_traits<EdgeDirectionalTag>;
+    using vertex_type = typename traits_type::vertex_type;
+    using edge_type = typename traits_type::edge_type;
+    using source_type = lib_i::adjacency_list<lib::list_graph_traits<EdgeDirectionalTag>>;
+    using sut_type = lib_i::adjacency_compressed<traits_type>;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    const auto get_vertex = [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+        return vertices[vertex_id];
+    };
+
+    source_type source{constants::n_elements};
+    const auto add_source_edge = [&](const lib_t::id_type first_id, const lib_t::id_type second_id
+                                 ) -> const edge_type& {
+        return source.add_edge(
+            lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id])
+        );
+    };
+
+    SUBCASE("should be initialized with no vertices and no edges by default") {
+        sut_type sut{};
+        CHECK_EQ(sut.n_vertices(), constants::zero_elements);
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+        CHECK(sut.data().empty());
+    }
+
+    SUBCASE("constructed with the n_vertices parameter should create vertices with no edges") {
+        sut_type sut{constants::n_elements};
+        REQUIRE_EQ(sut.n_vertices(), constants::n_elements);
+        REQUIRE_EQ(sut.n_unique_edges(), constants::zero_elements);
+
+        std::ranges::for_each(constants::vertex_id_view, [&sut](const lib_t::id_type vertex_id) {
+            CHECK_EQ(sut.adjacent_edges(vertex_id).distance(), constants::zero_elements);
+            CHECK_EQ(sut.degree(vertex_id), constants::zero_elements);
+        });
+    }
+
+    SUBCASE("constructed from a source implementation should encode the sorted neighbor lists "
+            "and bind the decoded edges to the given vertices") {
+        for (const auto first_id : constants::vertex_id_view)
+            for (const auto second_id : constants::vertex_id_view | std::views::reverse)
+                add_source_edge(first_id, second_id);
+
+        std::vector<vertex_type> target_vertices;
+        for (const auto id : constants::vertex_id_view)
+            target_vertices.emplace_back(id);
+
+        const sut_type sut{
+            source,
+            [&target_vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+                return target_vertices[vertex_id];
+            }
+        };
+
+        REQUIRE_EQ(sut.n_vertices(), source.n_vertices());
+        REQUIRE_EQ(sut.n_unique_edges(), source.n_unique_edges());
+
+        for (const auto vertex_id : constants::vertex_id_view) {
+            std::vector<lib_t::id_type> expected_neighbor_ids;
+            for (const auto& edge : source.adjacent_edges(vertex_id))
+                expected_neighbor_ids.push_back(edge.incident_vertex_id(vertex_id));
+            std::ranges::sort(expected_neighbor_ids);
+
+            CHECK(std::ranges::equal(sut.neighbor_ids(vertex_id), expected_neighbor_ids));
+            CHECK_EQ(sut.degree(vertex_id), source.degree(vertex_id));
+
+            for (const auto& edge : sut.adjacent_edges(vertex_id)) {
+                CHECK(edge.is_incident_with(target_vertices[vertex_id]));
+                CHECK_EQ(&edge.first(), &target_vertices[edge.first_id()]);
+                CHECK_EQ(&edge.second(), &target_vertices[edge.second_id()]);
+                CHECK(sut.has_edge(edge));
+            }
+        }
+
+        CHECK(std::ranges::equal(sut.in_degree_map(), source.in_degree_map()));
+        CHECK(std::ranges::equal(sut.out_degree_map(), source.out_degree_map()));
+        CHECK(std::ranges::equal(sut.degree_map(), source.degree_map()));
+    }
+
+    SUBCASE("the neighbor ids should be properly decoded for multi-byte gaps") {
+        constexpr lib_t::size_type n_vertices = 100'000ull;
+        constexpr std::array<lib_t::id_type, 5ull> neighbor_ids{
+            0ull, 127ull, 128ull, 16'511ull, n_vertices - constants::one
+        };
+
+        std::vector<vertex_type> many_vertices;
+        many_vertices.reserve(n_vertices);
+        for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices; ++id)
+            many_vertices.emplace_back(id);
+
+        source_type many_source{n_vertices};
+        for (const auto neighbor_id : neighbor_ids)
+            many_source.add_edge(lib::detail::make_edge<edge_type>(
+                many_vertices[constants::vertex_id_1], many_vertices[neighbor_id]
+            ));
+
+        const sut_type sut{
+            many_source,
+            [&many_vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+                return many_vertices[vertex_id];
+            }
+        };
+
+        CHECK(std::ranges::equal(sut.neighbor_ids(constants::vertex_id_1), neighbor_ids));
+        CHECK_EQ(sut.adjacent_edges(constants::vertex_id_1).distance(), neighbor_ids.size());
+        for (const auto neighbor_id : neighbor_ids)
+            CHECK(sut.has_edge(constants::vertex_id_1, neighbor_id));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, 129ull));
+    }
+
+    SUBCASE("has_edge(id, id) and get_edge(id, id) should return false/nullopt if either id is "
+            "invalid") {
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        const sut_type sut{source, get_vertex};
+
+        CHECK_FALSE(sut.has_edge(constants::out_of_range_elemenet_idx, constants::vertex_id_2));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::out_of_range_elemenet_idx));
+        CHECK_FALSE(sut.get_edge(constants::out_of_range_elemenet_idx, constants::vertex_id_2));
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, constants::out_of_range_elemenet_idx));
+        CHECK(sut.get_edges(constants::out_of_range_elemenet_idx, constants::vertex_id_2).empty());
+    }
+
+    SUBCASE("get_edges(id, id) should return stable, distinct edges for the parallel edges") {
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_3);
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        const sut_type sut{source, get_vertex};
+
+        const auto edges = sut.get_edges(constants::vertex_id_1, constants::vertex_id_2);
+        REQUIRE_EQ(edges.size(), constants::two);
+        CHECK_NE(&edges.front().get(), &edges.back().get());
+
+        const auto edge = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+        REQUIRE(edge.has_value());
+        CHECK_EQ(&edge->get(), &edges.front().get());
+        CHECK(sut.has_edge(edge->get()));
+
+        CHECK_EQ(
+            sut.common_neighbors(constants::vertex_id_1, constants::vertex_id_1),
+            std::vector<lib_t::id_type>{constants::vertex_id_2, constants::vertex_id_3}
+        );
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    edge_directional_tag_template,
+    lib::directed_t, // directed adj compressed
+    lib::undirected_t // undirected adj compressed
+);
+
+TEST_CASE("undirected adjacency compressed should encode the edges in the lists of both incident "
+          "vertices and the loops only once") {
+    using vertex_type = lib::vertex_descriptor<>;
+    using edge_type = lib::undirected_edge<vertex_type>;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    lib_i::adjacency_list<lib::list_graph_traits<lib::undirected_t>> source{constants::n_elements};
+    source.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_1]
+    ));
+    source.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_2]
+    ));
+
+    const lib_i::adjacency_compressed<lib::compressed_graph_traits<lib::undirected_t>> sut{
+        source, [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+            return vertices[vertex_id];
+        }
+    };
+
+    REQUIRE_EQ(sut.n_unique_edges(), constants::two);
+    CHECK_EQ(sut.data().size(), constants::three);
+
+    const auto edge_1_2 = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+    const auto edge_2_1 = sut.get_edge(constants::vertex_id_2, constants::vertex_id_1);
+    REQUIRE(edge_1_2.has_value());
+    REQUIRE(edge_2_1.has_value());
+    CHECK_EQ(&edge_1_2->get(), &edge_2_1->get());
+
+    // the decoded edges are oriented from the vertex with the smaller id
+    CHECK(std::ranges::all_of(sut.adjacent_edges(constants::vertex_id_2), [](const auto& edge) {
+        return edge.first_id() <= edge.second_id();
+    }));
+
+    // the loop is encoded once but counted twice
+    CHECK_EQ(sut.adjacent_edges(constants::vertex_id_2).distance(), constants::two);
+    CHECK_EQ(sut.degree(constants::vertex_id_1), constants::one);
+    CHECK_EQ(sut.degree(constants::vertex_id_2), constants::three);
+    CHECK_EQ(sut.degree(constants::vertex_id_3), constants::zero);
+}
+
+TEST_CASE("adjacency compressed should materialize the same edges for concurrent get_edge calls") {
+    using vertex_type = lib::vertex_descriptor<>;
+    using edge_type = lib::directed_edge<vertex_type>;
+
+    constexpr lib_t::size_type n_threads = 4ull;
+    constexpr lib_t::size_type n_vertices = 64ull;
+
+    std::vector<vertex_type> vertices;
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices; ++id)
+        vertices.emplace_back(id);
+
+    // a complete graph, so that every get_edge call materializes an edge
+    lib_i::adjacency_list<lib::list_graph_traits<lib::directed_t>> source{n_vertices};
+    for (lib_t::id_type first_id = lib::constants::initial_id; first_id < n_vertices; ++first_id)
+        for (lib_t::id_type second_id = lib::constants::initial_id; second_id < n_vertices;
+             ++second_id)
+            source.add_edge(
+                lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id])
+            );
+
+    const lib_i::adjacency_compressed<lib::compressed_graph_traits<lib::directed_t>> sut{
+        source, [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+            return vertices[vertex_id];
+        }
+    };
+
+    // each thread collects the addresses of all edges of the graph
+    std::vector<std::vector<const edge_type*>> edge_addresses(n_threads);
+    std::vector<std::thread> threads;
+    for (lib_t::size_type thread_idx = constants::zero; thread_idx < n_threads; ++thread_idx) {
+        threads.emplace_back([&sut, &addresses = edge_addresses[thread_idx]] {
+            for (lib_t::id_type first_id = lib::constants::initial_id; first_id < n_vertices;
+                 ++first_id)
+                for (lib_t::id_type second_id = lib::constants::initial_id;
+                     second_id < n_vertices;
+                     ++second_id)
+                    addresses.push_back(&sut.get_edge(first_id, second_id)->get());
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& addresses : edge_addresses)
+        CHECK_EQ(addresses, edge_addresses.front());
+}
+
+TEST_SUITE_END(); // test_adjacency_compressed
+
+} // namespace gl_testing
@@ -0,0 +1,289 @@
+#include "constants.hpp"
+
+#include <gl/graph_traits.hpp>
+#include <gl/impl/adjacency_csr.hpp>
+#include <gl/impl/adjacency_list.hpp>
+
+#include <doctest.h>
+
+#include <algorithm>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_adjacency_csr");
+
+namespace {
+
+constexpr lib_t::size_type n_incident_edges_for_fully_connected_vertex =
+    constants::n_elements - constants::one_element;
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "directional_tag-independent tests", EdgeDirectionalTag, edge_directional_tag_template
+) {
+    using traits_type = lib::csr_graph_traits<EdgeDirectionalTag>;
+    using vertex_type = typename traits_type::vertex_type;
+    using source_type = lib_i::adjacency_list<lib::list_graph_traits<EdgeDirectionalTag>>;
+    using edge_type = typename source_type::edge_type;
+    using sut_type = lib_i::adjacency_csr<traits_type>;
+
+    // the edges of the source cannot be passed to the sut, because their properties are mutable
+    static_assert(not std::same_as<typename sut_type::edge_type, edge_type>);
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    const auto get_vertex = [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+        return vertices[vertex_id];
+    };
+
+    source_type source{constants::n_elements};
+    const auto add_source_edge = [&](const lib_t::id_type first_id, const lib_t::id_type second_id
+                                 ) -> const edge_type& {
+        return source.add_edge(
+            lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id])
+        );
+    };
+
+    SUBCASE("should be initialized with no vertices and no edges by default") {
+        sut_type sut{};
+        CHECK_EQ(sut.n_vertices(), constants::zero_elements);
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+        CHECK_EQ(sut.offsets().size(), constants::one_element);
+    }
+
+    SUBCASE("constructed with the n_vertices parameter should create vertices with no edges") {
+        sut_type sut{constants::n_elements};
+        REQUIRE_EQ(sut.n_vertices(), constants::n_elements);
+        REQUIRE_EQ(sut.n_unique_edges(), constants::zero_elements);
+
+        std::ranges::for_each(constants::vertex_id_view, [&sut](const lib_t::id_type vertex_id) {
+            CHECK_EQ(sut.adjacent_edges(vertex_id).distance(), constants::zero_elements);
+        });
+    }
+
+    SUBCASE("constructed from a source implementation should preserve the adjacency order and "
+            "bind the edges to the given vertices") {
+        for (const auto first_id : constants::vertex_id_view)
+            for (const auto second_id : constants::vertex_id_view)
+                if (first_id != second_id)
+                    add_source_edge(first_id, second_id);
+
+        std::vector<vertex_type> target_vertices;
+        for (const auto id : constants::vertex_id_view)
+            target_vertices.emplace_back(id);
+
+        const sut_type sut{
+            source,
+            [&target_vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+                return target_vertices[vertex_id];
+            }
+        };
+
+        REQUIRE_EQ(sut.n_vertices(), source.n_vertices());
+        REQUIRE_EQ(sut.n_unique_edges(), source.n_unique_edges());
+        CHECK_EQ(sut.offsets().back(), sut.targets().size());
+
+        for (const auto vertex_id : constants::vertex_id_view) {
+            const auto source_adjacent_edges = source.adjacent_edges(vertex_id);
+            const auto sut_adjacent_edges = sut.adjacent_edges(vertex_id);
+            REQUIRE_EQ(sut_adjacent_edges.distance(), source_adjacent_edges.distance());
+            CHECK_EQ(sut.degree(vertex_id), source.degree(vertex_id));
+
+            for (auto [source_it, sut_it] = std::pair{source_adjacent_edges.begin(),
+                                                       sut_adjacent_edges.begin()};
+                 source_it != source_adjacent_edges.end();
+                 ++source_it, ++sut_it) {
+                CHECK_EQ(sut_it->first_id(), source_it->first_id());
+                CHECK_EQ(sut_it->second_id(), source_it->second_id());
+                CHECK_EQ(&sut_it->first(), &target_vertices[sut_it->first_id()]);
+                CHECK_EQ(&sut_it->second(), &target_vertices[sut_it->second_id()]);
+                CHECK(sut.has_edge(*sut_it));
+            }
+        }
+
+        CHECK(std::ranges::equal(sut.in_degree_map(), source.in_degree_map()));
+        CHECK(std::ranges::equal(sut.out_degree_map(), source.out_degree_map()));
+        CHECK(std::ranges::equal(sut.degree_map(), source.degree_map()));
+    }
+
+    SUBCASE("has_edge(id, id) and get_edge(id, id) should return false/nullopt if either id is "
+            "invalid") {
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        const sut_type sut{source, get_vertex};
+
+        CHECK_FALSE(sut.has_edge(constants::out_of_range_elemenet_idx, constants::vertex_id_2));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::out_of_range_elemenet_idx));
+        CHECK_FALSE(sut.get_edge(constants::out_of_range_elemenet_idx, constants::vertex_id_2));
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, constants::out_of_range_elemenet_idx));
+        CHECK(sut.get_edges(constants::out_of_range_elemenet_idx, constants::vertex_id_2).empty());
+    }
+
+    SUBCASE("get_edges(id, id) should return all parallel edges connecting the given vertices") {
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_3);
+        add_source_edge(constants::vertex_id_1, constants::vertex_id_2);
+        const sut_type sut{source, get_vertex};
+
+        const auto edges = sut.get_edges(constants::vertex_id_1, constants::vertex_id_2);
+        REQUIRE_EQ(edges.size(), constants::two);
+        CHECK_NE(&edges.front().get(), &edges.back().get());
+
+        const auto edge = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+        REQUIRE(edge.has_value());
+        CHECK_EQ(&edge->get(), &edges.front().get());
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    edge_directional_tag_template,
+    lib::directed_t, // directed adj csr
+    lib::undirected_t // undirected adj csr
+);
+
+TEST_CASE("directed adjacency csr should store the edges only in the source vertex slots") {
+    using vertex_type = lib::vertex_descriptor<>;
+    using edge_type = lib::directed_edge<vertex_type>;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    lib_i::adjacency_list<lib::list_graph_traits<lib::directed_t>> source{constants::n_elements};
+    for (const auto first_id : constants::vertex_id_view)
+        for (const auto second_id : constants::vertex_id_view)
+            if (first_id != second_id)
+                source.add_edge(
+                    lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id])
+                );
+
+    const lib_i::adjacency_csr<lib::csr_graph_traits<lib::directed_t>> sut{
+        source, [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+            return vertices[vertex_id];
+        }
+    };
+
+    REQUIRE_EQ(
+        sut.n_unique_edges(), n_incident_edges_for_fully_connected_vertex * constants::n_elements
+    );
+    CHECK_EQ(sut.targets().size(), sut.n_unique_edges());
+
+    for (const auto vertex_id : constants::vertex_id_view) {
+        CHECK_EQ(sut.in_degree(vertex_id), n_incident_edges_for_fully_connected_vertex);
+        CHECK_EQ(sut.out_degree(vertex_id), n_incident_edges_for_fully_connected_vertex);
+        CHECK(std::ranges::all_of(sut.adjacent_edges(vertex_id), [vertex_id](const auto& edge) {
+            return edge.first_id() == vertex_id;
+        }));
+    }
+
+    CHECK(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+    CHECK(sut.has_edge(constants::vertex_id_2, constants::vertex_id_1));
+    CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_1));
+}
+
+TEST_CASE("undirected adjacency csr should store each edge once and reference it from the slots "
+          "of both incident vertices") {
+    using vertex_type = lib::vertex_descriptor<>;
+    using edge_type = lib::undirected_edge<vertex_type>;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    lib_i::adjacency_list<lib::list_graph_traits<lib::undirected_t>> source{constants::n_elements};
+    source.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_1], vertices[constants::vertex_id_2]
+    ));
+    source.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_2]
+    ));
+
+    const lib_i::adjacency_csr<lib::csr_graph_traits<lib::undirected_t>> sut{
+        source, [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+            return vertices[vertex_id];
+        }
+    };
+
+    REQUIRE_EQ(sut.n_unique_edges(), constants::two);
+
+    const auto edge_1_2 = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+    const auto edge_2_1 = sut.get_edge(constants::vertex_id_2, constants::vertex_id_1);
+    REQUIRE(edge_1_2.has_value());
+    REQUIRE(edge_2_1.has_value());
+    CHECK_EQ(&edge_1_2->get(), &edge_2_1->get());
+
+    // the loop is stored in a single slot but counted twice
+    CHECK_EQ(sut.adjacent_edges(constants::vertex_id_2).distance(), constants::two);
+    CHECK_EQ(sut.degree(constants::vertex_id_1), constants::one);
+    CHECK_EQ(sut.degree(constants::vertex_id_2), constants::three);
+    CHECK_EQ(sut.degree(constants::vertex_id_3), constants::zero);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "adjacency csr with weighted edges should store the weights in the slots of the edges",
+    EdgeDirectionalTag,
+    weighted_edge_directional_tag_template
+) {
+    using edge_properties_type = lib_t::weight_property<>;
+    using weight_type = typename edge_properties_type::weight_type;
+    using source_traits_type =
+        lib::list_graph_traits<EdgeDirectionalTag, lib_t::empty_properties, edge_properties_type>;
+    using traits_type =
+        lib::csr_graph_traits<EdgeDirectionalTag, lib_t::empty_properties, edge_properties_type>;
+    using vertex_type = typename traits_type::vertex_type;
+    using source_edge_type = typename source_traits_type::edge_type;
+    using sut_type = lib_i::adjacency_csr<traits_type>;
+
+    static_assert(sut_type::has_weight_column);
+    static_assert(not lib_i::adjacency_csr<lib::csr_graph_traits<EdgeDirectionalTag>>::
+                      has_weight_column);
+
+    // the weights of the edges cannot diverge from the weight column
+    static_assert(std::is_const_v<decltype(traits_type::edge_type::properties)>);
+    static_assert(not std::is_const_v<decltype(source_edge_type::properties)>);
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    lib_i::adjacency_list<source_traits_type> source{constants::n_elements};
+    for (const auto first_id : constants::vertex_id_view)
+        for (const auto second_id : constants::vertex_id_view)
+            if (first_id < second_id)
+                source.add_edge(lib::detail::make_edge<source_edge_type>(
+                    vertices[first_id],
+                    vertices[second_id],
+                    edge_properties_type{static_cast<weight_type>(first_id + second_id)}
+                ));
+
+    const sut_type sut{source, [&vertices](const lib_t::id_type vertex_id) -> const vertex_type& {
+                           return vertices[vertex_id];
+                       }};
+
+    REQUIRE_EQ(sut.weights().size(), sut.targets().size());
+
+    for (const auto vertex_id : constants::vertex_id_view) {
+        const auto edges = sut.adjacent_edges(vertex_id);
+        const auto incident_vertex_ids = sut.adjacent_vertex_ids(vertex_id);
+        const auto weights = sut.adjacent_weights(vertex_id);
+
+        REQUIRE_EQ(weights.size(), edges.distance());
+        REQUIRE_EQ(incident_vertex_ids.size(), edges.distance());
+
+        auto edge_it = edges.begin();
+        for (lib_t::size_type i = constants::zero; i < weights.size(); ++i, ++edge_it) {
+            CHECK_EQ(weights[i], edge_it->properties.weight);
+            CHECK_EQ(incident_vertex_ids[i], edge_it->incident_vertex_id(vertex_id));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    weighted_edge_directional_tag_template, lib::directed_t, lib::undirected_t
+);
+
+TEST_SUITE_END(); // test_adjacency_csr
+
+} // namespace gl_testing
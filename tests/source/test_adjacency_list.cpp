@@ -363,7 +363,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements;
 
-    std::vector<lib_t::id_type> degree_map;
+    std::vector<lib_t::size_type> degree_map;
 
     SUBCASE("in_degree") {
         degree_map = sut.in_degree_map();
@@ -387,7 +387,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements * constants::two;
 
-    std::vector<lib_t::id_type> degree_map = sut.degree_map();
+    std::vector<lib_t::size_type> degree_map = sut.degree_map();
 
     REQUIRE_EQ(degree_map.size(), constants::n_elements);
     CHECK_EQ(std::ranges::count(degree_map, expected_deg), constants::n_elements);
@@ -419,6 +419,123 @@ TEST_CASE_FIXTURE(
     }
 }
 
+struct test_directed_adjacency_list_with_in_edge_index {
+    using vertex_type = lib::vertex_descriptor<>;
+    using edge_type = lib::directed_edge<vertex_type>;
+    using edge_ptr_type = lib::directed_t::edge_ptr_type<edge_type>;
+    using sut_type = lib_i::adjacency_list<
+        lib::directed_graph_traits<
+            lib_t::empty_properties,
+            lib_t::empty_properties,
+            lib_i::bidirectional_list_t>>;
+
+    test_directed_adjacency_list_with_in_edge_index() {
+        for (const auto id : constants::vertex_id_view)
+            vertices.emplace_back(id);
+    }
+
+    const edge_type& add_edge(const lib_t::id_type first_id, const lib_t::id_type second_id) {
+        return sut.add_edge(
+            lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id])
+        );
+    }
+
+    void init_complete_graph() {
+        for (const auto first_id : constants::vertex_id_view)
+            for (const auto second_id : constants::vertex_id_view)
+                add_edge(first_id, second_id);
+    }
+
+    // the in-edge lists should always be consistent with the adjacency lists
+    void check_in_edges() {
+        std::vector<lib_t::size_type> expected_in_degree_map(sut.n_vertices(), constants::zero);
+        for (lib_t::id_type vertex_id = constants::vertex_id_1; vertex_id < sut.n_vertices();
+             ++vertex_id) {
+            for (const auto& edge : sut.adjacent_edges(vertex_id)) {
+                ++expected_in_degree_map[edge.second_id()];
+
+                const auto in_edges = sut.in_edges(edge.second_id());
+                CHECK_NE(
+                    std::ranges::find(
+                        in_edges, &edge, transforms::address_projection<edge_type>{}
+                    ),
+                    in_edges.end()
+                );
+            }
+        }
+
+        CHECK_EQ(sut.in_degree_map(), expected_in_degree_map);
+        for (lib_t::id_type vertex_id = constants::vertex_id_1; vertex_id < sut.n_vertices();
+             ++vertex_id) {
+            CHECK_EQ(sut.in_degree(vertex_id), expected_in_degree_map[vertex_id]);
+            CHECK_EQ(sut.in_edges(vertex_id).distance(), expected_in_degree_map[vertex_id]);
+            CHECK_EQ(
+                sut.degree(vertex_id), expected_in_degree_map[vertex_id] + sut.out_degree(vertex_id)
+            );
+        }
+    }
+
+    sut_type sut{constants::n_elements};
+    std::vector<vertex_type> vertices;
+};
+
+TEST_CASE_FIXTURE(
+    test_directed_adjacency_list_with_in_edge_index,
+    "add_edge and add_edges_from should add the edges to the in-edge lists of their targets"
+) {
+    add_edge(constants::vertex_id_1, constants::vertex_id_2);
+    add_edge(constants::vertex_id_2, constants::vertex_id_2);
+
+    std::vector<edge_ptr_type> new_edges;
+    for (const auto target_id : constants::vertex_id_view)
+        new_edges.push_back(lib::detail::make_edge<edge_type>(
+            vertices[constants::vertex_id_3], vertices[target_id]
+        ));
+    sut.add_edges_from(constants::vertex_id_3, std::move(new_edges));
+
+    REQUIRE_EQ(sut.in_degree(constants::vertex_id_2), constants::three);
+    check_in_edges();
+}
+
+TEST_CASE_FIXTURE(
+    test_directed_adjacency_list_with_in_edge_index,
+    "remove_edge should remove the edge from the in-edge list of its target"
+) {
+    init_complete_graph();
+
+    const auto& edge = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2)->get();
+    sut.remove_edge(edge);
+
+    const auto& loop = sut.get_edge(constants::vertex_id_3, constants::vertex_id_3)->get();
+    sut.remove_edge(loop);
+
+    CHECK_EQ(sut.in_degree(constants::vertex_id_2), constants::n_elements - constants::one);
+    CHECK_EQ(sut.in_degree(constants::vertex_id_3), constants::n_elements - constants::one);
+    check_in_edges();
+}
+
+TEST_CASE_FIXTURE(
+    test_directed_adjacency_list_with_in_edge_index,
+    "remove_vertex should remove all edges incident with the vertex from the in-edge lists"
+) {
+    init_complete_graph();
+
+    sut.remove_vertex(vertices[constants::vertex_id_2]);
+
+    constexpr auto n_vertices_after_remove = constants::n_elements - constants::one_element;
+    REQUIRE_EQ(sut.n_vertices(), n_vertices_after_remove);
+    REQUIRE_EQ(sut.n_unique_edges(), n_vertices_after_remove * n_vertices_after_remove);
+
+    // the vertex ids are not updated by the implementation itself
+    for (const auto vertex_id :
+         constants::vertex_id_view | std::views::take(n_vertices_after_remove)) {
+        CHECK_EQ(sut.in_degree(vertex_id), n_vertices_after_remove);
+        CHECK_FALSE(std::ranges::any_of(sut.in_edges(vertex_id), [this](const auto& edge) {
+            return edge.is_incident_with(vertices[constants::vertex_id_2]);
+        }));
+    }
+}
+
 struct test_undirected_adjacency_list {
     using vertex_type = lib::vertex_descriptor<>;
     using edge_type = lib::undirected_edge<vertex_type>;
@@ -740,7 +857,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements + 1;
 
-    std::vector<lib_t::id_type> degree_map;
+    std::vector<lib_t::size_type> degree_map;
 
     SUBCASE("in_degree") {
         degree_map = sut.in_degree_map();
@@ -786,6 +903,103 @@ TEST_CASE_FIXTURE(
     }
 }
 
+TEST_CASE_TEMPLATE_DEFINE(
+    "edge removal with the edge position index should keep the remaining edges valid",
+    TraitsType,
+    edge_position_index_traits_template
+) {
+    using sut_type = lib_i::adjacency_list<TraitsType>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+
+    constexpr lib_t::size_type n_vertices = 10ull;
+    constexpr lib_t::id_type last_id = n_vertices - constants::one_element;
+
+    std::vector<vertex_type> vertices;
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices; ++id)
+        vertices.emplace_back(id);
+
+    sut_type sut{n_vertices};
+    std::vector<const edge_type*> edges;
+    for (const auto& first : vertices)
+        for (const auto& second : vertices)
+            if (lib::type_traits::is_directed_v<edge_type> or first.id() <= second.id())
+                edges.push_back(&sut.add_edge(lib::detail::make_edge<edge_type>(first, second)));
+
+    // the adjacency lists should contain exactly the remaining edges
+    const auto check_remaining_edges = [&sut, &edges]() {
+        REQUIRE_EQ(sut.n_unique_edges(), edges.size());
+
+        for (const auto* edge : edges) {
+            CHECK(sut.has_edge(*edge));
+            CHECK_EQ(&sut.get_edge(edge->first_id(), edge->second_id())->get(), edge);
+        }
+
+        for (lib_t::id_type id = lib::constants::initial_id; id < sut.n_vertices(); ++id) {
+            for (const auto& edge : sut.adjacent_edges(id))
+                CHECK_NE(std::ranges::find(edges, &edge), edges.end());
+            CHECK_EQ(
+                sut.adjacent_edges(id).distance(),
+                std::ranges::count_if(
+                    edges,
+                    [id](const auto* edge) {
+                        return edge->first_id() == id
+                            or (lib::type_traits::is_undirected_v<edge_type>
+                                and edge->second_id() == id);
+                    }
+                )
+            );
+        }
+    };
+
+    const auto remove_edge = [&sut, &edges](const lib_t::size_type idx) {
+        const auto* edge = edges[idx];
+        edges.erase(edges.begin() + static_cast<std::ptrdiff_t>(idx));
+        sut.remove_edge(*edge);
+    };
+
+    // remove the edges from the middle of the adjacency lists
+    for (lib_t::size_type idx = constants::first_element_idx; idx < edges.size(); ++idx)
+        remove_edge(idx);
+    check_remaining_edges();
+
+    // remove the last vertex so that the ids of the remaining vertices do not change
+    std::erase_if(edges, [&vertices](const auto* edge) {
+        return edge->is_incident_with(vertices[last_id]);
+    });
+    sut.remove_vertex(vertices[last_id]);
+    check_remaining_edges();
+
+    // remove the edges from the back of the adjacency lists
+    while (not edges.empty())
+        remove_edge(edges.size() - constants::one_element);
+    check_remaining_edges();
+
+    auto edge = lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_1], vertices[constants::vertex_id_2]
+    );
+    CHECK_FALSE(sut.has_edge(*edge));
+    CHECK_THROWS_AS(sut.remove_edge(*edge), std::invalid_argument);
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    edge_position_index_traits_template,
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::edge_position_index_t>>, // directed adj list
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<
+            lib_i::in_edge_index_t,
+            lib_i::edge_position_index_t>>, // directed adj list with the in-edge index
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::edge_position_index_t>> // undirected adj list
+);
+
 TEST_SUITE_END(); // test_adjacency_list
 
 } // namespace gl_testing
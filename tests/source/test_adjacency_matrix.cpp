@@ -56,6 +56,47 @@ TEST_CASE_TEMPLATE_DEFINE(
         CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
     }
 
+    SUBCASE("the capacity should be doubled when exceeded and the edges should be preserved") {
+        using vertex_type = typename SutType::vertex_type;
+        using edge_type = typename SutType::edge_type;
+
+        constexpr lib_t::size_type n_vertices = constants::n_elements * constants::two;
+        std::vector<vertex_type> vertices;
+        for (lib_t::id_type id = lib::constants::initial_id; id <= n_vertices; ++id)
+            vertices.emplace_back(id);
+
+        SutType sut{constants::n_elements};
+        const auto& edge = sut.add_edge(lib::detail::make_edge<edge_type>(
+            vertices[constants::vertex_id_1], vertices[constants::vertex_id_3]
+        ));
+
+        sut.add_vertex();
+        CHECK_EQ(sut.capacity(), n_vertices);
+        sut.add_vertices(constants::n_elements - constants::one_element);
+        CHECK_EQ(sut.capacity(), n_vertices);
+        sut.add_vertex();
+        CHECK_EQ(sut.capacity(), n_vertices * constants::two);
+
+        REQUIRE_EQ(sut.n_vertices(), n_vertices + constants::one_element);
+        CHECK_EQ(&sut.get_edge(constants::vertex_id_1, constants::vertex_id_3)->get(), &edge);
+        for (lib_t::id_type id = constants::n_elements; id < sut.n_vertices(); ++id) {
+            CHECK_EQ(sut.adjacent_edges(id).distance(), constants::zero_elements);
+            CHECK_FALSE(sut.has_edge(constants::vertex_id_1, id));
+        }
+
+        // the cells released by vertex removal should be empty when the vertices are added again
+        sut.add_edge(lib::detail::make_edge<edge_type>(
+            vertices[constants::vertex_id_1], vertices[n_vertices]
+        ));
+        sut.remove_vertex(vertices[constants::vertex_id_2]);
+        sut.add_vertex();
+
+        CHECK_EQ(sut.n_unique_edges(), constants::two);
+        CHECK_EQ(&sut.get_edge(constants::vertex_id_1, constants::vertex_id_2)->get(), &edge);
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, n_vertices));
+        CHECK_EQ(sut.adjacent_edges(n_vertices).distance(), constants::zero_elements);
+    }
+
     SUBCASE("add_edge should throw an error if the vertices are already incident") {
         using vertex_type = typename SutType::vertex_type;
         using edge_type = typename SutType::edge_type;
@@ -71,6 +112,41 @@ TEST_CASE_TEMPLATE_DEFINE(
         CHECK_THROWS_AS(sut.add_edge(lib::detail::make_edge<edge_type>(v1, v2)), std::logic_error);
     }
 
+    SUBCASE("add_edges should throw an error if the new edges are duplicated") {
+        using vertex_type = typename SutType::vertex_type;
+        using edge_type = typename SutType::edge_type;
+        using edge_ptr_type = typename SutType::edge_ptr_type;
+
+        SutType sut{constants::n_elements};
+
+        const vertex_type v1{constants::vertex_id_1};
+        const vertex_type v2{constants::vertex_id_2};
+
+        std::vector<edge_ptr_type> duplicate_edges;
+        duplicate_edges.push_back(lib::detail::make_edge<edge_type>(v1, v2));
+        duplicate_edges.push_back(lib::detail::make_edge<edge_type>(v1, v2));
+
+        CHECK_THROWS_AS(sut.add_edges(std::move(duplicate_edges)), std::logic_error);
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+        // the reversed edge is a duplicate only in undirected graphs
+        std::vector<edge_ptr_type> reversed_edges;
+        reversed_edges.push_back(lib::detail::make_edge<edge_type>(v1, v2));
+        reversed_edges.push_back(lib::detail::make_edge<edge_type>(v2, v1));
+
+        if constexpr (lib::type_traits::is_undirected_v<edge_type>) {
+            CHECK_THROWS_AS(sut.add_edges(std::move(reversed_edges)), std::logic_error);
+            CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+            CHECK_EQ(sut.degree(constants::vertex_id_1), constants::zero);
+        }
+        else {
+            sut.add_edges(std::move(reversed_edges));
+            CHECK_EQ(sut.n_unique_edges(), constants::two);
+            CHECK_EQ(sut.out_degree(constants::vertex_id_1), constants::one);
+        }
+    }
+
     SUBCASE("add_edges_from should throw an error if the vertices are already incident") {
         using vertex_type = typename SutType::vertex_type;
         using edge_type = typename SutType::edge_type;
@@ -189,6 +265,19 @@ TEST_CASE_FIXTURE(
     CHECK_FALSE(sut.has_edge(constants::vertex_id_2, constants::vertex_id_3));
 }
 
+TEST_CASE_FIXTURE(
+    test_directed_adjacency_matrix,
+    "has_edge(id, id) should return false if any of the vertex ids is out of range"
+) {
+    // the cell of the loop of the middle vertex would be aliased by the out of range ids
+    add_edge(constants::vertex_id_2, constants::vertex_id_2);
+
+    const auto out_of_range_id = static_cast<lib_t::id_type>(constants::n_elements + 1ull);
+    CHECK(sut.has_edge(constants::vertex_id_2, constants::vertex_id_2));
+    CHECK_FALSE(sut.has_edge(constants::vertex_id_1, out_of_range_id));
+    CHECK_FALSE(sut.has_edge(out_of_range_id, constants::vertex_id_1));
+}
+
 TEST_CASE_FIXTURE(
     test_directed_adjacency_matrix,
     "has_edge(edge_ptr) should return true if the given edge is present in the graph"
@@ -359,7 +448,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements;
 
-    std::vector<lib_t::id_type> degree_map;
+    std::vector<lib_t::size_type> degree_map;
 
     SUBCASE("in_degree") {
         degree_map = sut.in_degree_map();
@@ -383,7 +472,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements * constants::two;
 
-    std::vector<lib_t::id_type> degree_map = sut.degree_map();
+    std::vector<lib_t::size_type> degree_map = sut.degree_map();
 
     REQUIRE_EQ(degree_map.size(), constants::n_elements);
     CHECK_EQ(std::ranges::count(degree_map, expected_deg), constants::n_elements);
@@ -679,7 +768,7 @@ TEST_CASE_FIXTURE(
     init_complete_graph(false);
     const auto expected_deg = constants::n_elements + 1;
 
-    std::vector<lib_t::id_type> degree_map;
+    std::vector<lib_t::size_type> degree_map;
 
     SUBCASE("in_degree") {
         degree_map = sut.in_degree_map();
@@ -0,0 +1,266 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/graph.hpp>
+#include <gl/impl/adjacency_sparse_matrix.hpp>
+
+#include <doctest.h>
+
+#include <algorithm>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_adjacency_sparse_matrix");
+
+namespace {
+
+// large enough for a dense matrix to be noticeably wasteful
+constexpr lib_t::size_type n_vertices_sparse = 1'000ull;
+
+} // namespace
+
+TEST_CASE("sparse matrix graphs should use the sparse matrix representation") {
+    using plain_traits_type = lib::sparse_matrix_graph_traits<lib::directed_t>;
+    using edge_properties_traits_type = lib::
+        sparse_matrix_graph_traits<lib::undirected_t, lib_t::empty_properties, types::used_property>;
+
+    CHECK(std::same_as<
+          typename lib::graph<plain_traits_type>::implementation_type,
+          lib_i::adjacency_sparse_matrix<plain_traits_type>>);
+    CHECK(std::same_as<
+          typename lib::graph<edge_properties_traits_type>::implementation_type,
+          lib_i::adjacency_sparse_matrix<edge_properties_traits_type>>);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "directional_tag-independent tests", EdgeDirectionalTag, edge_directional_tag_template
+) {
+    using traits_type = lib::sparse_matrix_graph_traits<EdgeDirectionalTag>;
+    using sut_type = lib_i::adjacency_sparse_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+    using edge_ptr_type = typename sut_type::edge_ptr_type;
+
+    std::vector<vertex_type> vertices;
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_sparse; ++id)
+        vertices.emplace_back(id);
+
+    const auto make_edge = [&vertices](
+                               const lib_t::id_type first_id, const lib_t::id_type second_id
+                           ) {
+        return lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id]);
+    };
+
+    sut_type sut{n_vertices_sparse};
+    const auto last_id = n_vertices_sparse - constants::one_element;
+
+    SUBCASE("add_edge should return the given edge and index its cell") {
+        auto edge = make_edge(constants::vertex_id_1, last_id);
+        const auto* edge_addr = edge.get();
+
+        const auto& added_edge = sut.add_edge(std::move(edge));
+        CHECK_EQ(&added_edge, edge_addr);
+        CHECK_EQ(sut.n_unique_edges(), constants::one_element);
+        CHECK(sut.has_edge(constants::vertex_id_1, last_id));
+        CHECK(sut.has_edge(added_edge));
+        CHECK_EQ(
+            sut.has_edge(last_id, constants::vertex_id_1),
+            lib::type_traits::is_undirected_v<edge_type>
+        );
+
+        const auto edge_ref = sut.get_edge(constants::vertex_id_1, last_id);
+        REQUIRE(edge_ref.has_value());
+        CHECK_EQ(&edge_ref->get(), edge_addr);
+
+        CHECK_THROWS_AS(sut.add_edge(make_edge(constants::vertex_id_1, last_id)), std::logic_error);
+    }
+
+    SUBCASE("add_edges_from should add all edges or none of them if any edge is duplicated") {
+        std::vector<edge_ptr_type> new_edges;
+        for (lib_t::id_type id = constants::vertex_id_2; id < n_vertices_sparse;
+             id += constants::two)
+            new_edges.push_back(make_edge(constants::vertex_id_1, id));
+        const auto n_new_edges = new_edges.size();
+
+        std::vector<edge_ptr_type> duplicated_edges;
+        duplicated_edges.push_back(make_edge(constants::vertex_id_1, constants::vertex_id_3));
+        duplicated_edges.push_back(make_edge(constants::vertex_id_1, constants::vertex_id_3));
+        CHECK_THROWS_AS(
+            sut.add_edges_from(constants::vertex_id_1, std::move(duplicated_edges)),
+            std::logic_error
+        );
+        CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+
+        sut.add_edges_from(constants::vertex_id_1, std::move(new_edges));
+        REQUIRE_EQ(sut.n_unique_edges(), n_new_edges);
+        REQUIRE_EQ(sut.out_degree(constants::vertex_id_1), n_new_edges);
+
+        const auto adjacent_edges = sut.adjacent_edges(constants::vertex_id_1);
+        REQUIRE_EQ(adjacent_edges.distance(), n_new_edges);
+        for (const auto& edge : adjacent_edges) {
+            CHECK(sut.has_edge(edge));
+            CHECK_EQ(&sut.get_edge(edge.first_id(), edge.second_id())->get(), &edge);
+        }
+    }
+
+    SUBCASE("remove_edge should keep the cells of the remaining edges valid") {
+        std::vector<edge_ptr_type> new_edges;
+        for (const auto id : constants::vertex_id_view)
+            new_edges.push_back(make_edge(constants::vertex_id_1, id));
+        new_edges.push_back(make_edge(constants::vertex_id_2, constants::vertex_id_3));
+        sut.add_edges(std::move(new_edges));
+
+        const auto not_added_edge = make_edge(constants::vertex_id_1, constants::vertex_id_2);
+        CHECK_FALSE(sut.has_edge(*not_added_edge));
+        CHECK_THROWS_AS(sut.remove_edge(*not_added_edge), std::invalid_argument);
+
+        sut.remove_edge(sut.get_edge(constants::vertex_id_1, constants::vertex_id_1)->get());
+        sut.remove_edge(sut.get_edge(constants::vertex_id_1, constants::vertex_id_2)->get());
+
+        CHECK_EQ(sut.n_unique_edges(), constants::two);
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_1));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_2, constants::vertex_id_1));
+
+        for (lib_t::id_type id = lib::constants::initial_id; id < constants::n_elements; ++id)
+            for (const auto& edge : sut.adjacent_edges(id)) {
+                CHECK(sut.has_edge(edge));
+                CHECK_EQ(&sut.get_edge(edge.first_id(), edge.second_id())->get(), &edge);
+            }
+    }
+
+    SUBCASE("remove_vertex should shift the cells of the following vertices") {
+        const auto removed_id = constants::vertex_id_2;
+
+        sut.add_edge(make_edge(constants::vertex_id_1, removed_id));
+        sut.add_edge(make_edge(removed_id, last_id));
+        const auto& kept_edge = sut.add_edge(make_edge(constants::vertex_id_1, last_id));
+        sut.add_edge(make_edge(last_id, last_id));
+
+        sut.remove_vertex(vertices[removed_id]);
+
+        const auto new_last_id = last_id - constants::one_element;
+        REQUIRE_EQ(sut.n_vertices(), n_vertices_sparse - constants::one_element);
+        CHECK_EQ(sut.n_unique_edges(), constants::two);
+        CHECK(sut.has_edge(constants::vertex_id_1, new_last_id));
+        CHECK(sut.has_edge(new_last_id, new_last_id));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, removed_id));
+        CHECK_FALSE(sut.has_edge(removed_id, new_last_id));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, last_id));
+
+        CHECK_EQ(&sut.get_edge(constants::vertex_id_1, new_last_id)->get(), &kept_edge);
+    }
+
+    SUBCASE("has_edge(id, id) and get_edge(id, id) should return false/nullopt if either id is "
+            "invalid") {
+        CHECK_FALSE(sut.has_edge(n_vertices_sparse, constants::vertex_id_1));
+        CHECK_FALSE(sut.has_edge(constants::vertex_id_1, n_vertices_sparse));
+        CHECK_FALSE(sut.get_edge(n_vertices_sparse, constants::vertex_id_1));
+        CHECK_FALSE(sut.get_edge(constants::vertex_id_1, n_vertices_sparse));
+    }
+
+    SUBCASE("the degree maps should be consistent with the single vertex degrees") {
+        for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_sparse;
+             id += constants::three)
+            sut.add_edge(make_edge(id, (id * constants::two) % n_vertices_sparse));
+
+        const auto in_degree_map = sut.in_degree_map();
+        const auto out_degree_map = sut.out_degree_map();
+        const auto degree_map = sut.degree_map();
+        for (lib_t::id_type id = lib::constants::initial_id; id < n_vertices_sparse; ++id) {
+            CHECK_EQ(in_degree_map[id], sut.in_degree(id));
+            CHECK_EQ(out_degree_map[id], sut.out_degree(id));
+            CHECK_EQ(degree_map[id], sut.degree(id));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    edge_directional_tag_template,
+    lib::directed_t, // directed adj sparse matrix
+    lib::undirected_t // undirected adj sparse matrix
+);
+
+TEST_CASE("degrees of the undirected adjacency sparse matrix should count the loops twice") {
+    using traits_type = lib::sparse_matrix_graph_traits<lib::undirected_t>;
+    using sut_type = lib_i::adjacency_sparse_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    sut_type sut{constants::n_elements};
+    sut.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_1]
+    ));
+    sut.add_edge(lib::detail::make_edge<edge_type>(
+        vertices[constants::vertex_id_2], vertices[constants::vertex_id_2]
+    ));
+
+    CHECK_EQ(sut.n_unique_edges(), constants::two);
+    CHECK_EQ(sut.degree(constants::vertex_id_1), constants::one);
+    CHECK_EQ(sut.degree(constants::vertex_id_2), constants::three);
+    CHECK_EQ(sut.degree(constants::vertex_id_3), constants::zero);
+    CHECK(std::ranges::equal(
+        sut.degree_map(),
+        std::vector<lib_t::size_type>{constants::one, constants::three, constants::zero}
+    ));
+
+    const auto edge_1_2 = sut.get_edge(constants::vertex_id_1, constants::vertex_id_2);
+    const auto edge_2_1 = sut.get_edge(constants::vertex_id_2, constants::vertex_id_1);
+    REQUIRE(edge_1_2.has_value());
+    REQUIRE(edge_2_1.has_value());
+    CHECK_EQ(&edge_1_2->get(), &edge_2_1->get());
+
+    sut.remove_vertex(vertices[constants::vertex_id_1]);
+    CHECK_EQ(sut.n_unique_edges(), constants::one);
+    CHECK(sut.has_edge(constants::vertex_id_1, constants::vertex_id_1));
+    CHECK_EQ(sut.degree(constants::vertex_id_1), constants::two);
+}
+
+TEST_CASE("in-degrees of the directed adjacency sparse matrix should follow the edge changes") {
+    using traits_type = lib::sparse_matrix_graph_traits<lib::directed_t>;
+    using sut_type = lib_i::adjacency_sparse_matrix<traits_type>;
+    using vertex_type = typename sut_type::vertex_type;
+    using edge_type = typename sut_type::edge_type;
+
+    std::vector<vertex_type> vertices;
+    for (const auto id : constants::vertex_id_view)
+        vertices.emplace_back(id);
+
+    const auto make_edge = [&vertices](
+                               const lib_t::id_type first_id, const lib_t::id_type second_id
+                           ) {
+        return lib::detail::make_edge<edge_type>(vertices[first_id], vertices[second_id]);
+    };
+
+    sut_type sut{constants::n_elements};
+    sut.add_edge(make_edge(constants::vertex_id_1, constants::vertex_id_3));
+    sut.add_edge(make_edge(constants::vertex_id_2, constants::vertex_id_3));
+    const auto& removed_edge =
+        sut.add_edge(make_edge(constants::vertex_id_3, constants::vertex_id_2));
+
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{constants::zero, constants::one, constants::two}
+    ));
+
+    sut.remove_edge(removed_edge);
+    CHECK_EQ(sut.in_degree(constants::vertex_id_2), constants::zero);
+
+    sut.add_vertex();
+    CHECK_EQ(sut.in_degree(constants::n_elements), constants::zero);
+
+    // the vertex ids are shifted after the removal of the first vertex
+    sut.remove_vertex(vertices[constants::vertex_id_1]);
+    CHECK(std::ranges::equal(
+        sut.in_degree_map(),
+        std::vector<lib_t::size_type>{constants::zero, constants::one, constants::zero}
+    ));
+}
+
+TEST_SUITE_END(); // test_adjacency_sparse_matrix
+
+} // namespace gl_testing
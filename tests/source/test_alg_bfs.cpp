@@ -176,6 +176,68 @@ TEST_CASE_TEMPLATE_INSTANTIATE(
     lib::graph<lib::matrix_graph_traits<lib::undirected_t>> // undirected adjacency matrix
 );
 
+TEST_CASE_TEMPLATE_DEFINE(
+    "breadth_first_search should produce the same results for a frozen graph",
+    GraphType,
+    bfs_frozen_graph_template
+) {
+    using graph_type = GraphType;
+    using frozen_graph_type = typename graph_type::frozen_graph_type;
+
+    const auto graph = lib::topology::regular_binary_tree<graph_type>(constants::three);
+    const auto frozen_graph = graph.freeze();
+
+    const auto pd =
+        lib::algorithm::breadth_first_search<lib::algorithm::default_return, graph_type>(graph);
+    const auto frozen_pd = lib::algorithm::
+        breadth_first_search<lib::algorithm::default_return, frozen_graph_type>(frozen_graph);
+
+    REQUIRE_EQ(frozen_pd.predecessors.size(), frozen_graph.n_vertices());
+    CHECK(std::ranges::equal(frozen_pd.predecessors, pd.predecessors));
+    CHECK(std::ranges::all_of(
+        frozen_graph.vertex_ids(), alg_common::has_correct_bin_predecessor(frozen_pd)
+    ));
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    bfs_frozen_graph_template,
+    lib::graph<lib::list_graph_traits<lib::directed_t>>, // directed adjacency list
+    lib::graph<lib::list_graph_traits<lib::undirected_t>>, // undirected adjacency list
+    lib::graph<lib::matrix_graph_traits<lib::directed_t>>, // directed adjacency matrix
+    lib::graph<lib::matrix_graph_traits<lib::undirected_t>> // undirected adjacency matrix
+);
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "breadth_first_search should produce the same results for a compressed graph",
+    GraphType,
+    bfs_compressed_graph_template
+) {
+    using graph_type = GraphType;
+    using compressed_graph_type = typename graph_type::compressed_graph_type;
+
+    const auto graph = lib::topology::regular_binary_tree<graph_type>(constants::three);
+    const auto compressed_graph = graph.compress();
+
+    const auto pd =
+        lib::algorithm::breadth_first_search<lib::algorithm::default_return, graph_type>(graph);
+    const auto compressed_pd =
+        lib::algorithm::breadth_first_search<lib::algorithm::default_return, compressed_graph_type>(
+            compressed_graph
+        );
+
+    REQUIRE_EQ(compressed_pd.predecessors.size(), compressed_graph.n_vertices());
+    CHECK(std::ranges::equal(compressed_pd.predecessors, pd.predecessors));
+    CHECK(std::ranges::all_of(
+        compressed_graph.vertex_ids(), alg_common::has_correct_bin_predecessor(compressed_pd)
+    ));
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    bfs_compressed_graph_template,
+    lib::graph<lib::list_graph_traits<lib::directed_t>>, // directed adjacency list
+    lib::graph<lib::list_graph_traits<lib::undirected_t>> // undirected adjacency list
+);
+
 TEST_SUITE_END(); // test_alg_bfs
 
 } // namespace gl_testing
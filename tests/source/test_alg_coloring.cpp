@@ -111,7 +111,7 @@ TEST_CASE_TEMPLATE_DEFINE("bipartite coloring tests", TraitsType, traits_type_te
             sut.vertices(),
             expected_coloring,
             std::ranges::equal_to{},
-            [](const auto& vertex) { return vertex.properties.color; }
+            [](const auto& vertex) { return lib::get_properties<sut_type>(vertex).color; }
         ));
     }
 
@@ -172,7 +172,13 @@ TEST_CASE_TEMPLATE_INSTANTIATE(
         lib_t::binary_color_property>, // directed adjacency matrix graph
     lib::matrix_graph_traits<
         lib::undirected_t,
-        lib_t::binary_color_property> // undirected adjacency matrix graph
+        lib_t::binary_color_property>, // undirected adjacency matrix graph
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::columnar<lib_t::binary_color_property>>, // directed list graph (columnar)
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::columnar<lib_t::binary_color_property>> // undirected list graph (columnar)
 );
 
 TEST_SUITE_END(); // test_alg_coloring
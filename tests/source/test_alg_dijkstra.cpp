@@ -144,6 +144,58 @@ TEST_CASE_TEMPLATE_INSTANTIATE(
         lib_t::weight_property<>> // undirected adjacency matrix graph
 );
 
+TEST_CASE_TEMPLATE_DEFINE(
+    "dijkstra shortest path finding tests for frozen graphs with weighted edges",
+    EdgeDirectionalTag,
+    frozen_weighted_edge_directional_tag_template
+) {
+    using source_type = lib::graph<lib::list_graph_traits<
+        EdgeDirectionalTag,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>>;
+    using sut_type = typename source_type::frozen_graph_type;
+    using weight_type = typename sut_type::edge_properties_type::weight_type;
+
+    static_assert(lib_tt::c_weight_column_graph_view<sut_type>);
+
+    SUBCASE("should throw if there is an edge with a negative weight") {
+        auto source = lib::topology::clique<source_type>(constants::n_elements_alg);
+        source.get_edge(constants::vertex_id_1, constants::vertex_id_2)
+            .value()
+            .get()
+            .properties.weight = -static_cast<weight_type>(constants::n_elements_alg);
+
+        const auto sut = source.freeze();
+
+        CHECK_THROWS_AS(
+            func::discard_result(
+                lib::algorithm::dijkstra_shortest_paths(sut, constants::vertex_id_1)
+            ),
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("should return the same paths descriptor as for the source graph") {
+        const std::string file_name_prefix =
+            lib_tt::is_directed_v<sut_type> ? "dijkstra_directed_" : "dijkstra_undirected_";
+        const fs::path gsf_file_path = alg_common::data_path / (file_name_prefix + "graph.gsf");
+
+        const auto source = lib::io::load<source_type>(gsf_file_path);
+        const auto sut = source.freeze();
+        const lib_t::id_type source_id = constants::first_element_idx;
+
+        const auto expected_paths = lib::algorithm::dijkstra_shortest_paths(source, source_id);
+        const auto paths = lib::algorithm::dijkstra_shortest_paths(sut, source_id);
+
+        CHECK_EQ(paths.predecessors, expected_paths.predecessors);
+        CHECK_EQ(paths.distances, expected_paths.distances);
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    frozen_weighted_edge_directional_tag_template, lib::directed_t, lib::undirected_t
+);
+
 TEST_CASE_TEMPLATE_DEFINE(
     "dijkstra shortest path finding tests for graphs with unweighted edges",
     TraitsType,
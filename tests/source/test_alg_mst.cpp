@@ -149,7 +149,8 @@ TEST_CASE_TEMPLATE_DEFINE(
 TEST_CASE_TEMPLATE_INSTANTIATE(
     edge_heap_prim_unwieghted_edge_traits_type_template,
     lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list graph
-    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix graph
+    lib::matrix_graph_traits<lib::undirected_t>, // undirected adjacency matrix graph
+    lib::bit_matrix_graph_traits<lib::undirected_t> // undirected adjacency bit matrix graph
 );
 
 TEST_CASE_TEMPLATE_DEFINE(
@@ -287,9 +288,50 @@ TEST_CASE_TEMPLATE_DEFINE(
 TEST_CASE_TEMPLATE_INSTANTIATE(
     vertex_heap_prim_unwieghted_edge_traits_type_template,
     lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list graph
-    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix graph
+    lib::matrix_graph_traits<lib::undirected_t>, // undirected adjacency matrix graph
+    lib::bit_matrix_graph_traits<lib::undirected_t> // undirected adjacency bit matrix graph
 );
 
+TEST_CASE("prim mst algorithms should find the same mst for a frozen graph with weighted edges") {
+    using source_type = lib::graph<lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::weight_property<>,
+        lib_i::list_t>>;
+    using sut_type = typename source_type::frozen_graph_type;
+
+    static_assert(lib_tt::c_weight_column_graph_view<sut_type>);
+
+    const auto source = lib::io::load<source_type>(alg_common::data_path / "mst_graph.gsf");
+    const auto sut = source.freeze();
+    const lib_t::id_type source_id = constants::first_element_idx;
+
+    const auto expected_weight =
+        alg_common::load_list<typename sut_type::edge_properties_type::weight_type>(
+            constants::one, alg_common::data_path / "mst_weight.txt"
+        )
+            .front();
+
+    const auto edge_ids = [](const auto& mst) {
+        std::vector<std::pair<lib_t::id_type, lib_t::id_type>> ids;
+        for (const auto& edge_ref : mst.edges)
+            ids.emplace_back(edge_ref.get().first_id(), edge_ref.get().second_id());
+        return ids;
+    };
+
+    const auto edge_heap_mst = lib::algorithm::edge_heap_prim_mst(sut, source_id);
+    CHECK_EQ(edge_heap_mst.weight, expected_weight);
+    CHECK_EQ(edge_heap_mst.edges.size(), sut.n_vertices() - constants::one);
+    CHECK_EQ(
+        edge_ids(edge_heap_mst), edge_ids(lib::algorithm::edge_heap_prim_mst(source, source_id))
+    );
+
+    const auto vertex_heap_mst = lib::algorithm::vertex_heap_prim_mst(sut, source_id);
+    CHECK_EQ(vertex_heap_mst.weight, expected_weight);
+    CHECK_EQ(
+        edge_ids(vertex_heap_mst), edge_ids(lib::algorithm::vertex_heap_prim_mst(source, source_id))
+    );
+}
+
 TEST_SUITE_END(); // test_alg_mst
 
 } // namespace gl_testing
@@ -66,6 +66,11 @@ TEST_CASE_TEMPLATE_DEFINE(
 
         REQUIRE(topological_order_opt.has_value());
         CHECK(std::ranges::equal(topological_order_opt.value(), expected_topological_order));
+
+        const auto frozen_topological_order_opt = lib::algorithm::topological_sort(sut.freeze());
+        REQUIRE(frozen_topological_order_opt.has_value());
+        CHECK(std::ranges::equal(frozen_topological_order_opt.value(), expected_topological_order)
+        );
     }
 
     SUBCASE("not acyclic graph") {
@@ -89,6 +94,7 @@ TEST_CASE_TEMPLATE_DEFINE(
 
         const auto topological_order_opt = lib::algorithm::topological_sort(sut);
         CHECK_FALSE(topological_order_opt.has_value());
+        CHECK_FALSE(lib::algorithm::topological_sort(sut.freeze()).has_value());
     }
 }
 
@@ -0,0 +1,151 @@
+#include "constants.hpp"
+#include "functional.hpp"
+
+#include <gl/graph.hpp>
+#include <gl/graph_utility.hpp>
+
+#include <doctest.h>
+
+#include <format>
+#include <sstream>
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_columnar_properties");
+
+namespace {
+
+[[nodiscard]] std::string vertex_name(const lib_t::id_type vertex_id) {
+    return std::format("v{}", vertex_id);
+}
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with columnar vertex properties tests", TraitsType, columnar_traits_type_template
+) {
+    using sut_type = lib::graph<TraitsType>;
+    using properties_type = lib_t::name_property;
+
+    static_assert(sut_type::has_vertex_property_column);
+    static_assert(std::same_as<typename sut_type::vertex_properties_type, properties_type>);
+    static_assert(lib_tt::c_column_property_ref<typename sut_type::vertex_type::properties_type>);
+
+    std::vector<properties_type> properties;
+    for (const auto vertex_id : constants::vertex_id_view)
+        properties.emplace_back(vertex_name(vertex_id));
+
+    sut_type sut;
+    sut.add_vertices_with(properties);
+
+    const auto check_names = [](const auto& graph, const std::vector<std::string>& names) {
+        REQUIRE_EQ(graph.n_vertices(), names.size());
+        REQUIRE_EQ(graph.vertex_property_column().size(), names.size());
+        for (const auto vertex_id : graph.vertex_ids()) {
+            CHECK_EQ(graph.get_vertex(vertex_id).properties->name(), names[vertex_id]);
+            CHECK_EQ(graph.vertex_property_column()[vertex_id].name(), names[vertex_id]);
+        }
+    };
+
+    const std::vector<std::string> names{
+        vertex_name(constants::vertex_id_1),
+        vertex_name(constants::vertex_id_2),
+        vertex_name(constants::vertex_id_3)
+    };
+
+    SUBCASE("the vertex properties should be stored in the property column") {
+        check_names(sut, names);
+
+        const auto column = sut.vertex_property_column();
+        for (const auto& vertex : sut.vertices())
+            CHECK_EQ(&lib::get_properties<sut_type>(vertex), &column[vertex.id()]);
+    }
+
+    SUBCASE("add_vertex should append the properties to the property column") {
+        const auto& vertex = sut.add_vertex(properties_type{"new"});
+        const auto& default_vertex = sut.add_vertex();
+
+        CHECK_EQ(sut.vertex_property_column().size(), constants::n_elements + constants::two);
+        CHECK_EQ(sut.vertex_property_column()[vertex.id()].name(), "new");
+        CHECK(sut.vertex_property_column()[default_vertex.id()].name().empty());
+    }
+
+    SUBCASE("assigning the vertex properties should modify the property column") {
+        const auto& vertex = sut.get_vertex(constants::vertex_id_2);
+
+        vertex.properties = properties_type{"modified"};
+        CHECK_EQ(sut.vertex_property_column()[vertex.id()].name(), "modified");
+
+        // a copy of the properties reference refers to the same element of the column
+        auto properties_ref = vertex.properties;
+        properties_ref = properties_type{"modified again"};
+        CHECK_EQ(vertex.properties->name(), "modified again");
+
+        sut.vertex_property_column()[vertex.id()] = properties_type{"modified in column"};
+        CHECK_EQ(vertex.properties.get().name(), "modified in column");
+    }
+
+    SUBCASE("the vertex properties should stay valid after the graph is moved") {
+        const auto moved = std::move(sut);
+        check_names(moved, names);
+    }
+
+    SUBCASE("removing a vertex should keep the properties aligned with the vertex ids") {
+        sut.remove_vertex(constants::vertex_id_1);
+        check_names(sut, {names[constants::vertex_id_2], names[constants::vertex_id_3]});
+    }
+
+    SUBCASE("compact should keep the properties aligned with the vertex ids") {
+        sut.set_deferred_vertex_removal(true);
+        sut.remove_vertex(constants::vertex_id_2);
+        CHECK_EQ(sut.vertex_property_column().size(), constants::n_elements);
+
+        func::discard_result(sut.compact());
+        check_names(sut, {names[constants::vertex_id_1], names[constants::vertex_id_3]});
+    }
+
+    SUBCASE("clone should copy the property column") {
+        const auto clone = sut.clone();
+        check_names(clone, names);
+
+        clone.get_vertex(constants::vertex_id_1).properties = properties_type{"modified"};
+        CHECK_EQ(sut.get_vertex(constants::vertex_id_1).properties->name(), names.front());
+    }
+
+    SUBCASE("freeze and thaw should preserve the vertex properties") {
+        const auto frozen = sut.freeze();
+        static_assert(std::remove_cvref_t<decltype(frozen)>::has_vertex_property_column);
+
+        for (const auto vertex_id : frozen.vertex_ids())
+            CHECK_EQ(frozen.get_vertex(vertex_id).properties->name(), names[vertex_id]);
+
+        check_names(frozen.thaw(), names);
+    }
+
+    SUBCASE("the vertex properties should be written and read in the gsf format") {
+        std::stringstream ss;
+        ss << lib::io::enable_gsf << lib::io::with_vertex_properties << sut;
+
+        sut_type read_sut;
+        ss >> read_sut;
+        check_names(read_sut, names);
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    columnar_traits_type_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::columnar<lib_t::name_property>>, // directed adjacency list graph
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::columnar<lib_t::name_property>>, // undirected adjacency list graph
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::columnar<lib_t::name_property>> // directed adjacency matrix graph
+);
+
+TEST_SUITE_END(); // test_columnar_properties
+
+} // namespace gl_testing
@@ -0,0 +1,196 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/algorithm/dijkstra.hpp>
+#include <gl/cow_graph.hpp>
+
+#include <doctest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_cow_graph");
+
+namespace {
+
+constexpr lib_t::size_type n_chunks = 3ull;
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE("cow_graph tests", TraitsType, cow_graph_traits_template) {
+    using graph_type = lib::graph<TraitsType>;
+    using sut_type = lib::cow_graph<graph_type>;
+    using id_pair_list = std::vector<lib_t::homogeneous_pair<lib_t::id_type>>;
+
+    static_assert(lib_tt::c_graph_view<sut_type>);
+    static_assert(not lib_tt::c_stable_edge_graph_view<sut_type>);
+
+    // the vertices of the consecutive chunks
+    constexpr lib_t::id_type first_id = constants::vertex_id_1;
+    constexpr lib_t::id_type second_id = first_id + sut_type::chunk_size;
+    constexpr lib_t::id_type third_id = second_id + sut_type::chunk_size;
+
+    graph_type graph{n_chunks * sut_type::chunk_size};
+    graph.add_edge(first_id, second_id);
+    graph.add_edge(second_id, third_id);
+
+    sut_type sut{graph};
+    REQUIRE_FALSE(sut.is_shared());
+
+    const auto adjacent_id_pairs = [](const auto& g, const lib_t::id_type vertex_id) {
+        id_pair_list id_pairs;
+        for (const auto& edge : g.adjacent_edges(vertex_id))
+            id_pairs.push_back(edge.incident_vertex_ids());
+        return id_pairs;
+    };
+
+    SUBCASE("the graph should have the same structure as the source graph") {
+        REQUIRE_EQ(sut.n_vertices(), graph.n_vertices());
+        CHECK_EQ(sut.n_removed_vertices(), constants::zero);
+        CHECK_EQ(sut.n_unique_edges(), graph.n_unique_edges());
+
+        for (const auto vertex_id : graph.vertex_ids()) {
+            CHECK_EQ(sut.get_vertex(vertex_id).id(), vertex_id);
+            CHECK_EQ(adjacent_id_pairs(sut, vertex_id), adjacent_id_pairs(graph, vertex_id));
+        }
+
+        CHECK(sut.has_edge(first_id, second_id));
+        CHECK_EQ(sut.has_edge(second_id, first_id), lib_tt::is_undirected_v<graph_type>);
+        CHECK_FALSE(sut.has_edge(first_id, third_id));
+        CHECK_FALSE(sut.has_edge(first_id, graph.n_vertices()));
+        CHECK_THROWS_AS(sut.get_vertex(graph.n_vertices()), std::out_of_range);
+    }
+
+    SUBCASE("fork should share the whole structure of the graph") {
+        const auto fork = sut.fork();
+
+        CHECK(sut.is_shared());
+        CHECK(fork.is_shared());
+        CHECK(fork.shares_with(sut));
+        for (const auto vertex_id : sut.vertex_ids())
+            CHECK_EQ(&fork.get_vertex(vertex_id), &sut.get_vertex(vertex_id));
+    }
+
+    SUBCASE("a modification should copy only the chunks of the modified vertices") {
+        const auto fork = sut.fork();
+
+        sut.add_edge(first_id, third_id);
+        CHECK_FALSE(sut.is_shared());
+        CHECK_FALSE(fork.is_shared());
+        CHECK_FALSE(fork.shares_with(sut));
+
+        CHECK(sut.has_edge(first_id, third_id));
+        CHECK_EQ(sut.n_unique_edges(), graph.n_unique_edges() + constants::one);
+        CHECK_FALSE(fork.has_edge(first_id, third_id));
+        CHECK_EQ(fork.n_unique_edges(), graph.n_unique_edges());
+
+        CHECK_NE(&sut.get_vertex(first_id), &fork.get_vertex(first_id));
+        CHECK_EQ(&sut.get_vertex(second_id), &fork.get_vertex(second_id));
+        // only the undirected graphs store the edge in the adjacency list of the second vertex
+        if constexpr (lib_tt::is_undirected_v<graph_type>)
+            CHECK_NE(&sut.get_vertex(third_id), &fork.get_vertex(third_id));
+        else
+            CHECK_EQ(&sut.get_vertex(third_id), &fork.get_vertex(third_id));
+    }
+
+    SUBCASE("remove_edge should remove the edge only from the modified graph") {
+        const auto fork = sut.fork();
+
+        sut.remove_edge(first_id, second_id);
+        CHECK_FALSE(sut.has_edge(first_id, second_id));
+        CHECK_FALSE(sut.has_edge(second_id, first_id));
+        CHECK_EQ(sut.n_unique_edges(), constants::one);
+        CHECK_EQ(sut.adjacent_edges(first_id).distance(), constants::zero_elements);
+
+        CHECK(fork.has_edge(first_id, second_id));
+        CHECK_EQ(adjacent_id_pairs(fork, first_id), adjacent_id_pairs(graph, first_id));
+
+        CHECK_THROWS_AS(sut.remove_edge(first_id, second_id), std::invalid_argument);
+        CHECK_THROWS_AS(sut.add_edge(first_id, sut.n_vertices()), std::out_of_range);
+    }
+
+    SUBCASE("add_vertex should add the vertex only to the modified graph") {
+        const auto fork = sut.fork();
+
+        const auto& vertex = sut.add_vertex();
+        const auto vertex_id = vertex.id();
+        REQUIRE_EQ(vertex_id, graph.n_vertices());
+        CHECK_EQ(&sut.get_vertex(vertex_id), &vertex);
+        CHECK_EQ(sut.n_vertices(), graph.n_vertices() + constants::one_element);
+
+        sut.add_edge(vertex_id, first_id);
+        CHECK(sut.has_edge(vertex_id, first_id));
+
+        CHECK_EQ(fork.n_vertices(), graph.n_vertices());
+        CHECK_FALSE(fork.has_vertex(vertex_id));
+    }
+
+    SUBCASE("to_graph should create a graph with the same structure") {
+        sut.add_edge(third_id, third_id);
+        const auto result = sut.to_graph();
+
+        REQUIRE_EQ(result.n_vertices(), sut.n_vertices());
+        CHECK_EQ(result.n_unique_edges(), sut.n_unique_edges());
+        for (const auto vertex_id : sut.vertex_ids())
+            CHECK_EQ(adjacent_id_pairs(result, vertex_id), adjacent_id_pairs(sut, vertex_id));
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    cow_graph_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // directed adjacency list with the in-edge index
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("set_vertex_properties should not modify the vertices of the forks") {
+    using graph_type =
+        lib::graph<lib::list_graph_traits<lib::undirected_t, types::visited_property>>;
+
+    const graph_type graph{constants::n_elements};
+    lib::cow_graph<graph_type> sut{graph};
+    const auto fork = sut.fork();
+
+    sut.set_vertex_properties(constants::vertex_id_2, {true});
+    CHECK(sut.get_vertex(constants::vertex_id_2).properties.visited);
+    CHECK_FALSE(fork.get_vertex(constants::vertex_id_2).properties.visited);
+    CHECK_FALSE(graph.get_vertex(constants::vertex_id_2).properties.visited);
+}
+
+TEST_CASE("dijkstra_shortest_paths should use the edge weights of the given fork") {
+    using weight_type = lib_t::weight_property<int>;
+    using graph_type = lib::graph<
+        lib::list_graph_traits<lib::directed_t, lib_t::empty_properties, weight_type>>;
+
+    constexpr int light_weight = 1;
+    constexpr int heavy_weight = 10;
+
+    graph_type graph{constants::n_elements};
+    graph.add_edge(constants::vertex_id_1, constants::vertex_id_3, {heavy_weight});
+    graph.add_edge(constants::vertex_id_1, constants::vertex_id_2, {light_weight});
+    graph.add_edge(constants::vertex_id_2, constants::vertex_id_3, {light_weight});
+
+    const lib::cow_graph<graph_type> sut{graph};
+    auto fork = sut.fork();
+    fork.set_edge_properties(constants::vertex_id_1, constants::vertex_id_3, {light_weight});
+
+    const auto paths = lib::algorithm::dijkstra_shortest_paths(sut, constants::vertex_id_1);
+    CHECK_EQ(paths.distances[constants::vertex_id_3], 2 * light_weight);
+    CHECK_EQ(paths.predecessors[constants::vertex_id_3], constants::vertex_id_2);
+
+    const auto fork_paths = lib::algorithm::dijkstra_shortest_paths(fork, constants::vertex_id_1);
+    CHECK_EQ(fork_paths.distances[constants::vertex_id_3], light_weight);
+    CHECK_EQ(fork_paths.predecessors[constants::vertex_id_3], constants::vertex_id_1);
+}
+
+TEST_SUITE_END(); // test_cow_graph
+
+} // namespace gl_testing
@@ -1,5 +1,6 @@
 #include "constants.hpp"
 #include "functional.hpp"
+#include "graph_common.hpp"
 #include "transforms.hpp"
 #include "types.hpp"
 
@@ -77,7 +78,8 @@ using add_vertex_property = lib::graph_traits<
     typename TraitsType::edge_directional_tag,
     VertexProperties,
     typename TraitsType::edge_properties_type,
-    typename TraitsType::implementation_tag>;
+    typename TraitsType::implementation_tag,
+    typename TraitsType::storage_tag>;
 
 template <
     lib_tt::c_instantiation_of<lib::graph_traits> TraitsType,
@@ -86,7 +88,8 @@ using add_edge_property = lib::graph_traits<
     typename TraitsType::edge_directional_tag,
     typename TraitsType::vertex_properties_type,
     EdgeProperties,
-    typename TraitsType::implementation_tag>;
+    typename TraitsType::implementation_tag,
+    typename TraitsType::storage_tag>;
 
 using vertex_id_list = std::vector<lib_t::id_type>;
 
@@ -167,6 +170,24 @@ TEST_CASE_TEMPLATE_DEFINE("graph structure tests", TraitsType, graph_traits_temp
         CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
     }
 
+    SUBCASE("adding vertices should throw if the vertex ids would reach the invalid id") {
+        constexpr auto max_n_vertices = static_cast<lib_t::size_type>(lib::constants::invalid_id);
+        sut_type sut{constants::n_elements};
+
+        CHECK_THROWS_AS(
+            sut.add_vertices(max_n_vertices - constants::n_elements + constants::one_element),
+            std::length_error
+        );
+        CHECK_EQ(sut.n_vertices(), constants::n_elements);
+
+        // the number of vertices passed to the constructor can exceed the limit only for
+        // the ids narrower than the size type
+        if constexpr (sizeof(lib_t::id_type) < sizeof(lib_t::size_type))
+            CHECK_THROWS_AS(
+                sut_type{max_n_vertices + constants::one_element}, std::length_error
+            );
+    }
+
     SUBCASE("add_vertices_with should properly extend the current adjacency list with the given "
             "properties") {
         using properties_traits_type = add_vertex_property<traits_type, types::visited_property>;
@@ -364,6 +385,113 @@ TEST_CASE_TEMPLATE_DEFINE("graph structure tests", TraitsType, graph_traits_temp
         ));
     }
 
+    SUBCASE("remove_vertices_from should be equivalent to removing the vertices one by one") {
+        const auto& removed_ids = graph_common::vertex_removal_ids;
+
+        auto sut = graph_common::make_vertex_removal_graph<sut_type>();
+        auto expected = graph_common::make_vertex_removal_graph<sut_type>();
+
+        for (const auto vertex_id : removed_ids | std::views::reverse)
+            expected.remove_vertex(vertex_id);
+        sut.remove_vertices_from(removed_ids);
+
+        REQUIRE_EQ(sut.n_vertices(), expected.n_vertices());
+        REQUIRE_EQ(sut.n_unique_edges(), expected.n_unique_edges());
+        CHECK(std::ranges::equal(sut.vertex_ids(), expected.vertex_ids()));
+
+        const auto edge_ids = [](const auto& edge) { return edge.incident_vertex_ids(); };
+        for (const auto vertex_id : sut.vertex_ids()) {
+            CHECK_EQ(sut.get_vertex(vertex_id).id(), vertex_id);
+            CHECK(std::ranges::equal(
+                sut.adjacent_edges(vertex_id),
+                expected.adjacent_edges(vertex_id),
+                std::ranges::equal_to{},
+                edge_ids,
+                edge_ids
+            ));
+        }
+        CHECK(std::ranges::equal(sut.degree_map(), expected.degree_map()));
+    }
+
+    SUBCASE("remove_vertices_from should throw without modifying the graph if any id is invalid") {
+        sut_type sut{constants::n_elements};
+        fixture.init_complete_graph(sut);
+        const auto n_unique_edges = sut.n_unique_edges();
+
+        CHECK_THROWS_AS(
+            sut.remove_vertices_from(
+                vertex_id_list{constants::vertex_id_1, constants::out_of_range_elemenet_idx}
+            ),
+            std::out_of_range
+        );
+        CHECK_EQ(sut.n_vertices(), constants::n_elements);
+        CHECK_EQ(sut.n_unique_edges(), n_unique_edges);
+    }
+
+    SUBCASE("deferred vertex removal should keep the vertex ids stable until the graph is "
+            "compacted") {
+        constexpr auto n_vertices = graph_common::n_vertex_removal_graph_vertices;
+        const auto& removed_ids = graph_common::vertex_removal_ids;
+
+        auto sut = graph_common::make_vertex_removal_graph<sut_type>();
+        auto expected = graph_common::make_vertex_removal_graph<sut_type>();
+
+        expected.remove_vertices_from(removed_ids);
+
+        sut.set_deferred_vertex_removal(true);
+        sut.remove_vertex(removed_ids.front());
+        sut.remove_vertices_from(vertex_id_list(std::next(removed_ids.begin()), removed_ids.end()));
+
+        REQUIRE_EQ(sut.n_vertices(), n_vertices);
+        REQUIRE_EQ(sut.n_removed_vertices(), removed_ids.size());
+        REQUIRE_EQ(sut.n_unique_edges(), expected.n_unique_edges());
+        CHECK_EQ(sut.vertices().distance(), expected.n_vertices());
+
+        for (const auto vertex_id : removed_ids) {
+            CHECK_FALSE(sut.has_vertex(vertex_id));
+            CHECK_THROWS_AS(static_cast<void>(sut.get_vertex(vertex_id)), std::out_of_range);
+            CHECK_EQ(sut.degree_map()[vertex_id], constants::zero_elements);
+        }
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            CHECK_EQ(sut.get_vertex(vertex_id).id(), vertex_id);
+            CHECK(std::ranges::all_of(sut.adjacent_edges(vertex_id), [&sut](const auto& edge) {
+                return sut.has_vertex(edge.first()) and sut.has_vertex(edge.second());
+            }));
+        }
+
+        CHECK_THROWS_AS(sut.set_deferred_vertex_removal(false), std::logic_error);
+
+        const auto new_ids = sut.compact();
+        REQUIRE_EQ(new_ids.size(), n_vertices);
+        for (const auto vertex_id : removed_ids)
+            CHECK_EQ(new_ids[vertex_id], lib::constants::invalid_id);
+        CHECK_EQ(new_ids[constants::vertex_id_2], constants::vertex_id_1);
+
+        REQUIRE_EQ(sut.n_vertices(), expected.n_vertices());
+        REQUIRE_EQ(sut.n_removed_vertices(), constants::zero_elements);
+        CHECK(std::ranges::equal(sut.vertex_ids(), expected.vertex_ids()));
+
+        // the edge removal can change the order of the adjacent edges
+        const auto sorted_neighbor_ids = [](const auto& graph, const lib_t::id_type vertex_id) {
+            std::vector<lib_t::id_type> neighbor_ids;
+            for (const auto& edge : graph.adjacent_edges(vertex_id))
+                neighbor_ids.push_back(edge.incident_vertex_id(vertex_id));
+            std::ranges::sort(neighbor_ids);
+            return neighbor_ids;
+        };
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            CHECK_EQ(sut.get_vertex(vertex_id).id(), vertex_id);
+            CHECK_EQ(
+                sorted_neighbor_ids(sut, vertex_id), sorted_neighbor_ids(expected, vertex_id)
+            );
+        }
+        CHECK(std::ranges::equal(sut.degree_map(), expected.degree_map()));
+
+        CHECK_NOTHROW(sut.set_deferred_vertex_removal(false));
+    }
+
     // --- edge method tests ---
 
     SUBCASE("edge method tests for default properties type") {
@@ -521,6 +649,49 @@ TEST_CASE_TEMPLATE_DEFINE("graph structure tests", TraitsType, graph_traits_temp
             }));
         }
 
+        SUBCASE("add_edges should throw if any id is invalid and not extend the graph") {
+            REQUIRE_EQ(sut.n_unique_edges(), constants::zero_elements);
+
+            using id_pair = lib_t::homogeneous_pair<lib_t::id_type>;
+            const std::vector<id_pair> id_pair_list{
+                {constants::vertex_id_1, constants::vertex_id_2},
+                {constants::vertex_id_2, constants::out_of_range_elemenet_idx}
+            };
+
+            CHECK_THROWS_AS(sut.add_edges(id_pair_list), std::out_of_range);
+            CHECK_EQ(sut.n_unique_edges(), constants::zero_elements);
+            CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+        }
+
+        SUBCASE("add_edges should extend the graph in the same way as adding the edges one by one"
+        ) {
+            REQUIRE_EQ(sut.n_unique_edges(), constants::zero_elements);
+
+            using id_pair = lib_t::homogeneous_pair<lib_t::id_type>;
+            const std::vector<id_pair> id_pair_list{
+                {constants::vertex_id_3, constants::vertex_id_1},
+                {constants::vertex_id_1, constants::vertex_id_2},
+                {constants::vertex_id_2, constants::vertex_id_2},
+                {constants::vertex_id_3, constants::vertex_id_3}
+            };
+
+            sut_type expected{constants::n_elements};
+            expected.add_edge(constants::vertex_id_2, constants::vertex_id_3);
+            for (const auto& [first_id, second_id] : id_pair_list)
+                expected.add_edge(first_id, second_id);
+
+            sut.add_edge(constants::vertex_id_2, constants::vertex_id_3);
+            sut.add_edges(id_pair_list);
+
+            REQUIRE_EQ(sut.n_unique_edges(), expected.n_unique_edges());
+            CHECK_EQ(sut.degree_map(), expected.degree_map());
+            for (const auto first_id : sut.vertex_ids())
+                for (const auto second_id : sut.vertex_ids())
+                    CHECK_EQ(
+                        sut.has_edge(first_id, second_id), expected.has_edge(first_id, second_id)
+                    );
+        }
+
         SUBCASE("remove_edge should properly remove the edge for both incident vertices") {
             const auto& added_edge = sut.add_edge(vertex_1, vertex_2);
 
@@ -832,7 +1003,7 @@ TEST_CASE_TEMPLATE_DEFINE("graph structure tests", TraitsType, graph_traits_temp
         sut_type sut{constants::n_elements};
         std::vector<lib_t::const_ref_wrap<edge_type>> expected_edges;
 
-        if constexpr (std::same_as<typename sut_type::implementation_tag, lib_i::list_t>) {
+        if constexpr (lib_tt::c_list_impl_tag<typename sut_type::implementation_tag>) {
             for (auto _ = constants::first_element_idx; _ < constants::n_elements; _++)
                 expected_edges.push_back(
                     std::cref(sut.add_edge(constants::vertex_id_1, constants::vertex_id_2))
@@ -929,6 +1100,146 @@ TEST_CASE_TEMPLATE_DEFINE("graph structure tests", TraitsType, graph_traits_temp
             CHECK_EQ(sut.adjacent_edges(vertex).distance(), constants::zero_elements);
         }());
     }
+
+    // --- conversion tests ---
+
+    SUBCASE("clone should return an independent graph with the same vertices and edges") {
+        using properties_traits_type = add_edge_property<traits_type, types::used_property>;
+        lib::graph<properties_traits_type> sut{constants::n_elements};
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                if (first_id < second_id)
+                    sut.add_edge(first_id, second_id, types::used_property{first_id % 2 == 0});
+        sut.add_edge(constants::vertex_id_1, constants::vertex_id_1, constants::used);
+
+        auto clone = sut.clone();
+        REQUIRE_EQ(clone.n_vertices(), sut.n_vertices());
+        REQUIRE_EQ(clone.n_unique_edges(), sut.n_unique_edges());
+        CHECK(std::ranges::equal(clone.degree_map(), sut.degree_map()));
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            const auto& clone_vertex = clone.get_vertex(vertex_id);
+            CHECK_NE(&clone_vertex, &sut.get_vertex(vertex_id));
+
+            const auto adjacent_edges = sut.adjacent_edges(vertex_id);
+            const auto clone_adjacent_edges = clone.adjacent_edges(clone_vertex);
+            REQUIRE_EQ(clone_adjacent_edges.distance(), adjacent_edges.distance());
+
+            auto it = adjacent_edges.begin();
+            for (const auto& clone_edge : clone_adjacent_edges) {
+                CHECK_NE(&clone_edge, &*it);
+                CHECK_EQ(clone_edge.incident_vertex_ids(), it->incident_vertex_ids());
+                CHECK_EQ(clone_edge.properties, it->properties);
+                CHECK(clone.has_edge(clone_edge));
+                CHECK(clone.are_incident(clone_vertex, clone_edge));
+                ++it;
+            }
+        }
+
+        // the clone can be modified independently of the source graph
+        const auto n_unique_edges = sut.n_unique_edges();
+        clone.remove_edge(*clone.adjacent_edges(constants::vertex_id_2).begin());
+        CHECK_EQ(clone.n_unique_edges(), n_unique_edges - constants::one);
+        clone.remove_vertex(constants::vertex_id_1);
+        CHECK_EQ(clone.n_vertices(), constants::n_elements - constants::one_element);
+
+        REQUIRE_EQ(sut.n_vertices(), constants::n_elements);
+        REQUIRE_EQ(sut.n_unique_edges(), n_unique_edges);
+
+        const auto frozen_clone = sut.freeze().clone();
+        CHECK_EQ(frozen_clone.n_unique_edges(), sut.n_unique_edges());
+        CHECK(std::ranges::equal(frozen_clone.degree_map(), sut.degree_map()));
+    }
+
+    SUBCASE("freeze should return a csr graph with the same vertices and edges") {
+        using properties_traits_type = add_edge_property<traits_type, types::used_property>;
+        lib::graph<properties_traits_type> sut{constants::n_elements};
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                if (first_id < second_id)
+                    sut.add_edge(first_id, second_id, types::used_property{first_id % 2 == 0});
+        sut.add_edge(constants::vertex_id_1, constants::vertex_id_1, constants::used);
+
+        const auto frozen = sut.freeze();
+        using frozen_type = std::remove_cvref_t<decltype(frozen)>;
+        static_assert(std::same_as<typename frozen_type::implementation_tag, lib_i::csr_t>);
+
+        REQUIRE_EQ(frozen.n_vertices(), sut.n_vertices());
+        REQUIRE_EQ(frozen.n_unique_edges(), sut.n_unique_edges());
+        CHECK(std::ranges::equal(frozen.degree_map(), sut.degree_map()));
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            const auto& frozen_vertex = frozen.get_vertex(vertex_id);
+            CHECK_NE(&frozen_vertex, &sut.get_vertex(vertex_id));
+
+            const auto adjacent_edges = sut.adjacent_edges(vertex_id);
+            const auto frozen_adjacent_edges = frozen.adjacent_edges(frozen_vertex);
+            REQUIRE_EQ(frozen_adjacent_edges.distance(), adjacent_edges.distance());
+
+            auto it = adjacent_edges.begin();
+            for (const auto& frozen_edge : frozen_adjacent_edges) {
+                CHECK_EQ(frozen_edge.incident_vertex_ids(), it->incident_vertex_ids());
+                CHECK_EQ(frozen_edge.properties, it->properties);
+                CHECK(frozen.are_incident(frozen_vertex, frozen_edge));
+                ++it;
+            }
+        }
+    }
+
+    SUBCASE("thaw should restore a mutable list graph equivalent to the frozen graph") {
+        sut_type sut{constants::n_elements};
+        fixture.init_complete_graph(sut);
+
+        auto thawed = sut.freeze().thaw();
+        using thawed_type = decltype(thawed);
+        static_assert(std::same_as<typename thawed_type::implementation_tag, lib_i::list_t>);
+
+        REQUIRE_EQ(thawed.n_vertices(), sut.n_vertices());
+        REQUIRE_EQ(thawed.n_unique_edges(), sut.n_unique_edges());
+        fixture.validate_full_graph_edges(thawed);
+
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                CHECK_EQ(thawed.has_edge(first_id, second_id), sut.has_edge(first_id, second_id));
+
+        thawed.remove_vertex(constants::vertex_id_1);
+        CHECK_EQ(thawed.n_vertices(), constants::n_elements - constants::one_element);
+    }
+
+    SUBCASE("compress should return a compressed graph with the same vertices and edges") {
+        sut_type sut{constants::n_elements};
+        fixture.init_complete_graph(sut);
+        sut.add_edge(constants::vertex_id_1, constants::vertex_id_1);
+
+        const auto compressed = sut.compress();
+        using compressed_type = std::remove_cvref_t<decltype(compressed)>;
+        static_assert(std::same_as<typename compressed_type::implementation_tag, lib_i::compressed_t>
+        );
+
+        REQUIRE_EQ(compressed.n_vertices(), sut.n_vertices());
+        REQUIRE_EQ(compressed.n_unique_edges(), sut.n_unique_edges());
+        CHECK(std::ranges::equal(compressed.degree_map(), sut.degree_map()));
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            const auto& compressed_vertex = compressed.get_vertex(vertex_id);
+            CHECK_EQ(
+                compressed.adjacent_edges(vertex_id).distance(),
+                sut.adjacent_edges(vertex_id).distance()
+            );
+            for (const auto& edge : compressed.adjacent_edges(compressed_vertex))
+                CHECK(compressed.are_incident(compressed_vertex, edge));
+        }
+
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                CHECK_EQ(
+                    compressed.has_edge(first_id, second_id), sut.has_edge(first_id, second_id)
+                );
+
+        const auto thawed = compressed.thaw();
+        REQUIRE_EQ(thawed.n_unique_edges(), sut.n_unique_edges());
+        CHECK(std::ranges::equal(thawed.degree_map(), sut.degree_map()));
+    }
 }
 
 TEST_CASE_TEMPLATE_INSTANTIATE(
@@ -936,9 +1247,382 @@ TEST_CASE_TEMPLATE_INSTANTIATE(
     lib::list_graph_traits<lib::directed_t>, // directed adjacency list
     lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
     lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t>, // undirected adjacency matrix
+    lib::sparse_matrix_graph_traits<lib::directed_t>, // directed sparse adjacency matrix
+    lib::sparse_matrix_graph_traits<lib::undirected_t>, // undirected sparse adjacency matrix
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency list with arena edge storage
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // undirected adjacency list with arena edge storage
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency matrix with arena edge storage
+    lib::matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // undirected adjacency matrix with arena edge storage
+    lib::sparse_matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed sparse adjacency matrix with arena edge storage
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // undirected adjacency list with pmr storage
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // directed adjacency matrix with pmr storage
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // directed adjacency list with the in-edge index
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<
+            lib_i::in_edge_index_t,
+            lib_i::edge_position_index_t>>, // directed adjacency list with all indices
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::edge_position_index_t>>, // undirected adj list with positions
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::neighbor_index_t<2ull>>>, // directed adj list with neighbors
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::neighbor_index_t<2ull>>>, // undirected adj list with neighbors
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>, // directed sorted adjacency list
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>> // undirected sorted adjacency list
+);
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "in_edges should return the edges incident to the given vertex",
+    TraitsType,
+    in_edges_traits_template
+) {
+    using sut_type = lib::graph<TraitsType>;
+    using edge_type = typename sut_type::edge_type;
+
+    sut_type sut{constants::n_elements};
+    const auto& edge_1_2 = sut.add_edge(constants::vertex_id_1, constants::vertex_id_2);
+    const auto& edge_3_2 = sut.add_edge(constants::vertex_id_3, constants::vertex_id_2);
+    sut.add_edge(constants::vertex_id_2, constants::vertex_id_3);
+
+    const auto in_edges = sut.in_edges(constants::vertex_id_2);
+    REQUIRE_EQ(in_edges.distance(), sut.in_degree(constants::vertex_id_2));
+    CHECK_NE(
+        std::ranges::find(in_edges, &edge_1_2, transforms::address_projection<edge_type>{}),
+        in_edges.end()
+    );
+    CHECK_NE(
+        std::ranges::find(in_edges, &edge_3_2, transforms::address_projection<edge_type>{}),
+        in_edges.end()
+    );
+
+    CHECK_THROWS_AS(
+        static_cast<void>(sut.in_edges(constants::out_of_range_elemenet_idx)), std::out_of_range
+    );
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    in_edges_traits_template,
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // directed adjacency list with the in-edge index
+    lib::list_graph_traits<lib::undirected_t> // undirected adjacency list
+);
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "has_edge and get_edge should be consistent with the adjacent edges of the indexed vertices",
+    TraitsType,
+    neighbor_index_traits_template
+) {
+    using sut_type = lib::graph<TraitsType>;
+
+    constexpr lib_t::size_type n_vertices = 40ull;
+    constexpr lib_t::id_type hub_id = constants::vertex_id_1;
+
+    // the hub vertex is connected with all other vertices, which additionally form a path
+    sut_type sut{n_vertices};
+    for (lib_t::id_type vertex_id = constants::vertex_id_2; vertex_id < n_vertices; ++vertex_id) {
+        sut.add_edge(hub_id, vertex_id);
+        if (vertex_id + constants::one < n_vertices)
+            sut.add_edge(vertex_id, vertex_id + constants::one);
+    }
+    sut.add_edge(hub_id, hub_id);
+
+    const auto check_edge_queries = [&sut]() {
+        for (const auto first_id : sut.vertex_ids()) {
+            const auto adjacent_edges = sut.adjacent_edges(first_id);
+            for (const auto second_id : sut.vertex_ids()) {
+                const auto is_matching = [first_id, second_id](const auto& edge) {
+                    return edge.incident_vertex_id(first_id) == second_id;
+                };
+                const bool expected_has_edge = std::ranges::any_of(adjacent_edges, is_matching);
+
+                CHECK_EQ(sut.has_edge(first_id, second_id), expected_has_edge);
+
+                const auto edge = sut.get_edge(first_id, second_id);
+                REQUIRE_EQ(edge.has_value(), expected_has_edge);
+                if (expected_has_edge) {
+                    CHECK(sut.has_edge(edge->get()));
+                    CHECK(is_matching(edge->get()));
+                }
+            }
+        }
+    };
+
+    check_edge_queries();
+
+    // remove the edges of the hub vertex until its index is released
+    for (lib_t::id_type vertex_id = constants::vertex_id_2;
+         vertex_id < n_vertices - constants::three;
+         ++vertex_id)
+        sut.remove_edge(sut.get_edge(hub_id, vertex_id)->get());
+    check_edge_queries();
+
+    // build the index again
+    for (lib_t::id_type vertex_id = constants::vertex_id_2; vertex_id < n_vertices; ++vertex_id)
+        sut.add_edge(hub_id, vertex_id);
+    check_edge_queries();
+
+    // the neighbor ids of the indexed vertices are shifted by the vertex removal
+    sut.remove_vertex(constants::vertex_id_3);
+    check_edge_queries();
+
+    sut.remove_vertices_from(vertex_id_list{constants::vertex_id_2, 10ull, 20ull});
+    check_edge_queries();
+
+    sut.remove_vertex(hub_id);
+    check_edge_queries();
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    neighbor_index_traits_template,
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::neighbor_index_t<8ull>>>, // directed adjacency list
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::neighbor_index_t<8ull>>>, // undirected adjacency list
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<
+            lib_i::in_edge_index_t,
+            lib_i::edge_position_index_t,
+            lib_i::neighbor_index_t<8ull>>>, // directed adjacency list with all indices
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<
+            lib_i::edge_position_index_t,
+            lib_i::neighbor_index_t<8ull>>> // undirected adjacency list with all indices
+);
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "common_neighbors should return the sorted ids of the vertices adjacent to both vertices",
+    TraitsType,
+    common_neighbors_traits_template
+) {
+    using sut_type = lib::graph<TraitsType>;
+
+    constexpr lib_t::size_type n_vertices = 50ull;
+    constexpr lib_t::id_type first_id = constants::vertex_id_1;
+    constexpr lib_t::id_type second_id = constants::vertex_id_2;
+
+    // the first vertex is adjacent to the even vertices and the second one to the multiples of 3
+    // (the edges are added in the descending order of the ids to check the adjacency order)
+    sut_type sut{n_vertices};
+    vertex_id_list expected_common_neighbors;
+    for (lib_t::id_type vertex_id = n_vertices - constants::one; vertex_id > second_id;
+         --vertex_id) {
+        const bool is_first_neighbor = vertex_id % constants::two == constants::zero;
+        const bool is_second_neighbor = vertex_id % constants::three == constants::zero;
+
+        if (is_first_neighbor)
+            sut.add_edge(first_id, vertex_id);
+        if (is_second_neighbor)
+            sut.add_edge(second_id, vertex_id);
+        if (is_first_neighbor and is_second_neighbor)
+            expected_common_neighbors.push_back(vertex_id);
+    }
+    std::ranges::reverse(expected_common_neighbors);
+
+    // parallel edges should not produce duplicate ids
+    if constexpr (lib::type_traits::c_list_impl_tag<typename TraitsType::implementation_tag>) {
+        const vertex_id_list parallel_ids{6ull, 12ull, 12ull};
+        for (const auto vertex_id : parallel_ids) {
+            sut.add_edge(first_id, vertex_id);
+            sut.add_edge(second_id, vertex_id);
+        }
+    }
+
+    CHECK_EQ(sut.common_neighbors(first_id, second_id), expected_common_neighbors);
+    CHECK_EQ(
+        sut.common_neighbors(sut.get_vertex(second_id), sut.get_vertex(first_id)),
+        expected_common_neighbors
+    );
+
+    // the common neighbors of the vertices adjacent to both first and second vertices
+    const auto reverse_common_neighbors = sut.common_neighbors(6ull, 12ull);
+    if constexpr (lib::type_traits::is_directed_v<typename sut_type::edge_type>)
+        CHECK(reverse_common_neighbors.empty());
+    else
+        CHECK_EQ(reverse_common_neighbors, vertex_id_list{first_id, second_id});
+
+    CHECK_THROWS_AS(
+        static_cast<void>(sut.common_neighbors(first_id, n_vertices)), std::out_of_range
+    );
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    common_neighbors_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>, // directed sorted adjacency list
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>, // undirected sorted adjacency list
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
     lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
 );
 
+TEST_CASE_TEMPLATE_DEFINE(
+    "add_edges should properly set the properties of the added edges",
+    TraitsType,
+    add_weighted_edges_traits_template
+) {
+    using sut_type = lib::graph<TraitsType>;
+    using edge_properties_type = typename sut_type::edge_properties_type;
+    using weight_type = typename edge_properties_type::weight_type;
+
+    using weighted_edge = std::tuple<lib_t::id_type, lib_t::id_type, weight_type>;
+    using edge_with_properties = std::tuple<lib_t::id_type, lib_t::id_type, edge_properties_type>;
+
+    constexpr weight_type weight_1_2 = 3.0;
+    constexpr weight_type weight_2_3 = 5.0;
+    constexpr weight_type weight_3_1 = 7.0;
+
+    sut_type sut{constants::n_elements};
+
+    sut.add_edges(std::vector<weighted_edge>{
+        {constants::vertex_id_1, constants::vertex_id_2, weight_1_2},
+        {constants::vertex_id_2, constants::vertex_id_3, weight_2_3}
+    });
+    sut.add_edges(std::vector<edge_with_properties>{
+        {constants::vertex_id_3, constants::vertex_id_1, edge_properties_type{weight_3_1}}
+    });
+
+    REQUIRE_EQ(sut.n_unique_edges(), constants::n_elements);
+    const auto edge_weight = [&sut](const lib_t::id_type first_id, const lib_t::id_type second_id) {
+        return sut.get_edge(first_id, second_id)->get().properties.weight;
+    };
+    CHECK_EQ(edge_weight(constants::vertex_id_1, constants::vertex_id_2), weight_1_2);
+    CHECK_EQ(edge_weight(constants::vertex_id_2, constants::vertex_id_3), weight_2_3);
+    CHECK_EQ(edge_weight(constants::vertex_id_3, constants::vertex_id_1), weight_3_1);
+
+    CHECK_THROWS_AS(
+        sut.add_edges(std::vector<weighted_edge>{
+            {constants::vertex_id_1, constants::out_of_range_elemenet_idx, weight_1_2}
+        }),
+        std::out_of_range
+    );
+    CHECK_EQ(sut.n_unique_edges(), constants::n_elements);
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    add_weighted_edges_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>, // directed adjacency list
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>, // undirected adjacency list
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>, // directed adjacency matrix
+    lib::matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>, // undirected adjacency matrix
+    lib::sparse_matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::weight_property<>>, // undirected sparse adjacency matrix
+    lib::directed_graph_traits<
+        lib_t::empty_properties,
+        lib_t::weight_property<>,
+        lib_i::basic_list_t<
+            lib_i::in_edge_index_t,
+            lib_i::neighbor_index_t<2ull>>>, // directed adjacency list with indices
+    lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::weight_property<>,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>> // undirected sorted adjacency list
+);
+
+TEST_CASE("sorted adjacency lists should keep the adjacent edges ordered by the neighbor ids") {
+    using sut_type = lib::graph<lib::undirected_graph_traits<
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>>;
+
+    constexpr lib_t::size_type n_vertices = 20ull;
+
+    sut_type sut{n_vertices};
+    for (lib_t::id_type vertex_id = lib::constants::initial_id; vertex_id < n_vertices;
+         ++vertex_id)
+        sut.add_edge(vertex_id, (vertex_id * 7ull) % n_vertices);
+
+    vertex_id_list targets;
+    for (lib_t::id_type vertex_id = n_vertices - constants::one; vertex_id > constants::zero;
+         --vertex_id)
+        targets.push_back(vertex_id);
+    sut.add_edges_from(constants::vertex_id_1, targets);
+
+    sut.remove_vertices_from(vertex_id_list{constants::vertex_id_3, 11ull});
+
+    for (const auto vertex_id : sut.vertex_ids()) {
+        vertex_id_list neighbor_ids;
+        for (const auto& edge : sut.adjacent_edges(vertex_id))
+            neighbor_ids.push_back(edge.incident_vertex_id(vertex_id));
+        CHECK(std::ranges::is_sorted(neighbor_ids));
+    }
+}
+
 TEST_SUITE_END(); // test_graph
 
 } // namespace gl_testing
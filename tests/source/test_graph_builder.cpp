@@ -0,0 +1,442 @@
+#include "constants.hpp"
+#include "functional.hpp"
+#include "types.hpp"
+
+#include <gl/graph_builder.hpp>
+#include <gl/topologies.hpp>
+
+#include <doctest.h>
+
+#include <execution>
+#include <thread>
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_graph_builder");
+
+namespace {
+
+constexpr lib_t::size_type n_threads = 4ull;
+constexpr lib_t::size_type n_builder_vertices = 64ull;
+
+// each thread adds the edges outgoing from the vertices with `id % n_threads == thread_idx`
+template <typename BuilderType, typename AddEdge>
+void build_complete_graph_concurrently(BuilderType& builder, const AddEdge& add_edge) {
+    std::vector<std::thread> threads;
+    for (lib_t::size_type thread_idx = constants::zero; thread_idx < n_threads; ++thread_idx) {
+        threads.emplace_back([&builder, &add_edge, thread_idx] {
+            for (auto first_id = static_cast<lib_t::id_type>(thread_idx);
+                 first_id < n_builder_vertices;
+                 first_id += static_cast<lib_t::id_type>(n_threads))
+                for (lib_t::id_type second_id = first_id + 1u; second_id < n_builder_vertices;
+                     ++second_id)
+                    add_edge(builder, first_id, second_id);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+constexpr lib_t::size_type n_complete_graph_edges =
+    n_builder_vertices * (n_builder_vertices - constants::one) / constants::two;
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graph_builder should produce a graph with all edges added concurrently",
+    TraitsType,
+    graph_builder_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+    using sut_type = lib::graph_builder<graph_type>;
+
+    sut_type sut{n_builder_vertices};
+    CHECK_EQ(sut.n_vertices(), n_builder_vertices);
+    CHECK_GE(sut.n_shards(), constants::one);
+
+    build_complete_graph_concurrently(
+        sut,
+        [](sut_type& builder, const lib_t::id_type first_id, const lib_t::id_type second_id) {
+            builder.add_edge(first_id, second_id);
+        }
+    );
+    CHECK_EQ(sut.n_edges(), n_complete_graph_edges);
+
+    const auto graph = sut.finalize();
+    CHECK_EQ(sut.n_edges(), constants::zero);
+
+    REQUIRE_EQ(graph.n_vertices(), n_builder_vertices);
+    REQUIRE_EQ(graph.n_unique_edges(), n_complete_graph_edges);
+    for (const auto first_id : graph.vertex_ids())
+        for (const auto second_id : graph.vertex_ids())
+            if (first_id < second_id)
+                CHECK(graph.has_edge(first_id, second_id));
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    graph_builder_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("graph_builder should preserve the edge properties") {
+    using weight_type = lib_t::weight_property<int>;
+    using graph_type =
+        lib::graph<lib::list_graph_traits<lib::directed_t, types::visited_property, weight_type>>;
+    using sut_type = lib::graph_builder<graph_type>;
+
+    sut_type sut{n_builder_vertices, n_threads};
+    CHECK_EQ(sut.n_shards(), n_threads);
+
+    build_complete_graph_concurrently(
+        sut,
+        [](sut_type& builder, const lib_t::id_type first_id, const lib_t::id_type second_id) {
+            builder.add_edge(first_id, second_id, {static_cast<int>(first_id + second_id)});
+        }
+    );
+
+    const auto graph = sut.finalize();
+    REQUIRE_EQ(graph.n_unique_edges(), n_complete_graph_edges);
+    for (const auto first_id : graph.vertex_ids())
+        for (const auto& edge : graph.adjacent_edges(first_id))
+            CHECK_EQ(edge.properties.weight, static_cast<int>(edge.first_id() + edge.second_id()));
+}
+
+TEST_CASE("graph_builder::add_edges should add a batch of edges") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::undirected_t>>;
+    using sut_type = lib::graph_builder<graph_type>;
+
+    sut_type sut{constants::n_elements};
+    const std::vector<lib_t::homogeneous_pair<lib_t::id_type>> edges{
+        {constants::vertex_id_1, constants::vertex_id_2},
+        {constants::vertex_id_2, constants::vertex_id_3}
+    };
+
+    sut.add_edges(edges);
+    CHECK_EQ(sut.n_edges(), edges.size());
+
+    const auto graph = sut.finalize();
+    CHECK_EQ(graph.n_unique_edges(), edges.size());
+    CHECK(graph.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+    CHECK(graph.has_edge(constants::vertex_id_2, constants::vertex_id_3));
+}
+
+TEST_CASE("graph_builder should throw when a vertex id is out of range") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+
+    lib::graph_builder<graph_type> sut{constants::n_elements};
+    const auto invalid_id = static_cast<lib_t::id_type>(constants::out_of_range_elemenet_idx);
+
+    CHECK_THROWS_AS(sut.add_edge(constants::vertex_id_1, invalid_id), std::out_of_range);
+    CHECK_THROWS_AS(sut.add_edge(invalid_id, constants::vertex_id_1), std::out_of_range);
+    CHECK_THROWS_AS(
+        sut.add_edges(std::vector<lib_t::homogeneous_pair<lib_t::id_type>>{
+            {constants::vertex_id_1, constants::vertex_id_2}, {constants::vertex_id_1, invalid_id}
+        }),
+        std::out_of_range
+    );
+    CHECK_EQ(sut.n_edges(), constants::zero);
+}
+
+namespace {
+
+// the edges of a complete graph with self loops (parallel edges are added in directed graphs)
+[[nodiscard]] std::vector<lib_t::homogeneous_pair<lib_t::id_type>> complete_graph_id_pairs() {
+    std::vector<lib_t::homogeneous_pair<lib_t::id_type>> id_pairs;
+    for (lib_t::id_type first_id = 0u; first_id < n_builder_vertices; ++first_id)
+        for (lib_t::id_type second_id = first_id; second_id < n_builder_vertices; ++second_id)
+            id_pairs.emplace_back(second_id, first_id);
+    return id_pairs;
+}
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "build_from_edges should produce a graph with the given edges",
+    TraitsType,
+    build_from_edges_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    const auto id_pairs = complete_graph_id_pairs();
+
+    const auto check_graph = [&id_pairs](const graph_type& graph) {
+        REQUIRE_EQ(graph.n_vertices(), n_builder_vertices);
+        REQUIRE_EQ(graph.n_unique_edges(), id_pairs.size());
+        for (const auto& [first_id, second_id] : id_pairs) {
+            CHECK(graph.has_edge(first_id, second_id));
+            CHECK_EQ(
+                graph.has_edge(second_id, first_id),
+                first_id == second_id or lib_tt::is_undirected_v<graph_type>
+            );
+        }
+
+        if constexpr (lib_tt::is_undirected_v<graph_type>)
+            for (const auto vertex_id : graph.vertex_ids())
+                CHECK_EQ(graph.adjacent_edges(vertex_id).distance(), n_builder_vertices);
+    };
+
+    SUBCASE("sequenced policy") {
+        check_graph(lib::build_from_edges<graph_type>(n_builder_vertices, id_pairs));
+    }
+
+    SUBCASE("parallel policy") {
+        check_graph(
+            lib::build_from_edges<graph_type>(n_builder_vertices, id_pairs, std::execution::par)
+        );
+    }
+
+    SUBCASE("parallel unsequenced policy") {
+        check_graph(lib::build_from_edges<graph_type>(
+            n_builder_vertices, id_pairs, std::execution::par_unseq
+        ));
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    build_from_edges_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // directed adjacency list with the in-edge index
+    lib::graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>, // sorted undirected adjacency list
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency list with arena storage
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("build_from_edges should keep the sorted adjacency order") {
+    using graph_type = lib::graph<lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::basic_list_t<lib_i::sorted_adjacency_t>>>;
+
+    const auto graph = lib::build_from_edges<graph_type>(
+        n_builder_vertices, complete_graph_id_pairs(), std::execution::par
+    );
+
+    for (const auto vertex_id : graph.vertex_ids())
+        CHECK(std::ranges::is_sorted(graph.adjacent_edges(vertex_id), {}, [](const auto& edge) {
+            return edge.second_id();
+        }));
+}
+
+TEST_CASE("build_from_edges should assign the given weights to the edges") {
+    using weight_type = lib_t::weight_property<int>;
+    using graph_type = lib::graph<
+        lib::list_graph_traits<lib::undirected_t, lib_t::empty_properties, weight_type>>;
+
+    const auto id_pairs = complete_graph_id_pairs();
+    std::vector<int> weights;
+    for (const auto& [first_id, second_id] : id_pairs)
+        weights.push_back(static_cast<int>(first_id * n_builder_vertices + second_id));
+
+    const auto graph = lib::build_from_edges<graph_type>(
+        n_builder_vertices, id_pairs, weights, std::execution::par
+    );
+
+    REQUIRE_EQ(graph.n_unique_edges(), id_pairs.size());
+    for (const auto& [first_id, second_id] : id_pairs)
+        CHECK_EQ(
+            graph.get_edge(first_id, second_id)->get().properties.weight,
+            static_cast<int>(first_id * n_builder_vertices + second_id)
+        );
+
+    weights.pop_back();
+    CHECK_THROWS_AS(
+        func::discard_result(
+            lib::build_from_edges<graph_type>(n_builder_vertices, id_pairs, weights)
+        ),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("build_from_edges should throw when a vertex id is out of range") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+
+    const std::vector<lib_t::homogeneous_pair<lib_t::id_type>> id_pairs{
+        {constants::vertex_id_1, constants::vertex_id_2},
+        {constants::vertex_id_2, static_cast<lib_t::id_type>(constants::out_of_range_elemenet_idx)}
+    };
+
+    CHECK_THROWS_AS(
+        func::discard_result(lib::build_from_edges<graph_type>(
+            constants::n_elements, id_pairs, std::execution::par
+        )),
+        std::out_of_range
+    );
+}
+
+namespace {
+
+// the even vertex ids in the descending order
+[[nodiscard]] std::vector<lib_t::id_type> induced_subgraph_vertex_ids() {
+    std::vector<lib_t::id_type> vertex_ids;
+    for (auto vertex_id = static_cast<lib_t::id_type>(n_builder_vertices); vertex_id > 0u;
+         vertex_id -= 2u)
+        vertex_ids.push_back(vertex_id - 2u);
+    return vertex_ids;
+}
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "induced_subgraph should produce a graph induced by the given vertices",
+    TraitsType,
+    induced_subgraph_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    auto graph = lib::topology::clique<graph_type>(n_builder_vertices);
+    graph.add_edge(constants::vertex_id_1, constants::vertex_id_1);
+    graph.add_edge(constants::vertex_id_2, constants::vertex_id_2);
+
+    const auto vertex_ids = induced_subgraph_vertex_ids();
+
+    const auto check_subgraph = [&](const lib::subgraph_descriptor<graph_type>& subgraph) {
+        REQUIRE_EQ(subgraph.vertex_id_map, vertex_ids);
+
+        const auto& sut = subgraph.graph;
+        REQUIRE_EQ(sut.n_vertices(), vertex_ids.size());
+
+        lib_t::size_type n_expected_edges = constants::zero;
+        for (const auto first_id : sut.vertex_ids()) {
+            for (const auto second_id : sut.vertex_ids()) {
+                const auto has_source_edge = graph.has_edge(
+                    subgraph.vertex_id_map[first_id], subgraph.vertex_id_map[second_id]
+                );
+                CHECK_EQ(sut.has_edge(first_id, second_id), has_source_edge);
+                const bool is_unique = lib_tt::is_directed_v<graph_type> or first_id <= second_id;
+                if (has_source_edge and is_unique)
+                    ++n_expected_edges;
+            }
+        }
+        CHECK_EQ(sut.n_unique_edges(), n_expected_edges);
+    };
+
+    SUBCASE("sequenced policy") {
+        check_subgraph(lib::induced_subgraph(graph, vertex_ids));
+    }
+
+    SUBCASE("parallel policy") {
+        check_subgraph(lib::induced_subgraph(graph, vertex_ids, std::execution::par));
+    }
+
+    SUBCASE("parallel unsequenced policy") {
+        check_subgraph(lib::induced_subgraph(graph, vertex_ids, std::execution::par_unseq));
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    induced_subgraph_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // directed adjacency list with the in-edge index
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // undirected adjacency list with arena storage
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("induced_subgraph should copy the vertex and edge properties") {
+    using weight_type = lib_t::weight_property<int>;
+    using graph_type = lib::graph<
+        lib::list_graph_traits<lib::undirected_t, types::visited_property, weight_type>>;
+
+    graph_type graph{n_builder_vertices};
+    for (const auto& vertex : graph.vertices())
+        vertex.properties.visited = vertex.id() % 4u == 0u;
+    for (const auto first_id : graph.vertex_ids())
+        for (const auto second_id : graph.vertex_ids())
+            if (first_id < second_id)
+                graph.add_edge(first_id, second_id, {static_cast<int>(first_id + second_id)});
+
+    const auto subgraph =
+        lib::induced_subgraph(graph, induced_subgraph_vertex_ids(), std::execution::par);
+    const auto& sut = subgraph.graph;
+
+    const auto& id_map = subgraph.vertex_id_map;
+    for (const auto& vertex : sut.vertices())
+        CHECK_EQ(
+            vertex.properties.visited, graph.get_vertex(id_map[vertex.id()]).properties.visited
+        );
+
+    for (const auto vertex_id : sut.vertex_ids())
+        for (const auto& edge : sut.adjacent_edges(vertex_id))
+            CHECK_EQ(
+                edge.properties.weight,
+                static_cast<int>(id_map[edge.first_id()] + id_map[edge.second_id()])
+            );
+}
+
+TEST_CASE("induced_subgraph should map the vertex ids of a small part of a graph") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+
+    // the subgraph contains less than 1/8 of the graph's vertices
+    constexpr lib_t::size_type n_vertices = 1000ull;
+    const std::vector<lib_t::id_type> vertex_ids{500u, 3u, 501u, 999u};
+
+    graph_type graph{n_vertices};
+    for (const auto vertex_id : graph.vertex_ids())
+        graph.add_edge(vertex_id, (vertex_id + constants::one) % n_vertices);
+
+    const auto subgraph = lib::induced_subgraph(graph, vertex_ids);
+    const auto& sut = subgraph.graph;
+
+    REQUIRE_EQ(subgraph.vertex_id_map, vertex_ids);
+    REQUIRE_EQ(sut.n_vertices(), vertex_ids.size());
+    REQUIRE_EQ(sut.n_unique_edges(), constants::one);
+    CHECK(sut.has_edge(constants::vertex_id_1, constants::vertex_id_3));
+
+    const std::vector<lib_t::id_type> duplicate_ids{500u, 3u, 500u};
+    CHECK_THROWS_AS(
+        func::discard_result(lib::induced_subgraph(graph, duplicate_ids)), std::invalid_argument
+    );
+}
+
+TEST_CASE("induced_subgraph should throw when a vertex id is invalid") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+
+    const graph_type graph{constants::n_elements};
+
+    const std::vector<lib_t::id_type> out_of_range_ids{
+        constants::vertex_id_1, static_cast<lib_t::id_type>(constants::out_of_range_elemenet_idx)
+    };
+    CHECK_THROWS_AS(
+        func::discard_result(lib::induced_subgraph(graph, out_of_range_ids)), std::out_of_range
+    );
+
+    const std::vector<lib_t::id_type> duplicate_ids{
+        constants::vertex_id_1, constants::vertex_id_2, constants::vertex_id_1
+    };
+    CHECK_THROWS_AS(
+        func::discard_result(lib::induced_subgraph(graph, duplicate_ids, std::execution::par)),
+        std::invalid_argument
+    );
+}
+
+TEST_SUITE_END(); // test_graph_builder
+
+} // namespace gl_testing
@@ -0,0 +1,222 @@
+#include "constants.hpp"
+#include "functional.hpp"
+#include "types.hpp"
+
+#include <gl/algorithms.hpp>
+#include <gl/graph_view.hpp>
+#include <gl/topologies.hpp>
+
+#include <doctest.h>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_graph_view");
+
+TEST_CASE_TEMPLATE_DEFINE("graph_view structure tests", TraitsType, graph_view_traits_template) {
+    using graph_type = lib::graph<TraitsType>;
+    using vertex_type = typename graph_type::vertex_type;
+    using edge_type = typename graph_type::edge_type;
+
+    const auto graph = lib::topology::clique<graph_type>(constants::n_elements_alg);
+    const auto hidden_id = constants::vertex_id_2;
+
+    SUBCASE("an unfiltered view should mirror the graph") {
+        const auto sut = lib::make_view(graph);
+        static_assert(lib_tt::c_graph_view<std::remove_cvref_t<decltype(sut)>>);
+
+        CHECK_EQ(&sut.graph(), &graph);
+        CHECK_EQ(sut.n_vertices(), graph.n_vertices());
+        CHECK_EQ(sut.n_removed_vertices(), graph.n_removed_vertices());
+        CHECK(std::ranges::equal(sut.vertex_ids(), graph.vertex_ids()));
+
+        for (const auto vertex_id : graph.vertex_ids()) {
+            CHECK_EQ(&sut.get_vertex(vertex_id), &graph.get_vertex(vertex_id));
+            CHECK(std::ranges::equal(
+                sut.adjacent_edges(vertex_id),
+                graph.adjacent_edges(vertex_id),
+                [](const edge_type& lhs, const edge_type& rhs) { return &lhs == &rhs; }
+            ));
+        }
+    }
+
+    SUBCASE("a vertex filtered view should hide the vertices and their incident edges") {
+        const auto sut = lib::filter_vertices(graph, [hidden_id](const vertex_type& vertex) {
+            return vertex.id() != hidden_id;
+        });
+
+        CHECK_EQ(sut.n_vertices(), graph.n_vertices());
+        CHECK_EQ(sut.n_removed_vertices(), constants::one);
+        CHECK_EQ(std::ranges::distance(sut.vertices()), constants::n_elements_alg - constants::one);
+        CHECK(std::ranges::none_of(sut.vertex_ids(), [hidden_id](const auto id) {
+            return id == hidden_id;
+        }));
+
+        CHECK_FALSE(sut.has_vertex(hidden_id));
+        CHECK_FALSE(sut.has_vertex(graph.get_vertex(hidden_id)));
+        CHECK_THROWS_AS(func::discard_result(sut.get_vertex(hidden_id)), std::out_of_range);
+        CHECK_THROWS_AS(func::discard_result(sut.adjacent_edges(hidden_id)), std::out_of_range);
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            CHECK(sut.has_vertex(vertex_id));
+            CHECK_EQ(
+                std::ranges::distance(sut.adjacent_edges(vertex_id)),
+                constants::n_elements_alg - constants::two
+            );
+            for (const auto& edge : sut.adjacent_edges(vertex_id)) {
+                CHECK_NE(edge.incident_vertex_id(vertex_id), hidden_id);
+                CHECK(sut.has_edge(edge));
+            }
+        }
+
+        const auto& hidden_edge = *graph.adjacent_edges(hidden_id).begin();
+        CHECK(graph.has_edge(hidden_edge));
+        CHECK_FALSE(sut.has_edge(hidden_edge));
+    }
+
+    SUBCASE("an edge filtered view should hide only the edges") {
+        // only the edges between the vertices with ids of the same parity are visible
+        const auto sut = lib::filter_edges(graph, [](const edge_type& edge) {
+            return (edge.first_id() + edge.second_id()) % 2u == 0u;
+        });
+
+        CHECK_EQ(sut.n_removed_vertices(), constants::zero);
+        CHECK(std::ranges::equal(sut.vertex_ids(), graph.vertex_ids()));
+
+        for (const auto vertex_id : sut.vertex_ids()) {
+            CHECK_EQ(
+                std::ranges::distance(sut.adjacent_edges(vertex_id)),
+                constants::n_elements_alg / constants::two - constants::one
+            );
+            for (const auto& edge : sut.adjacent_edges(vertex_id))
+                CHECK_EQ(edge.incident_vertex_id(vertex_id) % 2u, vertex_id % 2u);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    graph_view_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("the traversal algorithms should respect the view's filters") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+    using vertex_type = typename graph_type::vertex_type;
+
+    const auto graph = lib::topology::bidirectional_path<graph_type>(constants::n_elements_alg);
+    const auto cut_id = static_cast<lib_t::id_type>(constants::n_elements_alg / constants::two);
+
+    // the path is cut in half by the hidden vertex
+    const auto sut = lib::filter_vertices(graph, [cut_id](const vertex_type& vertex) {
+        return vertex.id() != cut_id;
+    });
+
+    const auto check_predecessors = [&](const lib::algorithm::predecessors_descriptor& pd) {
+        for (const auto vertex_id : graph.vertex_ids())
+            CHECK_EQ(pd.is_reachable(vertex_id), vertex_id < cut_id);
+    };
+
+    check_predecessors(lib::algorithm::breadth_first_search(sut, constants::vertex_id_1));
+    check_predecessors(lib::algorithm::depth_first_search(sut, constants::vertex_id_1));
+    check_predecessors(lib::algorithm::recursive_depth_first_search(sut, constants::vertex_id_1));
+
+    // without a root, all visible vertices should be searched
+    const auto pd = lib::algorithm::breadth_first_search(sut);
+    for (const auto vertex_id : graph.vertex_ids())
+        CHECK_EQ(pd.is_reachable(vertex_id), vertex_id != cut_id);
+}
+
+TEST_CASE("dijkstra_shortest_paths should ignore the edges hidden by the view") {
+    using weight_type = lib_t::weight_property<int>;
+    using graph_type =
+        lib::graph<lib::list_graph_traits<lib::directed_t, lib_t::empty_properties, weight_type>>;
+    using edge_type = typename graph_type::edge_type;
+
+    constexpr int max_weight = 5;
+
+    graph_type graph{constants::n_elements};
+    graph.add_edge(constants::vertex_id_1, constants::vertex_id_3, {max_weight + 1}); // heavy
+    graph.add_edge(constants::vertex_id_1, constants::vertex_id_2, {max_weight});
+    graph.add_edge(constants::vertex_id_2, constants::vertex_id_3, {max_weight});
+
+    const auto paths = lib::algorithm::dijkstra_shortest_paths(graph, constants::vertex_id_1);
+    CHECK_EQ(paths.distances[constants::vertex_id_3], max_weight + 1);
+
+    const auto sut = lib::filter_edges(graph, [](const edge_type& edge) {
+        return edge.properties.weight <= max_weight;
+    });
+    const auto filtered_paths =
+        lib::algorithm::dijkstra_shortest_paths(sut, constants::vertex_id_1);
+    CHECK_EQ(filtered_paths.distances[constants::vertex_id_3], 2 * max_weight);
+    CHECK_EQ(filtered_paths.predecessors[constants::vertex_id_3], constants::vertex_id_2);
+}
+
+TEST_CASE("the structural algorithms should respect the view's filters") {
+    SUBCASE("topological_sort") {
+        using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+        using edge_type = typename graph_type::edge_type;
+
+        // the cycle 1 -> 2 -> 3 -> 1 is broken by hiding the 3 -> 1 edge
+        graph_type graph{constants::n_elements};
+        graph.add_edge(constants::vertex_id_1, constants::vertex_id_2);
+        graph.add_edge(constants::vertex_id_2, constants::vertex_id_3);
+        graph.add_edge(constants::vertex_id_3, constants::vertex_id_1);
+        REQUIRE_FALSE(lib::algorithm::topological_sort(graph).has_value());
+
+        const auto sut = lib::filter_edges(graph, [](const edge_type& edge) {
+            return edge.second_id() != constants::vertex_id_1;
+        });
+        const auto order = lib::algorithm::topological_sort(sut);
+        REQUIRE(order.has_value());
+        CHECK_EQ(
+            order.value(),
+            std::vector<lib_t::id_type>{
+                constants::vertex_id_1, constants::vertex_id_2, constants::vertex_id_3
+            }
+        );
+    }
+
+    SUBCASE("bipartite_coloring") {
+        using graph_type = lib::graph<lib::list_graph_traits<lib::undirected_t>>;
+        using vertex_type = typename graph_type::vertex_type;
+
+        const auto graph = lib::topology::clique<graph_type>(constants::n_elements);
+        REQUIRE_FALSE(lib::algorithm::is_bipartite(graph));
+
+        const auto sut = lib::filter_vertices(graph, [](const vertex_type& vertex) {
+            return vertex.id() != constants::vertex_id_3;
+        });
+        CHECK(lib::algorithm::is_bipartite(sut));
+    }
+
+    SUBCASE("prim_mst") {
+        using weight_type = lib_t::weight_property<int>;
+        using graph_type = lib::graph<
+            lib::list_graph_traits<lib::undirected_t, lib_t::empty_properties, weight_type>>;
+        using vertex_type = typename graph_type::vertex_type;
+
+        graph_type graph{constants::n_elements + constants::one};
+        graph.add_edge(constants::vertex_id_1, constants::vertex_id_2, {1});
+        graph.add_edge(constants::vertex_id_2, constants::vertex_id_3, {2});
+        graph.add_edge(constants::vertex_id_3, constants::n_elements, {3});
+
+        // the last vertex is hidden, so the mst of the view has only two edges
+        const auto sut = lib::filter_vertices(graph, [](const vertex_type& vertex) {
+            return vertex.id() != constants::n_elements;
+        });
+
+        const auto edge_heap_mst = lib::algorithm::edge_heap_prim_mst(sut, std::nullopt);
+        CHECK_EQ(edge_heap_mst.edges.size(), constants::two);
+        CHECK_EQ(edge_heap_mst.weight, 3);
+
+        const auto vertex_heap_mst = lib::algorithm::vertex_heap_prim_mst(sut, std::nullopt);
+        CHECK_EQ(vertex_heap_mst.edges.size(), constants::two);
+        CHECK_EQ(vertex_heap_mst.weight, 3);
+    }
+}
+
+TEST_SUITE_END(); // test_graph_view
+
+} // namespace gl_testing
@@ -0,0 +1,86 @@
+#include "constants.hpp"
+
+#include <gl/impl/neighbor_index.hpp>
+
+#include <doctest.h>
+
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_neighbor_index");
+
+struct test_neighbor_index {
+    using sut_type = lib_i::neighbor_index<int>;
+
+    static constexpr lib_t::size_type n_neighbors = 100ull;
+
+    test_neighbor_index() : edges(n_neighbors) {}
+
+    void insert_all() {
+        for (lib_t::id_type id = lib::constants::initial_id; id < n_neighbors; ++id)
+            sut.insert(id, &edges[id]);
+    }
+
+    sut_type sut;
+    std::vector<int> edges;
+};
+
+TEST_CASE_FIXTURE(test_neighbor_index, "should be inactive and empty by default") {
+    CHECK_FALSE(sut.is_active());
+    CHECK_EQ(sut.size(), constants::zero_elements);
+    CHECK_EQ(sut.capacity(), constants::zero_elements);
+    CHECK_EQ(sut.find(constants::vertex_id_1), nullptr);
+    CHECK_FALSE(sut.erase(constants::vertex_id_1, &edges[constants::first_element_idx]));
+}
+
+TEST_CASE_FIXTURE(
+    test_neighbor_index, "insert should activate the index and make the edges retrievable"
+) {
+    insert_all();
+
+    REQUIRE(sut.is_active());
+    CHECK_EQ(sut.size(), n_neighbors);
+    CHECK_GE(sut.capacity(), n_neighbors * constants::two);
+
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_neighbors; ++id)
+        CHECK_EQ(sut.find(id), &edges[id]);
+    CHECK_EQ(sut.find(n_neighbors), nullptr);
+}
+
+TEST_CASE_FIXTURE(
+    test_neighbor_index, "erase should remove only the given edge of the given neighbor"
+) {
+    insert_all();
+
+    // a parallel edge with the same neighbor id
+    int parallel_edge{};
+    sut.insert(constants::vertex_id_2, &parallel_edge);
+
+    CHECK_FALSE(sut.erase(constants::vertex_id_1, &parallel_edge));
+    CHECK(sut.erase(constants::vertex_id_2, &edges[constants::vertex_id_2]));
+    CHECK_EQ(sut.find(constants::vertex_id_2), &parallel_edge);
+    CHECK(sut.erase(constants::vertex_id_2, &parallel_edge));
+    CHECK_EQ(sut.find(constants::vertex_id_2), nullptr);
+    CHECK_EQ(sut.size(), n_neighbors - constants::one_element);
+
+    // the entries following the erased ones in their probe sequences should remain reachable
+    for (lib_t::id_type id = lib::constants::initial_id; id < n_neighbors; id += constants::two)
+        REQUIRE(sut.erase(id, &edges[id]));
+    for (lib_t::id_type id = constants::vertex_id_2 + constants::two; id < n_neighbors;
+         id += constants::two)
+        CHECK_EQ(sut.find(id), &edges[id]);
+}
+
+TEST_CASE_FIXTURE(test_neighbor_index, "reset should release the index") {
+    insert_all();
+    sut.reset();
+
+    CHECK_FALSE(sut.is_active());
+    CHECK_EQ(sut.size(), constants::zero_elements);
+    CHECK_EQ(sut.find(constants::vertex_id_1), nullptr);
+}
+
+TEST_SUITE_END(); // test_neighbor_index
+
+} // namespace gl_testing
@@ -0,0 +1,294 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/graph.hpp>
+#include <gl/storage/pmr_storage.hpp>
+
+#include <doctest.h>
+
+#include <execution>
+#include <memory_resource>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_pmr_storage");
+
+namespace {
+
+// tracks the number of bytes currently allocated from the upstream resource
+class counting_resource final : public std::pmr::memory_resource {
+public:
+    lib_t::size_type n_allocations = constants::zero;
+    lib_t::size_type n_allocated_bytes = constants::zero;
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        ++this->n_allocations;
+        this->n_allocated_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, const std::size_t bytes, const std::size_t alignment) override {
+        this->n_allocated_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept override {
+        return this == &other;
+    }
+};
+
+// replaces the default resource with the null resource, so that any allocation which falls
+// back to the default resource throws
+class null_default_resource_guard final {
+public:
+    null_default_resource_guard()
+    : _default_resource(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+
+    ~null_default_resource_guard() {
+        std::pmr::set_default_resource(this->_default_resource);
+    }
+
+private:
+    std::pmr::memory_resource* _default_resource;
+};
+
+} // namespace
+
+TEST_CASE("pmr storage should allocate and release the objects using the given resource") {
+    using sut_type = lib::storage::pmr_storage<int, lib::storage::pmr_unique_ptr<int>>;
+
+    counting_resource resource;
+    sut_type sut{&resource};
+    CHECK_EQ(sut.resource(), &resource);
+
+    auto ptr = sut.make(constants::three);
+    REQUIRE(ptr);
+    CHECK_EQ(*ptr, constants::three);
+    CHECK_EQ(resource.n_allocations, constants::one);
+    CHECK_EQ(resource.n_allocated_bytes, sizeof(int));
+
+    ptr = nullptr;
+    CHECK_EQ(resource.n_allocated_bytes, constants::zero);
+}
+
+TEST_CASE("pmr storage should use the default resource if no resource is specified") {
+    const lib::storage::pmr_storage<int, std::shared_ptr<int>> sut;
+    CHECK_EQ(sut.resource(), std::pmr::get_default_resource());
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with pmr storage should allocate all elements from the given resource",
+    TraitsType,
+    pmr_graph_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    counting_resource resource;
+
+    {
+        const null_default_resource_guard default_resource_guard;
+
+        graph_type sut{constants::n_elements, &resource};
+        CHECK_EQ(sut.memory_resource(), &resource);
+
+        const auto n_vertex_allocations = resource.n_allocations;
+        CHECK_GT(n_vertex_allocations, constants::n_elements);
+
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                if (first_id < second_id)
+                    sut.add_edge(first_id, second_id);
+
+        // each edge is allocated from the resource
+        CHECK_GE(resource.n_allocations - n_vertex_allocations, sut.n_unique_edges());
+
+        sut.remove_vertex(constants::vertex_id_1);
+        CHECK_EQ(sut.n_vertices(), constants::n_elements - constants::one_element);
+
+        // the conversions should preserve the memory resource
+        const auto frozen = sut.freeze();
+        CHECK_EQ(frozen.memory_resource(), &resource);
+        CHECK_EQ(frozen.thaw().memory_resource(), &resource);
+        CHECK_EQ(sut.clone().memory_resource(), &resource);
+
+        if constexpr (requires { sut.compress(); }) {
+            // the decoded edges are materialized using the resource of the graph
+            const auto compressed = sut.compress();
+            CHECK_EQ(compressed.memory_resource(), &resource);
+            CHECK(compressed.get_edge(constants::vertex_id_1, constants::vertex_id_2).has_value());
+        }
+    }
+
+    CHECK_EQ(resource.n_allocated_bytes, constants::zero);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graph implementations with pmr storage should allocate their containers from the given "
+    "resource",
+    TraitsType,
+    pmr_impl_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+    using sut_type = typename graph_type::implementation_type;
+    using allocator_type = typename graph_type::allocator_type;
+
+    counting_resource resource;
+
+    {
+        sut_type sut{constants::n_elements, allocator_type{&resource}};
+        CHECK_GT(resource.n_allocated_bytes, constants::zero);
+
+        const auto n_allocated_bytes = resource.n_allocated_bytes;
+        sut.add_vertices(constants::n_elements);
+        CHECK_GT(resource.n_allocated_bytes, n_allocated_bytes);
+    }
+
+    CHECK_EQ(resource.n_allocated_bytes, constants::zero);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with pmr storage should work with monotonic buffer resources",
+    TraitsType,
+    pmr_monotonic_graph_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    counting_resource upstream;
+    std::pmr::monotonic_buffer_resource resource{&upstream};
+
+    {
+        graph_type sut{&resource};
+        sut.add_vertices(constants::n_elements);
+        for (const auto vertex_id : sut.vertex_ids())
+            sut.add_edge(vertex_id, (vertex_id + constants::one) % constants::n_elements);
+
+        CHECK_EQ(sut.n_unique_edges(), constants::n_elements);
+        for (const auto vertex_id : sut.vertex_ids())
+            CHECK(sut.has_edge(vertex_id, (vertex_id + constants::one) % constants::n_elements));
+    }
+
+    // the monotonic resource releases the memory only when it is destroyed or released
+    CHECK_GT(upstream.n_allocated_bytes, constants::zero);
+    resource.release();
+    CHECK_EQ(upstream.n_allocated_bytes, constants::zero);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with pmr storage should add the edges with a parallel policy using monotonic buffer "
+    "resources",
+    TraitsType,
+    pmr_parallel_graph_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    counting_resource upstream;
+    std::pmr::monotonic_buffer_resource resource{&upstream};
+
+    {
+        const null_default_resource_guard default_resource_guard;
+
+        graph_type sut{constants::n_elements_top, &resource};
+
+        std::vector<lib_t::homogeneous_pair<lib_t::id_type>> id_pairs;
+        for (const auto first_id : sut.vertex_ids())
+            for (const auto second_id : sut.vertex_ids())
+                if (first_id < second_id)
+                    id_pairs.emplace_back(first_id, second_id);
+
+        sut.add_edges(std::execution::par, id_pairs);
+
+        CHECK_EQ(sut.n_unique_edges(), id_pairs.size());
+        for (const auto& [first_id, second_id] : id_pairs)
+            CHECK(sut.has_edge(first_id, second_id));
+    }
+
+    resource.release();
+    CHECK_EQ(upstream.n_allocated_bytes, constants::zero);
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    pmr_graph_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // directed adjacency list
+    lib::list_graph_traits<
+        lib::undirected_t,
+        types::visited_property,
+        types::used_property,
+        lib::storage::pmr_t>, // undirected adjacency list with properties
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        types::used_property,
+        lib::storage::pmr_t>, // directed adjacency matrix with edge properties
+    lib::matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t> // undirected adjacency matrix
+);
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    pmr_impl_traits_template,
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // undirected adjacency list
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        types::used_property,
+        lib::storage::pmr_t>, // directed adjacency matrix
+    lib::bit_matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // directed adjacency bit matrix
+    lib::sparse_matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t> // directed sparse adjacency matrix
+);
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    pmr_monotonic_graph_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // directed adjacency list
+    lib::sparse_matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t> // undirected sparse adjacency matrix
+);
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    pmr_parallel_graph_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // directed adjacency list
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::pmr_t>, // undirected adjacency list
+    lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t,
+        lib::storage::pmr_t> // directed adjacency list with the in-edge index
+);
+
+TEST_SUITE_END(); // test_pmr_storage
+
+} // namespace gl_testing
@@ -0,0 +1,111 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/algorithms.hpp>
+#include <gl/reverse_view.hpp>
+#include <gl/topologies.hpp>
+
+#include <doctest.h>
+
+#include <numeric>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_reverse_view");
+
+namespace {
+
+constexpr auto last_id = static_cast<lib_t::id_type>(constants::n_elements_alg - 1ull);
+
+// the graph should be a path graph 0 -> 1 -> ... -> n - 1 with an additional edge 0 -> n - 1
+template <lib_tt::c_directed_graph GraphType>
+void check_reverse_view(const GraphType& graph) {
+    using sut_type = lib::reverse_view<GraphType>;
+    static_assert(lib_tt::c_directed_graph_view<sut_type>);
+
+    const sut_type sut{graph};
+
+    CHECK_EQ(&sut.graph(), &graph);
+    CHECK_EQ(sut.n_vertices(), graph.n_vertices());
+    CHECK_EQ(sut.n_unique_edges(), graph.n_unique_edges());
+    CHECK(std::ranges::equal(sut.vertex_ids(), graph.vertex_ids()));
+    CHECK_EQ(&sut.get_vertex(last_id), &graph.get_vertex(last_id));
+
+    // the adjacent edges of the view should be the incoming edges of the graph
+    for (const auto vertex_id : graph.vertex_ids()) {
+        std::vector<lib_t::id_type> expected_adjacent_ids;
+        for (const auto source_id : graph.vertex_ids())
+            for (const auto& edge : graph.adjacent_edges(source_id))
+                if (edge.second_id() == vertex_id)
+                    expected_adjacent_ids.push_back(source_id);
+
+        std::vector<lib_t::id_type> adjacent_ids;
+        for (const auto& edge : sut.adjacent_edges(vertex_id)) {
+            CHECK_EQ(edge.second_id(), vertex_id);
+            CHECK(sut.has_edge(edge));
+            CHECK(sut.has_edge(vertex_id, edge.first_id()));
+            adjacent_ids.push_back(edge.incident_vertex_id(vertex_id));
+        }
+
+        std::ranges::sort(adjacent_ids);
+        CHECK_EQ(adjacent_ids, expected_adjacent_ids);
+    }
+
+    CHECK_EQ(sut.in_degree_map(), graph.out_degree_map());
+    CHECK_EQ(sut.out_degree_map(), graph.in_degree_map());
+
+    // the algorithms should traverse the graph backward
+    const auto pd = lib::algorithm::breadth_first_search(sut, last_id);
+    for (const auto vertex_id : graph.vertex_ids())
+        CHECK(pd.is_reachable(vertex_id));
+    CHECK_EQ(pd[constants::vertex_id_1], last_id);
+    CHECK_FALSE(lib::algorithm::breadth_first_search(graph, last_id)
+                    .is_reachable(constants::vertex_id_1));
+
+    const auto paths = lib::algorithm::dijkstra_shortest_paths(sut, last_id);
+    CHECK_EQ(paths.distances[constants::vertex_id_1], 1);
+    CHECK_EQ(paths.distances[last_id - 1u], 1);
+    CHECK_EQ(paths.distances[constants::vertex_id_2], last_id - 1u);
+
+    const auto order = lib::algorithm::topological_sort(sut);
+    REQUIRE(order.has_value());
+    std::vector<lib_t::id_type> expected_order(graph.n_vertices());
+    std::iota(expected_order.rbegin(), expected_order.rend(), lib_t::id_type{});
+    CHECK_EQ(order.value(), expected_order);
+}
+
+} // namespace
+
+TEST_CASE_TEMPLATE_DEFINE("reverse_view tests", TraitsType, reverse_view_traits_template) {
+    using graph_type = lib::graph<TraitsType>;
+
+    auto graph = lib::topology::path<graph_type>(constants::n_elements_alg);
+    graph.add_edge(constants::vertex_id_1, last_id);
+
+    SUBCASE("mutable graph") {
+        check_reverse_view(graph);
+    }
+
+    SUBCASE("frozen graph") {
+        check_reverse_view(graph.freeze());
+    }
+
+    SUBCASE("compressed graph") {
+        check_reverse_view(graph.compress());
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    reverse_view_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // adjacency list (transposed index)
+    lib::graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib_i::bidirectional_list_t>, // adjacency list with the in-edge index
+    lib::matrix_graph_traits<lib::directed_t> // adjacency matrix
+);
+
+TEST_SUITE_END(); // test_reverse_view
+
+} // namespace gl_testing
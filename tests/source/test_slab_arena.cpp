@@ -0,0 +1,267 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/graph.hpp>
+#include <gl/storage/slab_arena.hpp>
+
+#include <doctest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_slab_arena");
+
+namespace {
+
+struct tracked_object {
+    tracked_object(const lib_t::size_type value, lib_t::size_type& n_alive)
+    : value(value), n_alive(n_alive) {
+        ++this->n_alive;
+    }
+
+    ~tracked_object() {
+        --this->n_alive;
+    }
+
+    lib_t::size_type value;
+    lib_t::size_type& n_alive;
+};
+
+} // namespace
+
+struct test_slab_arena {
+    using sut_type = lib::storage::slab_arena<tracked_object>;
+    using ptr_type = typename sut_type::ptr_type;
+
+    sut_type sut;
+    lib_t::size_type n_alive = constants::zero;
+};
+
+TEST_CASE_FIXTURE(test_slab_arena, "should not allocate any memory by default") {
+    CHECK_EQ(sut.size(), constants::zero_elements);
+    CHECK_EQ(sut.capacity(), constants::zero_elements);
+}
+
+TEST_CASE_FIXTURE(test_slab_arena, "make should construct the object in the arena") {
+    const auto ptr = sut.make(constants::three, n_alive);
+
+    REQUIRE(ptr);
+    CHECK_EQ(ptr->value, constants::three);
+    CHECK_EQ(ptr.use_count(), constants::one);
+    CHECK_EQ(n_alive, constants::one);
+    CHECK_EQ(sut.size(), constants::one_element);
+    CHECK_GE(sut.capacity(), sut.size());
+}
+
+TEST_CASE_FIXTURE(
+    test_slab_arena, "copies of a handle should share the object and release it once"
+) {
+    auto ptr = sut.make(constants::one, n_alive);
+    {
+        const auto ptr_copy = ptr;
+        CHECK_EQ(ptr_copy.get(), ptr.get());
+        CHECK_EQ(ptr.use_count(), constants::two);
+    }
+
+    CHECK_EQ(ptr.use_count(), constants::one);
+    CHECK_EQ(n_alive, constants::one);
+
+    ptr = nullptr;
+    CHECK_FALSE(ptr);
+    CHECK_EQ(ptr, nullptr);
+    CHECK_EQ(n_alive, constants::zero);
+    CHECK_EQ(sut.size(), constants::zero_elements);
+}
+
+TEST_CASE_FIXTURE(
+    test_slab_arena, "moving a handle should transfer the ownership without releasing the object"
+) {
+    auto ptr = sut.make(constants::one, n_alive);
+    const auto* object = ptr.get();
+
+    const auto moved_ptr = std::move(ptr);
+    CHECK_FALSE(ptr);
+    CHECK_EQ(moved_ptr.get(), object);
+    CHECK_EQ(moved_ptr.use_count(), constants::one);
+    CHECK_EQ(n_alive, constants::one);
+}
+
+TEST_CASE_FIXTURE(test_slab_arena, "released slots should be reused by subsequent allocations") {
+    auto ptr = sut.make(constants::one, n_alive);
+    const auto* released_address = ptr.get();
+    const auto capacity = sut.capacity();
+
+    ptr = nullptr;
+    const auto new_ptr = sut.make(constants::two, n_alive);
+
+    CHECK_EQ(new_ptr.get(), released_address);
+    CHECK_EQ(sut.capacity(), capacity);
+}
+
+TEST_CASE_FIXTURE(
+    test_slab_arena, "allocated objects should keep their addresses when the arena grows"
+) {
+    constexpr lib_t::size_type n_objects = 1000ull;
+
+    std::vector<ptr_type> pointers;
+    std::vector<const tracked_object*> addresses;
+    for (lib_t::size_type i = constants::zero; i < n_objects; ++i) {
+        pointers.push_back(sut.make(i, n_alive));
+        addresses.push_back(pointers.back().get());
+    }
+
+    REQUIRE_EQ(sut.size(), n_objects);
+    CHECK_EQ(n_alive, n_objects);
+
+    for (lib_t::size_type i = constants::zero; i < n_objects; ++i) {
+        CHECK_EQ(pointers[i].get(), addresses[i]);
+        CHECK_EQ(pointers[i]->value, i);
+    }
+
+    pointers.clear();
+    CHECK_EQ(n_alive, constants::zero);
+    CHECK_EQ(sut.size(), constants::zero_elements);
+}
+
+TEST_CASE_FIXTURE(
+    test_slab_arena, "reserve should preallocate slots for the given number of objects"
+) {
+    constexpr lib_t::size_type n_objects = 1000ull;
+
+    sut.reserve(n_objects);
+    const auto capacity = sut.capacity();
+    REQUIRE_GE(capacity, n_objects);
+
+    std::vector<ptr_type> pointers;
+    for (lib_t::size_type i = constants::zero; i < n_objects; ++i)
+        pointers.push_back(sut.make(i, n_alive));
+
+    CHECK_EQ(sut.capacity(), capacity);
+}
+
+TEST_CASE_FIXTURE(
+    test_slab_arena, "handles should remain valid after the arena is moved or move assigned"
+) {
+    auto ptr = sut.make(constants::one, n_alive);
+
+    sut_type moved_sut = std::move(sut);
+    CHECK_EQ(moved_sut.size(), constants::one_element);
+
+    sut_type assigned_sut;
+    const auto other_ptr = assigned_sut.make(constants::two, n_alive);
+    assigned_sut = std::move(moved_sut);
+    CHECK_EQ(assigned_sut.size(), constants::one_element);
+
+    ptr = nullptr;
+    CHECK_EQ(assigned_sut.size(), constants::zero_elements);
+    CHECK_EQ(other_ptr->value, constants::two);
+    CHECK_EQ(n_alive, constants::one);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with arena storage should remain valid after being moved",
+    TraitsType,
+    arena_graph_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+
+    graph_type source{constants::n_elements};
+    for (const auto first_id : source.vertex_ids())
+        for (const auto second_id : source.vertex_ids())
+            if (first_id < second_id)
+                source.add_edge(first_id, second_id);
+
+    const auto n_unique_edges = source.n_unique_edges();
+
+    graph_type sut{constants::one_element};
+    sut.add_edge(constants::vertex_id_1, constants::vertex_id_1);
+    sut = std::move(source);
+
+    REQUIRE_EQ(sut.n_unique_edges(), n_unique_edges);
+    sut.remove_edge(sut.get_edge(constants::vertex_id_1, constants::vertex_id_2).value());
+    CHECK_FALSE(sut.has_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+    const auto& new_edge = sut.add_edge(constants::vertex_id_1, constants::vertex_id_2);
+    CHECK(sut.has_edge(new_edge));
+    CHECK_EQ(sut.n_unique_edges(), n_unique_edges);
+
+    sut.remove_vertex(constants::vertex_id_1);
+    CHECK_EQ(sut.n_vertices(), constants::n_elements - constants::one_element);
+}
+
+TEST_CASE_TEMPLATE_DEFINE(
+    "graphs with arena storage should allocate the vertices in contiguous blocks",
+    TraitsType,
+    arena_graph_vertices_traits_template
+) {
+    using graph_type = lib::graph<TraitsType>;
+    using vertex_type = typename graph_type::vertex_type;
+
+    graph_type sut{constants::n_elements};
+    sut.add_vertices(constants::n_elements);
+
+    const auto vertices = sut.vertices();
+    const auto* first_vertex = &vertices[constants::first_element_idx];
+    for (const auto vertex_id : sut.vertex_ids())
+        CHECK_EQ(
+            reinterpret_cast<const std::byte*>(&sut.get_vertex(vertex_id))
+                - reinterpret_cast<const std::byte*>(first_vertex),
+            static_cast<std::ptrdiff_t>(
+                vertex_id * sizeof(lib::storage::detail::arena_slot<vertex_type>)
+            )
+        );
+
+    // the addresses of the remaining vertices should not change after a removal
+    const auto* last_vertex = &sut.get_vertex(sut.n_vertices() - constants::one_element);
+    sut.remove_vertex(constants::vertex_id_1);
+    CHECK_EQ(&sut.get_vertex(sut.n_vertices() - constants::one_element), last_vertex);
+
+    // the released slot should be reused by the next vertex
+    const auto& new_vertex = sut.add_vertex();
+    CHECK_EQ(&new_vertex, first_vertex);
+    CHECK_EQ(new_vertex.id(), sut.n_vertices() - constants::one_element);
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    arena_graph_vertices_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency list
+    lib::matrix_graph_traits<
+        lib::undirected_t,
+        types::visited_property,
+        lib_t::empty_properties,
+        lib::storage::arena_t> // undirected adjacency matrix with vertex properties
+);
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    arena_graph_traits_template,
+    lib::list_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency list
+    lib::list_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // undirected adjacency list
+    lib::matrix_graph_traits<
+        lib::directed_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<
+        lib::undirected_t,
+        lib_t::empty_properties,
+        lib_t::empty_properties,
+        lib::storage::arena_t> // undirected adjacency matrix
+);
+
+TEST_SUITE_END(); // test_slab_arena
+
+} // namespace gl_testing
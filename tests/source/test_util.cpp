@@ -2,9 +2,12 @@
 
 #include <gl/util/enum.hpp>
 #include <gl/util/pow.hpp>
+#include <gl/util/sorted_intersection.hpp>
 
 #include <doctest.h>
 
+#include <vector>
+
 namespace gl_testing {
 
 TEST_SUITE_BEGIN("test_util");
@@ -67,6 +70,34 @@ TEST_CASE("to_underlying should return the underlying value of an enum class") {
     CHECK_EQ(lib::util::to_underlying(static_cast<Enum>(out_of_bounds_value)), out_of_bounds_value);
 }
 
+TEST_CASE("sorted_intersection should return the sorted unique values present in both ranges") {
+    using value_list = std::vector<lib_t::size_type>;
+
+    value_list first, second, expected_result;
+
+    // clang-format off
+
+    SUBCASE("empty range") { first = {}; second = {1, 2}; expected_result = {}; }
+    SUBCASE("disjoint ranges") { first = {1, 3, 5}; second = {0, 2, 4, 6}; expected_result = {}; }
+    SUBCASE("merge") { first = {0, 1, 1, 3, 5, 8}; second = {1, 1, 2, 3, 8, 9}; expected_result = {1, 3, 8}; }
+
+    // clang-format on
+
+    SUBCASE("gallop") {
+        // the first range is much shorter than the second one
+        first = {0, 2, 2, 64, 99, 150};
+        for (lib_t::size_type value = 2ull; value < 100ull; ++value)
+            second.push_back(value);
+        expected_result = {2, 64, 99};
+    }
+
+    CAPTURE(first);
+    CAPTURE(second);
+
+    CHECK_EQ(lib::util::sorted_intersection(first, second), expected_result);
+    CHECK_EQ(lib::util::sorted_intersection(second, first), expected_result);
+}
+
 TEST_SUITE_END(); // test_util
 
 } // namespace gl_testing
@@ -0,0 +1,117 @@
+#include "constants.hpp"
+#include "types.hpp"
+
+#include <gl/algorithms.hpp>
+#include <gl/versioned_graph.hpp>
+
+#include <doctest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace gl_testing {
+
+TEST_SUITE_BEGIN("test_versioned_graph");
+
+TEST_CASE_TEMPLATE_DEFINE("versioned_graph tests", TraitsType, versioned_graph_traits_template) {
+    using graph_type = lib::graph<TraitsType>;
+    using sut_type = lib::versioned_graph<graph_type>;
+
+    sut_type sut{graph_type{constants::n_elements}};
+
+    const auto initial_snapshot = sut.snapshot();
+    REQUIRE(initial_snapshot);
+    CHECK_EQ(sut.version(), constants::zero);
+    CHECK_EQ(initial_snapshot->n_vertices(), constants::n_elements);
+    CHECK_EQ(initial_snapshot->n_unique_edges(), constants::zero);
+
+    SUBCASE("modify should not change the published snapshot") {
+        const auto n_unique_edges = sut.modify([](graph_type& graph) {
+            graph.add_edge(constants::vertex_id_1, constants::vertex_id_2);
+            return graph.n_unique_edges();
+        });
+
+        CHECK_EQ(n_unique_edges, constants::one);
+        CHECK_EQ(sut.version(), constants::zero);
+        CHECK_EQ(sut.snapshot(), initial_snapshot);
+        CHECK_EQ(sut.snapshot()->n_unique_edges(), constants::zero);
+    }
+
+    SUBCASE("publish should create a new version without changing the old snapshots") {
+        sut.modify([](graph_type& graph) {
+            graph.add_edge(constants::vertex_id_1, constants::vertex_id_2);
+        });
+
+        const auto published = sut.publish();
+        CHECK_EQ(sut.version(), constants::one);
+        CHECK_EQ(sut.snapshot(), published);
+        CHECK_EQ(published->n_unique_edges(), constants::one);
+        CHECK(published->has_edge(constants::vertex_id_1, constants::vertex_id_2));
+
+        const auto republished = sut.modify_and_publish([](graph_type& graph) {
+            graph.add_vertex();
+            graph.add_edge(constants::vertex_id_2, constants::vertex_id_3);
+        });
+        CHECK_EQ(sut.version(), constants::two);
+        CHECK_EQ(republished->n_vertices(), constants::n_elements + constants::one_element);
+        CHECK_EQ(republished->n_unique_edges(), constants::two);
+
+        CHECK_EQ(published->n_vertices(), constants::n_elements);
+        CHECK_EQ(published->n_unique_edges(), constants::one);
+        CHECK_EQ(initial_snapshot->n_unique_edges(), constants::zero);
+    }
+}
+
+TEST_CASE_TEMPLATE_INSTANTIATE(
+    versioned_graph_traits_template,
+    lib::list_graph_traits<lib::directed_t>, // directed adjacency list
+    lib::list_graph_traits<lib::undirected_t>, // undirected adjacency list
+    lib::matrix_graph_traits<lib::directed_t>, // directed adjacency matrix
+    lib::matrix_graph_traits<lib::undirected_t> // undirected adjacency matrix
+);
+
+TEST_CASE("versioned_graph should allow traversing the snapshots while the graph is modified") {
+    using graph_type = lib::graph<lib::list_graph_traits<lib::directed_t>>;
+    constexpr lib_t::size_type n_versions = 64ull;
+    constexpr lib_t::size_type n_readers = 2ull;
+
+    // each version is a path graph, which is fully reachable from the first vertex
+    lib::versioned_graph<graph_type> sut{graph_type{constants::one_element}};
+    std::atomic<bool> writing = true;
+
+    std::vector<std::thread> readers;
+    std::vector<lib_t::size_type> n_inconsistent_snapshots(n_readers, constants::zero);
+    for (lib_t::size_type reader_idx = constants::zero; reader_idx < n_readers; ++reader_idx) {
+        auto& n_inconsistent = n_inconsistent_snapshots[reader_idx];
+        readers.emplace_back([&sut, &writing, &n_inconsistent] {
+            while (writing.load()) {
+                const auto snapshot = sut.snapshot();
+                const auto pd = lib::algorithm::breadth_first_search(*snapshot, lib_t::id_type{});
+                for (const auto vertex_id : snapshot->vertex_ids())
+                    if (not pd.is_reachable(vertex_id))
+                        ++n_inconsistent;
+            }
+        });
+    }
+
+    for (lib_t::size_type version = constants::one; version <= n_versions; ++version) {
+        sut.modify_and_publish([](graph_type& graph) {
+            const auto& vertex = graph.add_vertex();
+            graph.add_edge(vertex.id() - 1u, vertex.id());
+        });
+    }
+    writing.store(false);
+
+    for (auto& reader : readers)
+        reader.join();
+
+    CHECK_EQ(sut.version(), n_versions);
+    CHECK_EQ(sut.snapshot()->n_vertices(), n_versions + constants::one);
+    for (const auto n_inconsistent : n_inconsistent_snapshots)
+        CHECK_EQ(n_inconsistent, constants::zero);
+}
+
+TEST_SUITE_END(); // test_versioned_graph
+
+} // namespace gl_testing
@@ -38,6 +38,14 @@ TEST_CASE("vertex_descriptor objects should be compared by id") {
     CHECK_GT(vd_2, vd_1);
 }
 
+TEST_CASE("vertex_descriptor should be declared in the inline namespace of the id width") {
+#ifdef GL_CONFIG_ID_TYPE_32
+    CHECK(std::same_as<lib::vertex_descriptor<>, lib::id_type_32::vertex_descriptor<>>);
+#else
+    CHECK(std::same_as<lib::vertex_descriptor<>, lib::id_type_64::vertex_descriptor<>>);
+#endif
+}
+
 TEST_SUITE_END(); // test_vertex_descriptor
 
 } // namespace gl_testing